@@ -0,0 +1,22 @@
+package("basisu")
+    set_homepage("https://github.com/BinomialLLC/basis_universal")
+    set_description("Basis Universal transcoder: KTX2 / ETC1S / UASTC to GPU block formats")
+    set_urls("https://github.com/BinomialLLC/basis_universal.git")
+
+    on_install(function (package)
+        -- Only the transcoder and the Zstd decoder it needs for KTX2; the encoder stays out
+        local xmake_script = [[
+            add_rules("mode.release", "mode.debug")
+
+            target("basisu")
+                set_kind("static")
+                set_languages("c++17")
+                add_files("transcoder/basisu_transcoder.cpp")
+                add_files("zstd/zstddeclib.c")
+                add_headerfiles("transcoder/*.h", "transcoder/*.inc", {prefixdir = "basisu/transcoder"})
+                add_headerfiles("zstd/zstd.h", {prefixdir = "basisu/zstd"})
+        ]]
+
+        io.writefile("xmake.lua", xmake_script)
+        import("package.tools.xmake").install(package)
+    end)
@@ -14,12 +14,23 @@
 #include "Aether/ImGui/ImGuiLayer.h"
 
 #include "Aether/Renderer/RenderCommand.h"
+#include "Aether/Renderer/Renderer.h"
 
 
 #include "Aether/Renderer/Buffer.h"
 #include "Aether/Renderer/VertexArray.h"
 #include "Aether/Renderer/UniformBuffer.h"
+#include "Aether/Renderer/RingBuffer.h"
+#include "Aether/Renderer/DrawBatcher.h"
+#include "Aether/Renderer/FrustumCuller.h"
+#include "Aether/Renderer/OcclusionCuller.h"
+#include "Aether/Renderer/CascadedShadowMap.h"
+#include "Aether/Renderer/Bounds.h"
+#include "Aether/Renderer/AABBTree.h"
+#include "Aether/Renderer/TriangleBVH.h"
 #include "Aether/Renderer/FrameBuffer.h"
+#include "Aether/Renderer/RenderTargetPool.h"
+#include "Aether/Renderer/RenderGraph.h"
 #include "Aether/Renderer/EditorCamera.h"
 
 #include "Aether/Resources/Shader.h"
@@ -27,4 +38,7 @@
 
 #include "Aether/Resources/Mesh.h"
 #include "Aether/Resources/Material.h"
-#include "Aether/Resources/ModelLoader.h"
\ No newline at end of file
+#include "Aether/Resources/ModelLoader.h"
+#include "Aether/Resources/GpuMemoryBudget.h"
+#include "Aether/Resources/TextureStreamer.h"
+#include "Aether/Resources/Environment.h"
\ No newline at end of file
@@ -3,7 +3,12 @@
 #include "Aether/Core/Log.h"
 
 #include "Aether/Renderer/Renderer.h"
+#include "Aether/Renderer/RenderTargetPool.h"
 #include "Aether/Core/JobSystem.h"
+#include "Aether/Resources/AssetWatcher.h"
+#include "Aether/Resources/ResourceRegistry.h"
+#include "Aether/Resources/GpuMemoryBudget.h"
+#include "Aether/Resources/TextureStreamer.h"
 
 #include "Aether/Core/Input.h"
 #include "Aether/Utils/PlatformUtils.h"
@@ -19,6 +24,8 @@ namespace Aether {
 
         Renderer::Init();  
         JobSystem::Init(2);
+        TextureStreamer::Init();
+        AssetWatcher::Init("assets");
 
         m_ImGuiLayer = new ImGuiLayer();
         PushOverlay(m_ImGuiLayer);
@@ -26,8 +33,11 @@ namespace Aether {
 
     Application::~Application()
     {
-        Renderer::Shutdown();
+        AssetWatcher::Shutdown();
+        // Workers may still be writing into the staging ring
         JobSystem::Shutdown();
+        TextureStreamer::Shutdown();
+        Renderer::Shutdown();
     }
 
     void Application::Close()
@@ -64,12 +74,32 @@ namespace Aether {
 
     void Application::Run()
     {
+        if (m_ThreadingPolicy == ThreadingPolicy::MultiThreaded)
+        {
+            for (Layer* layer : m_LayerStack)
+            {
+                if (layer->IsRenderThreadSafe())
+                    continue;
+
+                AE_CORE_WARN("Application: Layer '{0}' makes GPU calls outside Renderer::Submit, staying single-threaded", layer->GetName());
+                m_ThreadingPolicy = ThreadingPolicy::SingleThreaded;
+                break;
+            }
+        }
+
+        // Layers attach before Run(), while the context is still current here
+        RenderThread::Init(m_ThreadingPolicy, m_Window->GetContext());
+
+        uint64_t frame = 0;
         while (m_Running)
         {
             float time = Time::GetTime();
 			Timestep timestep = time - m_LastFrameTime;
 			m_LastFrameTime = time;
 
+            UpdateSystems();
+
+            // Frame N + 1 is recorded here while the render thread replays frame N
             for (Layer* layer : m_LayerStack) layer->Update(timestep);
             
 
@@ -81,7 +111,48 @@ namespace Aether {
             m_ImGuiLayer->End();
 
             m_Window->Update();
+            RenderThread::Kick();
+
+            if (m_FrameLimit && ++frame >= m_FrameLimit)
+                m_Running = false;
         }
+
+        RenderThread::Shutdown();
+    }
+
+    void Application::UpdateSystems()
+    {
+        // Nothing on this thread holds a borrowed resource pointer between frames. The render thread
+        // may still be replaying the last one, so retired objects die behind it, in this frame's queue.
+        std::vector<Ref<void>> retired;
+        ResourceRegistryBase::CollectAll(retired);
+        if (!retired.empty())
+            Renderer::Submit([retired = std::move(retired)]() mutable { retired.clear(); });
+
+        GpuMemoryBudget::Update();
+        // Acts on the resolutions requested while rendering the previous frame
+        TextureStreamer::Update();
+        Renderer::Submit([]() { RenderTargetPool::Update(); });
+        ExecuteMainThreadQueue();
+        AssetWatcher::Update();
+    }
+
+    void Application::SubmitToMainThread(const std::function<void()>& function)
+    {
+        std::lock_guard<std::mutex> lock(m_MainThreadQueueMutex);
+        m_MainThreadQueue.emplace_back(function);
+    }
+
+    void Application::ExecuteMainThreadQueue()
+    {
+        std::vector<std::function<void()>> queue;
+        {
+            std::lock_guard<std::mutex> lock(m_MainThreadQueueMutex);
+            queue.swap(m_MainThreadQueue);
+        }
+
+        for (auto& function : queue)
+            function();
     }
 
     bool Application::OnWindowClose(WindowCloseEvent& e)
@@ -7,6 +7,9 @@
 #include "Aether/ImGui/ImGuiLayer.h"
 
 #include "Aether/Core/Timestep.h"
+#include "Aether/Renderer/RenderThread.h"
+
+#include <mutex>
 
 namespace Aether {
 
@@ -25,14 +28,30 @@ namespace Aether {
 
         static Application& Get() { return *s_Instance; }
         Window& GetWindow() { return *m_Window; }
+
+        // Run() returns after this many frames; 0 runs until the window closes
+        void SetFrameLimit(uint64_t frames) { m_FrameLimit = frames; }
+        // Before Run(); MultiThreaded falls back to SingleThreaded unless every layer is render-thread safe
+        void SetThreadingPolicy(ThreadingPolicy policy) { m_ThreadingPolicy = policy; }
+
+        // Thread-safe; runs on the main thread at the start of the next frame. GL work goes through Renderer::Submit.
+        void SubmitToMainThread(const std::function<void()>& function);
     private:
         bool OnWindowClose(WindowCloseEvent& e);
+        // Main thread, between frames: per-frame upkeep of the resource systems. Their GL work is submitted.
+        void UpdateSystems();
+        void ExecuteMainThreadQueue();
         static Application* s_Instance;
         Scope<Window> m_Window;
         bool m_Running = true;
         LayerStack m_LayerStack;
         float m_LastFrameTime = 0.0f;
+        uint64_t m_FrameLimit = 0;
+        ThreadingPolicy m_ThreadingPolicy = ThreadingPolicy::SingleThreaded;
         ImGuiLayer* m_ImGuiLayer;
+
+        std::vector<std::function<void()>> m_MainThreadQueue;
+        std::mutex m_MainThreadQueueMutex;
     };
 
     Application* CreateApplication();
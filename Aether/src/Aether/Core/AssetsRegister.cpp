@@ -1,39 +1,53 @@
 #include "aepch.h" 
 #include "AssetsRegister.h"
 
+#include <mutex>
+
 namespace Aether {
-    std::unordered_map<std::string, UUID>& AssetsRegister::GetMap()
+    ConcurrentHashMap<std::string, UUID>& AssetsRegister::GetMap()
     {
-        static std::unordered_map<std::string, UUID> s_Map;
+        static ConcurrentHashMap<std::string, UUID> s_Map(256);
         return s_Map;
     }
 
     UUID AssetsRegister::Get(const std::string& key)
     {
-        auto& map = GetMap();
-        if (map.find(key) == map.end()) 
+        UUID id = 0;
+        if (!GetMap().Find(key, id)) 
         {
             AE_CORE_ERROR("Key '{0}' has not registered yet!", key);
             return 0; 
         }
-        return map[key];
+        return id;
     }
 
     UUID AssetsRegister::Register(const std::string& key)
     {
-        if (Exists(key)) {
-            AE_CORE_WARN("Key '{0}' already exists! Returning existing UUID.", key);
-            return Get(key);
+        UUID id = 0;
+        if (GetMap().Find(key, id))
+            return id;
+
+        id = MakeID(key);
+
+        // Owners of every issued ID, only touched on this (rare) path
+        static std::unordered_map<uint64_t, std::string> s_Owners;
+        static std::mutex s_Mutex;
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            auto [it, inserted] = s_Owners.emplace(id, key);
+            if (!inserted && it->second != key)
+            {
+                AE_CORE_ERROR("AssetsRegister: '{0}' and '{1}' hash to the same ID {2:#018x}!", key, it->second, (uint64_t)id);
+                AE_CORE_ASSERT(false, "AssetsRegister: ID collision!");
+                return 0;
+            }
         }
 
-        UUID newID = UUID(); 
-        GetMap()[key] = newID;
-        return newID;
+        return GetMap().GetOrInsert(key, id);
     }
 
     bool AssetsRegister::Exists(const std::string& key)
     {
-        auto& map = GetMap();
-        return map.find(key) != map.end();
+        return GetMap().Contains(key);
     }
-}
\ No newline at end of file
+}
@@ -1,17 +1,27 @@
 #pragma once
 #include "Aether/Core/UUID.h"
+#include "Aether/Core/Hash.h"
+#include "Aether/Core/ConcurrentHashMap.h"
 #include <string> 
-#include <unordered_map>
 
 namespace Aether {
+    // IDs are the XXH64 of the key, so the same key maps to the same UUID on every run
+    // and machine. Safe from any thread; lookups never take a lock.
     class AssetsRegister
     {
     public:
         static UUID Get(const std::string& key);
+        // Literal keys are hashed at compile time; they skip the registry, so no "not registered" check
+        template<size_t N>
+        static constexpr UUID Get(const char (&key)[N]) { return MakeID(std::string_view(key, N - 1)); }
+
+        // Idempotent: registering a key again returns the same ID
         static UUID Register(const std::string& key);
         static bool Exists(const std::string& key);
 
+        static constexpr UUID MakeID(std::string_view key) { return Hash::XXH64(key); }
+
     private:
-        static std::unordered_map<std::string, UUID>& GetMap();
+        static ConcurrentHashMap<std::string, UUID>& GetMap();
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "aepch.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace Aether {
+
+    // Insert-only open-addressing map for read-mostly registries.
+    // Find() is lock-free and may run on any thread while another thread inserts;
+    // writers serialize on a mutex. Growing publishes a new slot table and keeps
+    // the old one alive, so readers that still hold it stay valid (RCU-style).
+    template<typename K, typename V, typename Hasher = std::hash<K>>
+    class ConcurrentHashMap
+    {
+    public:
+        explicit ConcurrentHashMap(size_t capacity = 64)
+        {
+            size_t size = 16;
+            while (size < capacity * 2)
+                size <<= 1;
+            m_Tables.push_back(CreateScope<Table>(size));
+            m_Table.store(m_Tables.back().get(), std::memory_order_release);
+        }
+
+        ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+        ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+        bool Find(const K& key, V& value) const
+        {
+            const Entry* entry = FindEntry(key);
+            if (!entry)
+                return false;
+
+            value = entry->Value.load(std::memory_order_acquire);
+            return true;
+        }
+
+        bool Contains(const K& key) const { return FindEntry(key) != nullptr; }
+
+        // Returns the stored value; `value` is only inserted if the key is absent
+        V GetOrInsert(const K& key, const V& value, bool* inserted = nullptr)
+        {
+            std::lock_guard<std::mutex> lock(m_WriteMutex);
+            if (const Entry* entry = FindEntry(key))
+            {
+                if (inserted) *inserted = false;
+                return entry->Value.load(std::memory_order_relaxed);
+            }
+
+            InsertEntry(key, value);
+            if (inserted) *inserted = true;
+            return value;
+        }
+
+        void Set(const K& key, const V& value)
+        {
+            std::lock_guard<std::mutex> lock(m_WriteMutex);
+            if (const Entry* entry = FindEntry(key))
+                entry->Value.store(value, std::memory_order_release);
+            else
+                InsertEntry(key, value);
+        }
+
+        // Writer-side iteration; the callback must not write to this map
+        template<typename Func>
+        void ForEach(Func&& func) const
+        {
+            std::lock_guard<std::mutex> lock(m_WriteMutex);
+            for (const auto& entry : m_Entries)
+                func(entry->Key, entry->Value.load(std::memory_order_relaxed));
+        }
+
+        size_t Size() const
+        {
+            std::lock_guard<std::mutex> lock(m_WriteMutex);
+            return m_Entries.size();
+        }
+
+        // Not safe against concurrent readers: only call at shutdown
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lock(m_WriteMutex);
+            size_t size = m_Table.load(std::memory_order_relaxed)->Mask + 1;
+            m_Entries.clear();
+            m_Tables.clear();
+            m_Tables.push_back(CreateScope<Table>(size));
+            m_Table.store(m_Tables.back().get(), std::memory_order_release);
+        }
+
+    private:
+        struct Entry
+        {
+            Entry(const K& key, const V& value, size_t hash)
+                : Key(key), Value(value), Hash(hash) {}
+
+            const K Key;
+            mutable std::atomic<V> Value;
+            const size_t Hash;
+        };
+
+        struct Table
+        {
+            explicit Table(size_t size)
+                : Mask(size - 1), Slots(new std::atomic<Entry*>[size])
+            {
+                for (size_t i = 0; i < size; i++)
+                    Slots[i].store(nullptr, std::memory_order_relaxed);
+            }
+
+            const size_t Mask;
+            Scope<std::atomic<Entry*>[]> Slots;
+        };
+
+        const Entry* FindEntry(const K& key) const
+        {
+            const Table* table = m_Table.load(std::memory_order_acquire);
+            size_t hash = Hasher()(key);
+            for (size_t i = hash & table->Mask;; i = (i + 1) & table->Mask)
+            {
+                const Entry* entry = table->Slots[i].load(std::memory_order_acquire);
+                if (!entry)
+                    return nullptr;
+                if (entry->Hash == hash && entry->Key == key)
+                    return entry;
+            }
+        }
+
+        // Caller holds m_WriteMutex
+        void InsertEntry(const K& key, const V& value)
+        {
+            Table* table = m_Table.load(std::memory_order_relaxed);
+
+            // Keep the load factor under 1/2 so probe chains stay short
+            if ((m_Entries.size() + 1) * 2 > table->Mask + 1)
+            {
+                auto grown = CreateScope<Table>((table->Mask + 1) * 2);
+                for (const auto& entry : m_Entries)
+                    Place(*grown, entry.get());
+
+                table = grown.get();
+                m_Tables.push_back(std::move(grown));
+                m_Table.store(table, std::memory_order_release);
+            }
+
+            m_Entries.push_back(CreateScope<Entry>(key, value, Hasher()(key)));
+            Place(*table, m_Entries.back().get());
+        }
+
+        static void Place(Table& table, Entry* entry)
+        {
+            size_t i = entry->Hash & table.Mask;
+            while (table.Slots[i].load(std::memory_order_relaxed))
+                i = (i + 1) & table.Mask;
+            table.Slots[i].store(entry, std::memory_order_release);
+        }
+
+        std::atomic<Table*> m_Table;
+        // Every table ever published: retired ones are tiny next to the live one and freed on Clear()
+        std::vector<Scope<Table>> m_Tables;
+        std::vector<Scope<Entry>> m_Entries;
+        mutable std::mutex m_WriteMutex;
+    };
+}
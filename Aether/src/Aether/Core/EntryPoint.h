@@ -1,5 +1,6 @@
 #pragma once
 #include "Application.h"
+#include "Aether/Renderer/RendererAPI.h"
 
 extern Aether::Application* Aether::CreateApplication();
 
@@ -7,7 +8,25 @@ int main(int argc, char** argv)
 {
     Aether::Log::Init();
     AE_CORE_WARN("Initialized Log!");
+
+    // --headless records draws on the Null renderer instead of opening a window; --frames <n> exits after n frames;
+    // --render-thread replays GPU work on its own thread
+    uint64_t frameLimit = 0;
+    Aether::ThreadingPolicy threading = Aether::ThreadingPolicy::SingleThreaded;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--headless")
+            Aether::RendererAPI::SetAPI(Aether::RendererAPI::API::Null);
+        else if (arg == "--frames" && i + 1 < argc)
+            frameLimit = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--render-thread")
+            threading = Aether::ThreadingPolicy::MultiThreaded;
+    }
+
     auto app = Aether::CreateApplication();
+    app->SetFrameLimit(frameLimit);
+    app->SetThreadingPolicy(threading);
     app->Run();
     delete app;
 }
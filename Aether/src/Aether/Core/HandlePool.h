@@ -0,0 +1,343 @@
+#pragma once
+
+#include "aepch.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace Aether {
+
+    enum class AssetState : uint8_t
+    {
+        None = 0,
+        Queued,
+        Loading,
+        Ready,
+        Failed,
+        // Dropped to fit the memory budget; the handle stays valid and is reloaded on next use
+        Evicted
+    };
+
+    // 32-bit generational handle: low 20 bits index a slot, high 12 bits hold its generation.
+    // Generation 0 is never issued, so a default-constructed handle is always invalid.
+    template<typename T>
+    struct Handle
+    {
+        static constexpr uint32_t IndexBits = 20;
+        static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+        static constexpr uint32_t GenerationMask = (1u << (32 - IndexBits)) - 1;
+
+        uint32_t Value = 0;
+
+        Handle() = default;
+        Handle(uint32_t index, uint32_t generation)
+            : Value(((generation & GenerationMask) << IndexBits) | (index & IndexMask)) {}
+
+        uint32_t GetIndex() const { return Value & IndexMask; }
+        uint32_t GetGeneration() const { return Value >> IndexBits; }
+
+        bool IsValid() const { return Value != 0; }
+        explicit operator bool() const { return IsValid(); }
+
+        bool operator==(const Handle& other) const { return Value == other.Value; }
+        bool operator!=(const Handle& other) const { return Value != other.Value; }
+    };
+
+    // Generational slot map. Slots live in fixed-size chunks that never move, so
+    // Resolve() is an array index plus a generation check and needs no lock;
+    // writers serialize on a mutex. Freed slots are recycled first, which keeps
+    // the live range compact. Replaced or removed objects are retired rather than
+    // destroyed, so a pointer from Resolve() stays valid until the next Collect().
+    template<typename T>
+    class HandlePool
+    {
+    public:
+        HandlePool()
+        {
+            for (auto& chunk : m_Chunks)
+                chunk.store(nullptr, std::memory_order_relaxed);
+        }
+
+        ~HandlePool()
+        {
+            for (auto& chunk : m_Chunks)
+                delete[] chunk.load(std::memory_order_relaxed);
+        }
+
+        HandlePool(const HandlePool&) = delete;
+        HandlePool& operator=(const HandlePool&) = delete;
+
+        // Claims a slot before its object exists, e.g. for an async load
+        Handle<T> Allocate(AssetState state = AssetState::Queued)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            uint32_t index;
+            if (!m_FreeSlots.empty())
+            {
+                index = m_FreeSlots.back();
+                m_FreeSlots.pop_back();
+            }
+            else
+            {
+                AE_CORE_ASSERT(m_SlotCount <= Handle<T>::IndexMask, "HandlePool: Out of slots!");
+                index = m_SlotCount++;
+                if ((index & s_ChunkMask) == 0)
+                    m_Chunks[index >> s_ChunkBits].store(new Slot[s_ChunkSize], std::memory_order_release);
+            }
+
+            Slot& slot = GetSlot(index);
+            slot.Alive = true;
+            slot.State.store(state, std::memory_order_release);
+            return Handle<T>(index, slot.Generation.load(std::memory_order_relaxed));
+        }
+
+        Handle<T> Insert(const Ref<T>& item)
+        {
+            Handle<T> handle = Allocate(AssetState::Loading);
+            Publish(handle, item);
+            return handle;
+        }
+
+        // Stores the object behind a handle and marks it Ready; an existing one is retired
+        bool Publish(Handle<T> handle, const Ref<T>& item)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!IsAlive(handle))
+                return false;
+
+            Slot& slot = GetSlot(handle.GetIndex());
+            if (slot.Item)
+                m_Retired.push_back(slot.Item);
+
+            std::atomic_store_explicit(&slot.Item, item, std::memory_order_release);
+            slot.Raw.store(item.get(), std::memory_order_release);
+            slot.State.store(item ? AssetState::Ready : AssetState::Failed, std::memory_order_release);
+            return true;
+        }
+
+        bool Replace(Handle<T> handle, const Ref<T>& item) { return Publish(handle, item); }
+
+        bool SetState(Handle<T> handle, AssetState state)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!IsAlive(handle))
+                return false;
+
+            GetSlot(handle.GetIndex()).State.store(state, std::memory_order_release);
+            return true;
+        }
+
+        // Atomically moves a live slot from `expected` to `desired`; false if it was in another state
+        bool TransitionState(Handle<T> handle, AssetState expected, AssetState desired)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!IsAlive(handle))
+                return false;
+
+            Slot& slot = GetSlot(handle.GetIndex());
+            if (slot.State.load(std::memory_order_relaxed) != expected)
+                return false;
+
+            slot.State.store(desired, std::memory_order_release);
+            return true;
+        }
+
+        // Retires the object but keeps the slot (and every handle to it) alive in the Evicted state
+        bool Evict(Handle<T> handle)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!IsAlive(handle))
+                return false;
+
+            Slot& slot = GetSlot(handle.GetIndex());
+            if (!slot.Item)
+                return false;
+
+            m_Retired.push_back(slot.Item);
+            slot.Raw.store(nullptr, std::memory_order_release);
+            std::atomic_store_explicit(&slot.Item, Ref<T>(), std::memory_order_release);
+            slot.State.store(AssetState::Evicted, std::memory_order_release);
+            return true;
+        }
+
+        bool Remove(Handle<T> handle)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!IsAlive(handle))
+                return false;
+
+            Release(GetSlot(handle.GetIndex()));
+            m_FreeSlots.push_back(handle.GetIndex());
+            return true;
+        }
+
+        // Lock-free. Borrowed pointer, valid until the next Collect()
+        T* Resolve(Handle<T> handle) const
+        {
+            const Slot* slot = FindSlot(handle);
+            if (!slot)
+                return nullptr;
+
+            T* item = slot->Raw.load(std::memory_order_acquire);
+            // The slot may have been recycled between the two loads
+            if (slot->Generation.load(std::memory_order_acquire) != handle.GetGeneration())
+                return nullptr;
+            return item;
+        }
+
+        // Owning reference, safe to keep across frames and threads
+        Ref<T> Get(Handle<T> handle) const
+        {
+            const Slot* slot = FindSlot(handle);
+            if (!slot)
+                return nullptr;
+
+            Ref<T> item = std::atomic_load_explicit(&slot->Item, std::memory_order_acquire);
+            if (slot->Generation.load(std::memory_order_acquire) != handle.GetGeneration())
+                return nullptr;
+            return item;
+        }
+
+        AssetState GetState(Handle<T> handle) const
+        {
+            const Slot* slot = FindSlot(handle);
+            if (!slot)
+                return AssetState::None;
+
+            AssetState state = slot->State.load(std::memory_order_acquire);
+            if (slot->Generation.load(std::memory_order_acquire) != handle.GetGeneration())
+                return AssetState::None;
+            return state;
+        }
+
+        bool IsValid(Handle<T> handle) const { return Resolve(handle) != nullptr; }
+
+        // Lock-free frame stamp for LRU eviction
+        void Touch(Handle<T> handle, uint32_t frame) const
+        {
+            if (const Slot* slot = FindSlot(handle))
+                slot->LastUsed.store(frame, std::memory_order_relaxed);
+        }
+
+        uint32_t GetLastUsed(Handle<T> handle) const
+        {
+            const Slot* slot = FindSlot(handle);
+            return slot ? slot->LastUsed.load(std::memory_order_relaxed) : 0;
+        }
+
+        // Hands over everything retired since the last call; the caller picks where it is destroyed.
+        // Call at a point where no borrowed pointers are in flight (frame start on the main thread).
+        void Collect(std::vector<Ref<void>>& retired)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            retired.insert(retired.end(), m_Retired.begin(), m_Retired.end());
+            m_Retired.clear();
+        }
+
+        // Invalidates every outstanding handle without reusing their generations
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_FreeSlots.clear();
+            for (uint32_t i = m_SlotCount; i-- > 0;)
+            {
+                Slot& slot = GetSlot(i);
+                if (slot.Alive)
+                    Release(slot);
+                m_FreeSlots.push_back(i);
+            }
+        }
+
+        // Visits every live object under the writer lock; the callback must not write to the pool
+        template<typename Func>
+        void ForEach(Func&& func) const
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (uint32_t i = 0; i < m_SlotCount; i++)
+            {
+                const Slot& slot = GetSlot(i);
+                if (slot.Alive && slot.Item)
+                    func(*slot.Item);
+            }
+        }
+
+        size_t Size() const
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_SlotCount - m_FreeSlots.size();
+        }
+
+    private:
+        static constexpr uint32_t s_ChunkBits = 10;
+        static constexpr uint32_t s_ChunkSize = 1u << s_ChunkBits;
+        static constexpr uint32_t s_ChunkMask = s_ChunkSize - 1;
+        static constexpr uint32_t s_ChunkCount = (Handle<T>::IndexMask + 1) / s_ChunkSize;
+
+        struct Slot
+        {
+            std::atomic<uint32_t> Generation{ 1 };
+            std::atomic<T*> Raw{ nullptr };
+            std::atomic<AssetState> State{ AssetState::None };
+            mutable std::atomic<uint32_t> LastUsed{ 0 };
+            Ref<T> Item;
+            bool Alive = false;
+        };
+
+        Slot& GetSlot(uint32_t index) const
+        {
+            return m_Chunks[index >> s_ChunkBits].load(std::memory_order_acquire)[index & s_ChunkMask];
+        }
+
+        const Slot* FindSlot(Handle<T> handle) const
+        {
+            uint32_t index = handle.GetIndex();
+            const Slot* chunk = m_Chunks[index >> s_ChunkBits].load(std::memory_order_acquire);
+            if (!chunk)
+                return nullptr;
+
+            const Slot& slot = chunk[index & s_ChunkMask];
+            return slot.Generation.load(std::memory_order_acquire) == handle.GetGeneration() ? &slot : nullptr;
+        }
+
+        // Caller holds m_Mutex
+        bool IsAlive(Handle<T> handle) const
+        {
+            return handle.GetIndex() < m_SlotCount
+                && GetSlot(handle.GetIndex()).Alive
+                && GetSlot(handle.GetIndex()).Generation.load(std::memory_order_relaxed) == handle.GetGeneration();
+        }
+
+        // Caller holds m_Mutex
+        void Release(Slot& slot)
+        {
+            if (slot.Item)
+                m_Retired.push_back(slot.Item);
+
+            slot.Raw.store(nullptr, std::memory_order_release);
+            std::atomic_store_explicit(&slot.Item, Ref<T>(), std::memory_order_release);
+            slot.State.store(AssetState::None, std::memory_order_release);
+            slot.Alive = false;
+
+            uint32_t generation = (slot.Generation.load(std::memory_order_relaxed) + 1) & Handle<T>::GenerationMask;
+            slot.Generation.store(generation ? generation : 1, std::memory_order_release);
+        }
+
+        std::array<std::atomic<Slot*>, s_ChunkCount> m_Chunks;
+        uint32_t m_SlotCount = 0;
+        std::vector<uint32_t> m_FreeSlots;
+        std::vector<Ref<T>> m_Retired;
+        mutable std::mutex m_Mutex;
+    };
+}
+
+namespace std {
+    template<typename T>
+    struct hash<Aether::Handle<T>>
+    {
+        std::size_t operator()(const Aether::Handle<T>& handle) const
+        {
+            return handle.Value;
+        }
+    };
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace Aether {
+
+    // constexpr XXH64, bit-compatible with the reference implementation, so IDs
+    // hashed at compile time match the ones produced at runtime and by offline tools.
+    namespace Hash {
+
+        namespace Detail {
+            constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ull;
+            constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4Full;
+            constexpr uint64_t Prime3 = 0x165667B19E3779F9ull;
+            constexpr uint64_t Prime4 = 0x85EBCA77C2B2AE63ull;
+            constexpr uint64_t Prime5 = 0x27D4EB2F165667C5ull;
+
+            constexpr uint64_t Rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+            // Byte-wise little-endian reads keep this usable in constant expressions
+            constexpr uint64_t Read64(const char* p)
+            {
+                uint64_t value = 0;
+                for (int i = 0; i < 8; i++)
+                    value |= (uint64_t)(uint8_t)p[i] << (8 * i);
+                return value;
+            }
+
+            constexpr uint32_t Read32(const char* p)
+            {
+                uint32_t value = 0;
+                for (int i = 0; i < 4; i++)
+                    value |= (uint32_t)(uint8_t)p[i] << (8 * i);
+                return value;
+            }
+
+            constexpr uint64_t Round(uint64_t acc, uint64_t input)
+            {
+                acc += input * Prime2;
+                acc = Rotl(acc, 31);
+                return acc * Prime1;
+            }
+
+            constexpr uint64_t MergeRound(uint64_t acc, uint64_t value)
+            {
+                acc ^= Round(0, value);
+                return acc * Prime1 + Prime4;
+            }
+        }
+
+        constexpr uint64_t XXH64(const char* data, size_t length, uint64_t seed = 0)
+        {
+            using namespace Detail;
+
+            const char* p = data;
+            const char* end = data + length;
+            uint64_t hash = 0;
+
+            if (length >= 32)
+            {
+                uint64_t v1 = seed + Prime1 + Prime2;
+                uint64_t v2 = seed + Prime2;
+                uint64_t v3 = seed;
+                uint64_t v4 = seed - Prime1;
+
+                const char* limit = end - 32;
+                do
+                {
+                    v1 = Round(v1, Read64(p)); p += 8;
+                    v2 = Round(v2, Read64(p)); p += 8;
+                    v3 = Round(v3, Read64(p)); p += 8;
+                    v4 = Round(v4, Read64(p)); p += 8;
+                } while (p <= limit);
+
+                hash = Rotl(v1, 1) + Rotl(v2, 7) + Rotl(v3, 12) + Rotl(v4, 18);
+                hash = MergeRound(hash, v1);
+                hash = MergeRound(hash, v2);
+                hash = MergeRound(hash, v3);
+                hash = MergeRound(hash, v4);
+            }
+            else
+            {
+                hash = seed + Prime5;
+            }
+
+            hash += (uint64_t)length;
+
+            while (end - p >= 8)
+            {
+                hash ^= Round(0, Read64(p));
+                hash = Rotl(hash, 27) * Prime1 + Prime4;
+                p += 8;
+            }
+
+            if (end - p >= 4)
+            {
+                hash ^= (uint64_t)Read32(p) * Prime1;
+                hash = Rotl(hash, 23) * Prime2 + Prime3;
+                p += 4;
+            }
+
+            while (p < end)
+            {
+                hash ^= (uint64_t)(uint8_t)*p * Prime5;
+                hash = Rotl(hash, 11) * Prime1;
+                p++;
+            }
+
+            hash ^= hash >> 33;
+            hash *= Prime2;
+            hash ^= hash >> 29;
+            hash *= Prime3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+
+        constexpr uint64_t XXH64(std::string_view str, uint64_t seed = 0)
+        {
+            return XXH64(str.data(), str.size(), seed);
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #include "JobSystem.h"
 #include "Aether/Core/Base.h"
 
+#include <atomic>
+
 namespace Aether {
 
     std::vector<std::thread> JobSystem::s_Workers;
@@ -44,6 +46,49 @@ namespace Aether {
         s_Condition.notify_one();
     }
 
+    void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& func)
+    {
+        batchSize = std::max(batchSize, 1u);
+        uint32_t batches = (count + batchSize - 1) / batchSize;
+        if (batches <= 1 || s_Workers.empty())
+        {
+            // Still batch by batch, since callers may keep per-batch state indexed by begin / batchSize
+            for (uint32_t batch = 0; batch < batches; batch++)
+            {
+                uint32_t begin = batch * batchSize;
+                func(begin, std::min(begin + batchSize, count));
+            }
+            return;
+        }
+
+        struct Batches
+        {
+            std::atomic<uint32_t> Next{ 0 };
+            std::atomic<uint32_t> Done{ 0 };
+        };
+        auto state = std::make_shared<Batches>();
+
+        // A helper that starts late finds nothing left to claim, so it never touches `func` after we return
+        auto run = [state, &func, count, batchSize, batches]()
+        {
+            uint32_t batch;
+            while ((batch = state->Next.fetch_add(1, std::memory_order_relaxed)) < batches)
+            {
+                uint32_t begin = batch * batchSize;
+                func(begin, std::min(begin + batchSize, count));
+                state->Done.fetch_add(1, std::memory_order_release);
+            }
+        };
+
+        uint32_t helpers = std::min((uint32_t)s_Workers.size(), batches - 1);
+        for (uint32_t i = 0; i < helpers; i++)
+            SubmitJob(run);
+
+        run();
+        while (state->Done.load(std::memory_order_acquire) < batches)
+            std::this_thread::yield();
+    }
+
     void JobSystem::WorkerThread()
     {
         while (true)
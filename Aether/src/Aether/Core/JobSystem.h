@@ -17,6 +17,11 @@ namespace Aether {
         static void Shutdown();
         
         static void SubmitJob(Job job);
+
+        // Runs func(begin, end) over [0, count) in batches of `batchSize` and returns once every
+        // batch is done. The calling thread takes batches too, so this is safe from inside a job.
+        static void ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& func);
+        static uint32_t GetWorkerCount() { return (uint32_t)s_Workers.size(); }
         
     private:
         static void WorkerThread();
@@ -19,8 +19,12 @@ namespace Aether {
 		virtual void OnEvent(Event& event) {}
 
 		const std::string& GetName() const { return m_DebugName; }
+		bool IsRenderThreadSafe() const { return m_RenderThreadSafe; }
 	protected:
 		std::string m_DebugName;
+		// Set once every GPU call the layer makes goes through Renderer::Submit.
+		// ThreadingPolicy::MultiThreaded is refused while any layer leaves it unset.
+		bool m_RenderThreadSafe = false;
 	};
 
 }
\ No newline at end of file
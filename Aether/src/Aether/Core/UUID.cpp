@@ -6,19 +6,14 @@
 
 namespace Aether {
 
-	static std::random_device s_RandomDevice;
-	static std::mt19937_64 s_Engine(s_RandomDevice());
-	static std::uniform_int_distribution<uint64_t> s_UniformDistribution;
+	// Per-thread engines so IDs can be generated from JobSystem workers
+	static thread_local std::mt19937_64 s_Engine(std::random_device{}());
+	static thread_local std::uniform_int_distribution<uint64_t> s_UniformDistribution;
 
 	UUID::UUID()
 		: m_UUID(s_UniformDistribution(s_Engine))
 	{
 	}
-
-	UUID::UUID(uint64_t uuid)
-		: m_UUID(uuid)
-	{
-	}
 }
 
 
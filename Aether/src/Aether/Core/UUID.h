@@ -7,10 +7,10 @@ namespace Aether {
 	{
 	public:
 		UUID();
-		UUID(uint64_t uuid);
-		UUID(const UUID&) = default;
+		constexpr UUID(uint64_t uuid) : m_UUID(uuid) {}
+		constexpr UUID(const UUID&) = default;
 
-		operator uint64_t() const { return m_UUID; }
+		constexpr operator uint64_t() const { return m_UUID; }
 	private:
 		uint64_t m_UUID;
 	};
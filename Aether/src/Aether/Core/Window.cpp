@@ -1,11 +1,17 @@
 #include "aepch.h"
 #include "Aether/Core/Window.h"
 
+#include "Aether/Renderer/RendererAPI.h"
 #include "Platform/GLFW/GLFW_Window.h"
+#include "Platform/Null/NullWindow.h"
 
 namespace Aether {
     Scope<Window> Window::Create(const WinProps& props)
 	{
+		// The headless backend has no context to put in a window
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+			return CreateScope<NullWindow>(props);
+
 	    return CreateScope<GLFW_Window>(props);
 	}
 }
\ No newline at end of file
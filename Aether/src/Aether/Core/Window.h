@@ -2,6 +2,7 @@
 
 #include "Aether/Core/Base.h"
 #include "Aether/Events/Event.h"
+#include "Aether/Renderer/GraphicsContext.h"
 
 #include <sstream>
 
@@ -38,6 +39,8 @@ namespace Aether {
         virtual bool IsVSync() const = 0;
 
         virtual void* GetWindow() const = 0;
+        // Null for windows without a graphics context
+        virtual GraphicsContext* GetContext() const { return nullptr; }
 
         static Scope<Window> Create(const WinProps& props = WinProps());
     };
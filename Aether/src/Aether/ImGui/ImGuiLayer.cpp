@@ -1,15 +1,41 @@
 #include "ImGuiLayer.h"
 
 #include "Aether/Core/Application.h"
+#include "Aether/Renderer/Renderer.h"
+#include "Aether/Utils/PlatformUtils.h"
 
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
 
 namespace Aether {
 
+    namespace Utils {
+
+        // ImGui reuses its draw lists next frame, so the render thread replays a deep copy
+        struct ImGuiDrawDataCopy
+        {
+            ImDrawData Data;
+
+            ImGuiDrawDataCopy(const ImDrawData& source)
+                : Data(source)
+            {
+                Data.CmdLists.clear();
+                for (ImDrawList* list : source.CmdLists)
+                    Data.CmdLists.push_back(list->CloneOutput());
+            }
+
+            ~ImGuiDrawDataCopy()
+            {
+                for (ImDrawList* list : Data.CmdLists)
+                    IM_DELETE(list);
+            }
+        };
+    }
+
     ImGuiLayer::ImGuiLayer()
         : Layer("ImGuiLayer")
     {
+        m_RenderThreadSafe = true;
     }
 
     ImGuiLayer::~ImGuiLayer()
@@ -53,6 +79,13 @@ namespace Aether {
             style.Colors[ImGuiCol_WindowBg].w = 1.0f;
         }
 
+        // Headless: no platform or renderer backend, so only the CPU side of ImGui runs
+        if (Renderer::GetAPI() == RendererAPI::API::Null)
+        {
+            io.Fonts->Build();
+            return;
+        }
+
         // Setup Platform/Renderer backends
         Application& app = Application::Get();
         GLFWwindow* window = static_cast<GLFWwindow*>(app.GetWindow().GetWindow());
@@ -70,6 +103,12 @@ namespace Aether {
 
     void ImGuiLayer::Detach()
     {
+        if (Renderer::GetAPI() == RendererAPI::API::Null)
+        {
+            ImGui::DestroyContext();
+            return;
+        }
+
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
         ImGui::DestroyContext();
@@ -84,8 +123,23 @@ namespace Aether {
 
     void ImGuiLayer::Begin()
     {
+        if (Renderer::GetAPI() == RendererAPI::API::Null)
+        {
+            ImGuiIO& io = ImGui::GetIO();
+            Window& window = Application::Get().GetWindow();
+            io.DisplaySize = ImVec2((float)window.GetWidth(), (float)window.GetHeight());
+
+            float time = Time::GetTime();
+            io.DeltaTime = time > m_Time ? time - m_Time : 1.0f / 60.0f;
+            m_Time = time;
+
+            ImGui::NewFrame();
+            return;
+        }
+
         ImGui_ImplGlfw_NewFrame();
-        ImGui_ImplOpenGL3_NewFrame();
+        // Creates the backend's GL objects on first use
+        Renderer::Submit([]() { ImGui_ImplOpenGL3_NewFrame(); });
         ImGui::NewFrame();
     }
 
@@ -96,14 +150,26 @@ namespace Aether {
         io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
 
         ImGui::Render();
+        if (Renderer::GetAPI() == RendererAPI::API::Null)
+            return;
         
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        if (RenderThread::IsMultiThreaded())
+        {
+            // Platform windows need their contexts on the main thread, so they stay off in this mode
+            auto drawData = CreateRef<Utils::ImGuiDrawDataCopy>(*ImGui::GetDrawData());
+            Renderer::Submit([drawData]() { ImGui_ImplOpenGL3_RenderDrawData(&drawData->Data); });
+            return;
+        }
 
+        // The draw data stays valid until the next NewFrame, which comes after this frame's replay
+        Renderer::Submit([]()
         {
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
             GLFWwindow* backup_current_context = glfwGetCurrentContext();
             ImGui::UpdatePlatformWindows();
             ImGui::RenderPlatformWindowsDefault();
             glfwMakeContextCurrent(backup_current_context);
-        }
+        });
     }
 }
\ No newline at end of file
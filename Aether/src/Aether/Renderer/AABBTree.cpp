@@ -0,0 +1,433 @@
+#include "aepch.h"
+#include "Aether/Renderer/AABBTree.h"
+#include "Aether/Core/JobSystem.h"
+
+namespace Aether {
+
+    // SAH bins per split
+    static constexpr uint32_t s_BuildBins = 16;
+    // Ranges larger than this build their two halves as separate jobs
+    static constexpr uint32_t s_ParallelBuildThreshold = 16384;
+
+    int32_t AABBTree::AllocateNode()
+    {
+        int32_t node;
+        if (m_FreeList != NullNode)
+        {
+            node = m_FreeList;
+            m_FreeList = m_Nodes[node].Parent;
+        }
+        else
+        {
+            node = (int32_t)m_Nodes.size();
+            m_Nodes.emplace_back();
+        }
+
+        m_Nodes[node] = Node();
+        m_Nodes[node].Height = 0;
+        return node;
+    }
+
+    void AABBTree::FreeNode(int32_t node)
+    {
+        m_Nodes[node].Parent = m_FreeList;
+        m_Nodes[node].Height = -1;
+        m_FreeList = node;
+    }
+
+    int32_t AABBTree::CreateProxy(const AABB& box, uint32_t userData)
+    {
+        int32_t proxy = AllocateNode();
+        m_Nodes[proxy].Box = box;
+        m_Nodes[proxy].UserData = userData;
+        InsertLeaf(proxy);
+        m_ProxyCount++;
+        return proxy;
+    }
+
+    void AABBTree::DestroyProxy(int32_t proxy)
+    {
+        AE_CORE_ASSERT(m_Nodes[proxy].IsLeaf() && m_Nodes[proxy].Height == 0, "Not an AABB tree proxy!");
+        RemoveLeaf(proxy);
+        FreeNode(proxy);
+        m_ProxyCount--;
+    }
+
+    void AABBTree::MoveProxy(int32_t proxy, const AABB& box)
+    {
+        AE_CORE_ASSERT(m_Nodes[proxy].IsLeaf() && m_Nodes[proxy].Height == 0, "Not an AABB tree proxy!");
+        m_Nodes[proxy].Box = box;
+
+        // Still inside its parent: nothing above changes shape, so refitting is enough. Otherwise
+        // reinserting finds a better place than stretching every ancestor would.
+        int32_t parent = m_Nodes[proxy].Parent;
+        if (parent == NullNode || m_Nodes[parent].Box.Contains(box))
+        {
+            RefitAncestors(parent);
+            return;
+        }
+
+        RemoveLeaf(proxy);
+        InsertLeaf(proxy);
+    }
+
+    void AABBTree::Clear()
+    {
+        m_Nodes.clear();
+        m_Root = NullNode;
+        m_FreeList = NullNode;
+        m_ProxyCount = 0;
+    }
+
+    void AABBTree::InsertLeaf(int32_t leaf)
+    {
+        if (m_Root == NullNode)
+        {
+            m_Root = leaf;
+            m_Nodes[leaf].Parent = NullNode;
+            return;
+        }
+
+        // Walk down towards the sibling that adds the least area: a new parent here costs its own
+        // area, going deeper costs the growth of this node plus whatever the child adds
+        AABB leafBox = m_Nodes[leaf].Box;
+        int32_t index = m_Root;
+        while (!m_Nodes[index].IsLeaf())
+        {
+            const Node& node = m_Nodes[index];
+            float area = node.Box.SurfaceArea();
+            float combinedArea = AABB::Union(node.Box, leafBox).SurfaceArea();
+
+            float cost = 2.0f * combinedArea;
+            float inheritance = 2.0f * (combinedArea - area);
+
+            auto descendCost = [&](int32_t child)
+            {
+                float childArea = AABB::Union(leafBox, m_Nodes[child].Box).SurfaceArea();
+                if (!m_Nodes[child].IsLeaf())
+                    childArea -= m_Nodes[child].Box.SurfaceArea();
+                return childArea + inheritance;
+            };
+            float cost1 = descendCost(node.Child1);
+            float cost2 = descendCost(node.Child2);
+
+            if (cost < cost1 && cost < cost2)
+                break;
+            index = cost1 < cost2 ? node.Child1 : node.Child2;
+        }
+
+        int32_t sibling = index;
+        int32_t oldParent = m_Nodes[sibling].Parent;
+        int32_t newParent = AllocateNode();
+        m_Nodes[newParent].Parent = oldParent;
+        m_Nodes[newParent].Box = AABB::Union(leafBox, m_Nodes[sibling].Box);
+        m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+        m_Nodes[newParent].Child1 = sibling;
+        m_Nodes[newParent].Child2 = leaf;
+        m_Nodes[sibling].Parent = newParent;
+        m_Nodes[leaf].Parent = newParent;
+
+        if (oldParent == NullNode)
+            m_Root = newParent;
+        else if (m_Nodes[oldParent].Child1 == sibling)
+            m_Nodes[oldParent].Child1 = newParent;
+        else
+            m_Nodes[oldParent].Child2 = newParent;
+
+        RefitAncestors(oldParent);
+    }
+
+    void AABBTree::RemoveLeaf(int32_t leaf)
+    {
+        if (leaf == m_Root)
+        {
+            m_Root = NullNode;
+            return;
+        }
+
+        int32_t parent = m_Nodes[leaf].Parent;
+        int32_t grandParent = m_Nodes[parent].Parent;
+        int32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+        if (grandParent == NullNode)
+        {
+            m_Root = sibling;
+            m_Nodes[sibling].Parent = NullNode;
+        }
+        else
+        {
+            if (m_Nodes[grandParent].Child1 == parent)
+                m_Nodes[grandParent].Child1 = sibling;
+            else
+                m_Nodes[grandParent].Child2 = sibling;
+            m_Nodes[sibling].Parent = grandParent;
+        }
+
+        FreeNode(parent);
+        RefitAncestors(grandParent);
+    }
+
+    void AABBTree::RefitAncestors(int32_t node)
+    {
+        while (node != NullNode)
+        {
+            Node& n = m_Nodes[node];
+            n.Box = AABB::Union(m_Nodes[n.Child1].Box, m_Nodes[n.Child2].Box);
+            n.Height = 1 + std::max(m_Nodes[n.Child1].Height, m_Nodes[n.Child2].Height);
+            Rotate(node);
+            node = n.Parent;
+        }
+    }
+
+    void AABBTree::Rotate(int32_t a)
+    {
+        //        a
+        //    +---+---+
+        //    b       c
+        //  +-+-+   +-+-+
+        //  d   e   f   g
+        // Swapping a child of `a` with a grandchild on the other side keeps `a`'s box and only changes
+        // the box of the side that was rotated into, so the best swap is the one that shrinks it most
+        int32_t b = m_Nodes[a].Child1;
+        int32_t c = m_Nodes[a].Child2;
+
+        enum class Rotation { None, BF, BG, CD, CE };
+        Rotation best = Rotation::None;
+        float bestDelta = 0.0f;
+
+        if (!m_Nodes[c].IsLeaf())
+        {
+            int32_t f = m_Nodes[c].Child1, g = m_Nodes[c].Child2;
+            float area = m_Nodes[c].Box.SurfaceArea();
+            float deltaBF = AABB::Union(m_Nodes[b].Box, m_Nodes[g].Box).SurfaceArea() - area;
+            float deltaBG = AABB::Union(m_Nodes[b].Box, m_Nodes[f].Box).SurfaceArea() - area;
+            if (deltaBF < bestDelta) { best = Rotation::BF; bestDelta = deltaBF; }
+            if (deltaBG < bestDelta) { best = Rotation::BG; bestDelta = deltaBG; }
+        }
+        if (!m_Nodes[b].IsLeaf())
+        {
+            int32_t d = m_Nodes[b].Child1, e = m_Nodes[b].Child2;
+            float area = m_Nodes[b].Box.SurfaceArea();
+            float deltaCD = AABB::Union(m_Nodes[c].Box, m_Nodes[e].Box).SurfaceArea() - area;
+            float deltaCE = AABB::Union(m_Nodes[c].Box, m_Nodes[d].Box).SurfaceArea() - area;
+            if (deltaCD < bestDelta) { best = Rotation::CD; bestDelta = deltaCD; }
+            if (deltaCE < bestDelta) { best = Rotation::CE; bestDelta = deltaCE; }
+        }
+
+        if (best == Rotation::None)
+            return;
+
+        // `child` of `a` trades places with `grandChild`, whose parent is `side`
+        auto swap = [&](int32_t child, int32_t side, int32_t grandChild)
+        {
+            Node& nodeA = m_Nodes[a];
+            Node& nodeSide = m_Nodes[side];
+            if (nodeA.Child1 == child) nodeA.Child1 = grandChild; else nodeA.Child2 = grandChild;
+            if (nodeSide.Child1 == grandChild) nodeSide.Child1 = child; else nodeSide.Child2 = child;
+            m_Nodes[grandChild].Parent = a;
+            m_Nodes[child].Parent = side;
+
+            nodeSide.Box = AABB::Union(m_Nodes[nodeSide.Child1].Box, m_Nodes[nodeSide.Child2].Box);
+            nodeSide.Height = 1 + std::max(m_Nodes[nodeSide.Child1].Height, m_Nodes[nodeSide.Child2].Height);
+            nodeA.Height = 1 + std::max(m_Nodes[nodeA.Child1].Height, m_Nodes[nodeA.Child2].Height);
+        };
+
+        switch (best)
+        {
+            case Rotation::BF: swap(b, c, m_Nodes[c].Child1); break;
+            case Rotation::BG: swap(b, c, m_Nodes[c].Child2); break;
+            case Rotation::CD: swap(c, b, m_Nodes[b].Child1); break;
+            case Rotation::CE: swap(c, b, m_Nodes[b].Child2); break;
+            default: break;
+        }
+    }
+
+    void AABBTree::Refit()
+    {
+        if (m_Root == NullNode)
+            return;
+
+        // Post-order: a node is refit once both children are, so each is pushed a second time
+        // with its high bit set before its children go on top
+        constexpr uint32_t visited = 0x80000000u;
+        std::vector<uint32_t> stack;
+        stack.reserve(s_StackSize);
+        stack.push_back((uint32_t)m_Root);
+
+        while (!stack.empty())
+        {
+            uint32_t entry = stack.back();
+            stack.pop_back();
+            int32_t index = (int32_t)(entry & ~visited);
+            Node& node = m_Nodes[index];
+            if (node.IsLeaf())
+                continue;
+
+            if (entry & visited)
+            {
+                node.Box = AABB::Union(m_Nodes[node.Child1].Box, m_Nodes[node.Child2].Box);
+                node.Height = 1 + std::max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+                Rotate(index);
+                continue;
+            }
+
+            stack.push_back(entry | visited);
+            stack.push_back((uint32_t)node.Child1);
+            stack.push_back((uint32_t)node.Child2);
+        }
+    }
+
+    void AABBTree::Build(const std::vector<AABB>& boxes, std::vector<int32_t>& proxies)
+    {
+        Clear();
+        proxies.assign(boxes.size(), NullNode);
+        if (boxes.empty())
+            return;
+
+        uint32_t count = (uint32_t)boxes.size();
+        std::vector<BuildItem> items(count);
+        for (uint32_t i = 0; i < count; i++)
+            items[i] = { boxes[i], (boxes[i].Min + boxes[i].Max) * 0.5f, i };
+
+        // A range of n objects takes exactly 2n - 1 nodes, so each subtree gets its own slice of the
+        // array up front and the halves can be built in parallel without sharing an allocator
+        m_Nodes.resize(2 * (size_t)count - 1);
+        m_Root = 0;
+        m_ProxyCount = count;
+        BuildRange(0, NullNode, items.data(), count, proxies);
+    }
+
+    void AABBTree::BuildRange(int32_t index, int32_t parent, BuildItem* items, uint32_t count, std::vector<int32_t>& proxies)
+    {
+        Node& node = m_Nodes[index];
+        node.Parent = parent;
+
+        if (count == 1)
+        {
+            node.Box = items[0].Box;
+            node.UserData = items[0].Object;
+            node.Child1 = node.Child2 = NullNode;
+            node.Height = 0;
+            proxies[items[0].Object] = index;
+            return;
+        }
+
+        AABB centroidBounds;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            centroidBounds.Min = glm::min(centroidBounds.Min, items[i].Centroid);
+            centroidBounds.Max = glm::max(centroidBounds.Max, items[i].Centroid);
+        }
+
+        glm::vec3 extent = centroidBounds.Max - centroidBounds.Min;
+        int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+
+        uint32_t mid = count / 2;
+        if (extent[axis] > 0.0f && count > s_BuildBins)
+        {
+            struct Bin
+            {
+                AABB Box;
+                uint32_t Count = 0;
+            };
+            std::array<Bin, s_BuildBins> bins;
+
+            float scale = (float)s_BuildBins / extent[axis];
+            auto binOf = [&](const BuildItem& item)
+            {
+                return std::min((uint32_t)((item.Centroid[axis] - centroidBounds.Min[axis]) * scale), s_BuildBins - 1);
+            };
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                Bin& bin = bins[binOf(items[i])];
+                bin.Box = AABB::Union(bin.Box, items[i].Box);
+                bin.Count++;
+            }
+
+            // Sweep from the right for suffix areas, then from the left to price each split
+            std::array<float, s_BuildBins> rightCost;
+            AABB rightBox;
+            uint32_t rightCount = 0;
+            for (uint32_t i = s_BuildBins - 1; i > 0; i--)
+            {
+                rightBox = AABB::Union(rightBox, bins[i].Box);
+                rightCount += bins[i].Count;
+                rightCost[i] = rightCount ? rightBox.SurfaceArea() * rightCount : 0.0f;
+            }
+
+            AABB leftBox;
+            uint32_t leftCount = 0;
+            float bestCost = FLT_MAX;
+            uint32_t bestSplit = 0;
+            for (uint32_t i = 0; i + 1 < s_BuildBins; i++)
+            {
+                leftBox = AABB::Union(leftBox, bins[i].Box);
+                leftCount += bins[i].Count;
+                if (leftCount == 0 || leftCount == count)
+                    continue;
+
+                float cost = leftBox.SurfaceArea() * leftCount + rightCost[i + 1];
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestSplit = i;
+                }
+            }
+
+            if (bestCost < FLT_MAX)
+                mid = (uint32_t)(std::partition(items, items + count, [&](const BuildItem& item) { return binOf(item) <= bestSplit; }) - items);
+        }
+
+        // Small ranges, or every centroid in one spot or one bin: split by count
+        if (mid == 0 || mid == count || extent[axis] <= 0.0f || count <= s_BuildBins)
+        {
+            mid = count / 2;
+            std::nth_element(items, items + mid, items + count,
+                [axis](const BuildItem& a, const BuildItem& b) { return a.Centroid[axis] < b.Centroid[axis]; });
+        }
+
+        int32_t left = index + 1;
+        int32_t right = index + 2 * (int32_t)mid;
+        node.Child1 = left;
+        node.Child2 = right;
+
+        if (count > s_ParallelBuildThreshold)
+        {
+            JobSystem::ParallelFor(2, 1, [&](uint32_t first, uint32_t last)
+            {
+                for (uint32_t half = first; half < last; half++)
+                {
+                    if (half == 0)
+                        BuildRange(left, index, items, mid, proxies);
+                    else
+                        BuildRange(right, index, items + mid, count - mid, proxies);
+                }
+            });
+        }
+        else
+        {
+            BuildRange(left, index, items, mid, proxies);
+            BuildRange(right, index, items + mid, count - mid, proxies);
+        }
+
+        Node& built = m_Nodes[index];
+        built.Box = AABB::Union(m_Nodes[left].Box, m_Nodes[right].Box);
+        built.Height = 1 + std::max(m_Nodes[left].Height, m_Nodes[right].Height);
+    }
+
+    float AABBTree::GetAreaRatio() const
+    {
+        if (m_Root == NullNode)
+            return 0.0f;
+
+        float total = 0.0f;
+        for (const Node& node : m_Nodes)
+        {
+            if (node.Height > 0)
+                total += node.Box.SurfaceArea();
+        }
+        float rootArea = m_Nodes[m_Root].Box.SurfaceArea();
+        return rootArea > 0.0f ? total / rootArea : 0.0f;
+    }
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Renderer/FrustumCuller.h"
+#include "Aether/Renderer/Bounds.h"
+
+namespace Aether {
+
+    struct RayHit
+    {
+        uint32_t UserData = 0;
+        float Distance = 0.0f;
+    };
+
+    // Dynamic bounding volume hierarchy with one object per leaf. Proxies can be inserted, moved
+    // and removed one at a time (cost-guided insertion, ancestors refit on the way up), built in
+    // bulk with a binned SAH split, or have their bounds changed en masse followed by one Refit().
+    // Every refit tries tree rotations, swapping a child with a grandchild when that shrinks the
+    // surface area, so the tree keeps its quality as objects move. Not thread-safe; queries are
+    // read-only and may run concurrently with each other.
+    class AETHER_API AABBTree
+    {
+    public:
+        static constexpr int32_t NullNode = -1;
+
+        int32_t CreateProxy(const AABB& box, uint32_t userData);
+        void DestroyProxy(int32_t proxy);
+
+        // Updates one leaf, refitting its ancestors or reinserting it if it left its parent
+        void MoveProxy(int32_t proxy, const AABB& box);
+        // Updates one leaf without touching the rest of the tree; call Refit() once after a batch
+        void SetProxyBounds(int32_t proxy, const AABB& box) { m_Nodes[proxy].Box = box; }
+        void Refit();
+
+        // Replaces the tree; `proxies[i]` receives the proxy of boxes[i], whose user data is i
+        void Build(const std::vector<AABB>& boxes, std::vector<int32_t>& proxies);
+        void Clear();
+
+        const AABB& GetProxyBounds(int32_t proxy) const { return m_Nodes[proxy].Box; }
+        uint32_t GetUserData(int32_t proxy) const { return m_Nodes[proxy].UserData; }
+        uint32_t GetProxyCount() const { return m_ProxyCount; }
+        int32_t GetHeight() const { return m_Root == NullNode ? 0 : m_Nodes[m_Root].Height; }
+        // Sum of internal node areas over the root's; lower is a better tree
+        float GetAreaRatio() const;
+
+        // func(userData) for every leaf inside or touching the frustum
+        template<typename Fn>
+        void QueryFrustum(const Frustum& frustum, Fn&& func) const;
+        // func(userData) for every leaf whose box overlaps
+        template<typename Fn>
+        void QueryOverlap(const AABB& box, Fn&& func) const;
+        template<typename Fn>
+        void QuerySphere(const glm::vec3& center, float radius, Fn&& func) const;
+
+        // Nearest hit. `intersect(userData, maxDistance)` tests the object itself and returns its hit
+        // distance, or a negative value for a miss; leaves are visited nearest box first and anything
+        // farther than the closest hit so far is skipped
+        template<typename Fn>
+        bool RayCast(const Ray& ray, float maxDistance, Fn&& intersect, RayHit& hit) const;
+        // Nearest hit against the leaf boxes themselves
+        bool RayCast(const Ray& ray, float maxDistance, RayHit& hit) const
+        {
+            return RayCast(ray, maxDistance, [](uint32_t, float) { return 0.0f; }, hit);
+        }
+    private:
+        struct Node
+        {
+            AABB Box;
+            // Next free node while on the free list
+            int32_t Parent = NullNode;
+            int32_t Child1 = NullNode;
+            int32_t Child2 = NullNode;
+            // 0 for leaves, -1 while free
+            int32_t Height = -1;
+            uint32_t UserData = 0;
+
+            bool IsLeaf() const { return Child1 == NullNode; }
+        };
+
+        // Depth-first traversals keep at most one pending sibling per level
+        static constexpr uint32_t s_StackSize = 1024;
+
+        int32_t AllocateNode();
+        void FreeNode(int32_t node);
+
+        void InsertLeaf(int32_t leaf);
+        void RemoveLeaf(int32_t leaf);
+        // Refits and rotates from `node` up to the root
+        void RefitAncestors(int32_t node);
+        void Rotate(int32_t node);
+
+        // Boxes travel with their centroids while being partitioned, so each level is a linear pass
+        struct BuildItem
+        {
+            AABB Box;
+            glm::vec3 Centroid;
+            uint32_t Object;
+        };
+        void BuildRange(int32_t node, int32_t parent, BuildItem* items, uint32_t count, std::vector<int32_t>& proxies);
+
+        std::vector<Node> m_Nodes;
+        int32_t m_Root = NullNode;
+        int32_t m_FreeList = NullNode;
+        uint32_t m_ProxyCount = 0;
+    };
+
+    template<typename Fn>
+    void AABBTree::QueryFrustum(const Frustum& frustum, Fn&& func) const
+    {
+        if (m_Root == NullNode)
+            return;
+
+        // The high bit marks subtrees already known to be fully inside, which skip the plane tests
+        constexpr uint32_t inside = 0x80000000u;
+        uint32_t stack[s_StackSize];
+        uint32_t count = 0;
+        stack[count++] = (uint32_t)m_Root;
+
+        while (count > 0)
+        {
+            uint32_t entry = stack[--count];
+            const Node& node = m_Nodes[entry & ~inside];
+
+            uint32_t flag = entry & inside;
+            if (!flag)
+            {
+                bool contained = true;
+                bool outside = false;
+                for (const auto& plane : frustum.Planes)
+                {
+                    glm::vec3 normal(plane);
+                    glm::vec3 positive(plane.x >= 0.0f ? node.Box.Max.x : node.Box.Min.x, plane.y >= 0.0f ? node.Box.Max.y : node.Box.Min.y, plane.z >= 0.0f ? node.Box.Max.z : node.Box.Min.z);
+                    glm::vec3 negative(plane.x >= 0.0f ? node.Box.Min.x : node.Box.Max.x, plane.y >= 0.0f ? node.Box.Min.y : node.Box.Max.y, plane.z >= 0.0f ? node.Box.Min.z : node.Box.Max.z);
+                    if (glm::dot(normal, positive) + plane.w < 0.0f)
+                    {
+                        outside = true;
+                        break;
+                    }
+                    contained &= glm::dot(normal, negative) + plane.w >= 0.0f;
+                }
+                if (outside)
+                    continue;
+                if (contained)
+                    flag = inside;
+            }
+
+            if (node.IsLeaf())
+            {
+                func(node.UserData);
+                continue;
+            }
+
+            AE_CORE_ASSERT(count + 2 <= s_StackSize, "AABB tree is too deep!");
+            stack[count++] = (uint32_t)node.Child1 | flag;
+            stack[count++] = (uint32_t)node.Child2 | flag;
+        }
+    }
+
+    template<typename Fn>
+    void AABBTree::QueryOverlap(const AABB& box, Fn&& func) const
+    {
+        if (m_Root == NullNode)
+            return;
+
+        int32_t stack[s_StackSize];
+        uint32_t count = 0;
+        stack[count++] = m_Root;
+
+        while (count > 0)
+        {
+            const Node& node = m_Nodes[stack[--count]];
+            if (!node.Box.Overlaps(box))
+                continue;
+
+            if (node.IsLeaf())
+            {
+                func(node.UserData);
+                continue;
+            }
+
+            AE_CORE_ASSERT(count + 2 <= s_StackSize, "AABB tree is too deep!");
+            stack[count++] = node.Child1;
+            stack[count++] = node.Child2;
+        }
+    }
+
+    template<typename Fn>
+    void AABBTree::QuerySphere(const glm::vec3& center, float radius, Fn&& func) const
+    {
+        if (m_Root == NullNode)
+            return;
+
+        int32_t stack[s_StackSize];
+        uint32_t count = 0;
+        stack[count++] = m_Root;
+
+        while (count > 0)
+        {
+            const Node& node = m_Nodes[stack[--count]];
+            if (!node.Box.OverlapsSphere(center, radius))
+                continue;
+
+            if (node.IsLeaf())
+            {
+                func(node.UserData);
+                continue;
+            }
+
+            AE_CORE_ASSERT(count + 2 <= s_StackSize, "AABB tree is too deep!");
+            stack[count++] = node.Child1;
+            stack[count++] = node.Child2;
+        }
+    }
+
+    template<typename Fn>
+    bool AABBTree::RayCast(const Ray& ray, float maxDistance, Fn&& intersect, RayHit& hit) const
+    {
+        if (m_Root == NullNode)
+            return false;
+
+        glm::vec3 invDirection = 1.0f / ray.Direction;
+        float closest = maxDistance;
+        bool found = false;
+
+        struct Entry
+        {
+            int32_t Node;
+            float Distance;
+        };
+        Entry stack[s_StackSize];
+        uint32_t count = 0;
+
+        float distance;
+        if (!Ray::Intersects(m_Nodes[m_Root].Box, ray.Origin, invDirection, closest, distance))
+            return false;
+        stack[count++] = { m_Root, distance };
+
+        while (count > 0)
+        {
+            Entry entry = stack[--count];
+            if (entry.Distance > closest)
+                continue;
+
+            const Node& node = m_Nodes[entry.Node];
+            if (node.IsLeaf())
+            {
+                float t = intersect(node.UserData, closest);
+                if (t >= 0.0f && t <= closest)
+                {
+                    // Box-only hits report where the ray enters the box
+                    closest = glm::max(t, entry.Distance);
+                    hit.UserData = node.UserData;
+                    hit.Distance = closest;
+                    found = true;
+                }
+                continue;
+            }
+
+            float d1, d2;
+            bool hit1 = Ray::Intersects(m_Nodes[node.Child1].Box, ray.Origin, invDirection, closest, d1);
+            bool hit2 = Ray::Intersects(m_Nodes[node.Child2].Box, ray.Origin, invDirection, closest, d2);
+
+            // The nearer child goes on top so it's visited first
+            AE_CORE_ASSERT(count + 2 <= s_StackSize, "AABB tree is too deep!");
+            if (hit1 && hit2)
+            {
+                if (d1 <= d2)
+                {
+                    stack[count++] = { node.Child2, d2 };
+                    stack[count++] = { node.Child1, d1 };
+                }
+                else
+                {
+                    stack[count++] = { node.Child1, d1 };
+                    stack[count++] = { node.Child2, d2 };
+                }
+            }
+            else if (hit1)
+                stack[count++] = { node.Child1, d1 };
+            else if (hit2)
+                stack[count++] = { node.Child2, d2 };
+        }
+        return found;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "aepch.h"
+
+namespace Aether {
+
+    struct AABB
+    {
+        glm::vec3 Min = glm::vec3(FLT_MAX);
+        glm::vec3 Max = glm::vec3(-FLT_MAX);
+
+        static AABB Union(const AABB& a, const AABB& b) { return { glm::min(a.Min, b.Min), glm::max(a.Max, b.Max) }; }
+
+        float SurfaceArea() const
+        {
+            glm::vec3 d = Max - Min;
+            return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+        }
+
+        bool Contains(const AABB& other) const
+        {
+            return Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z
+                && Max.x >= other.Max.x && Max.y >= other.Max.y && Max.z >= other.Max.z;
+        }
+
+        bool Overlaps(const AABB& other) const
+        {
+            return Min.x <= other.Max.x && Min.y <= other.Max.y && Min.z <= other.Max.z
+                && Max.x >= other.Min.x && Max.y >= other.Min.y && Max.z >= other.Min.z;
+        }
+
+        bool OverlapsSphere(const glm::vec3& center, float radius) const
+        {
+            glm::vec3 d = center - glm::clamp(center, Min, Max);
+            return glm::dot(d, d) <= radius * radius;
+        }
+    };
+
+    // Distances along a ray are in multiples of Direction, which doesn't need to be normalized
+    struct Ray
+    {
+        glm::vec3 Origin;
+        glm::vec3 Direction;
+
+        // Slab test; `invDirection` is 1 / Direction
+        static bool Intersects(const AABB& box, const glm::vec3& origin, const glm::vec3& invDirection, float maxDistance, float& distance)
+        {
+            glm::vec3 t0 = (box.Min - origin) * invDirection;
+            glm::vec3 t1 = (box.Max - origin) * invDirection;
+            glm::vec3 tMin = glm::min(t0, t1), tMax = glm::max(t0, t1);
+            float enter = glm::max(glm::max(tMin.x, tMin.y), glm::max(tMin.z, 0.0f));
+            float exit = glm::min(glm::min(tMax.x, tMax.y), glm::min(tMax.z, maxDistance));
+            distance = enter;
+            return enter <= exit;
+        }
+    };
+}
@@ -1,6 +1,7 @@
 #include "Aether/Renderer/Buffer.h"
 #include "Aether/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Platform/Null/NullBuffer.h"
 
 namespace Aether {
     Ref<VertexBuffer> VertexBuffer::Create(uint32_t size)
@@ -9,6 +10,7 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(size);
+			case RendererAPI::API::Null:    return CreateRef<NullVertexBuffer>(size);
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI");
@@ -21,6 +23,7 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(vertices, size);
+			case RendererAPI::API::Null:    return CreateRef<NullVertexBuffer>(vertices, size);
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI");
@@ -33,6 +36,7 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLIndexBuffer>(indices, count);
+			case RendererAPI::API::Null:    return CreateRef<NullIndexBuffer>(indices, count);
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI");
@@ -0,0 +1,99 @@
+#include "aepch.h"
+#include "Aether/Renderer/CascadedShadowMap.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Aether {
+
+    void CascadedShadowMap::SetCascadeCount(uint32_t count)
+    {
+        if (count < 2 || count > MaxCascades)
+        {
+            AE_CORE_WARN("CascadedShadowMap: {0} cascades requested, clamping to 2-{1}", count, MaxCascades);
+            count = std::clamp(count, 2u, MaxCascades);
+        }
+        m_CascadeCount = count;
+    }
+
+    void CascadedShadowMap::Update(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& lightDirection, const AABB& casterBounds)
+    {
+        // View-space corners of the near and far planes; each near/far pair lies on a ray from the eye
+        glm::mat4 inverseProjection = glm::inverse(projection);
+        std::array<glm::vec3, 4> nearCorners, farCorners;
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            float x = (i & 1) ? 1.0f : -1.0f;
+            float y = (i & 2) ? 1.0f : -1.0f;
+            glm::vec4 nearCorner = inverseProjection * glm::vec4(x, y, -1.0f, 1.0f);
+            glm::vec4 farCorner = inverseProjection * glm::vec4(x, y, 1.0f, 1.0f);
+            nearCorners[i] = glm::vec3(nearCorner) / nearCorner.w;
+            farCorners[i] = glm::vec3(farCorner) / farCorner.w;
+        }
+
+        float nearDepth = -nearCorners[0].z;
+        float farDepth = -farCorners[0].z;
+        float shadowDepth = glm::min(farDepth, m_MaxDistance);
+        glm::mat4 inverseView = glm::inverse(view);
+
+        // The light's rotation alone, so moving the camera slides cascades in light space instead of re-aiming them
+        glm::vec3 direction = glm::normalize(lightDirection);
+        glm::vec3 up = glm::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+        glm::mat4 lightView = glm::lookAt(glm::vec3(0.0f), direction, up);
+
+        // Light space looks down -z, so the caster nearest the light has the largest z
+        float casterTop = -FLT_MAX;
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            glm::vec3 corner((i & 1) ? casterBounds.Max.x : casterBounds.Min.x,
+                             (i & 2) ? casterBounds.Max.y : casterBounds.Min.y,
+                             (i & 4) ? casterBounds.Max.z : casterBounds.Min.z);
+            casterTop = glm::max(casterTop, (lightView * glm::vec4(corner, 1.0f)).z);
+        }
+
+        float sliceStart = nearDepth;
+        for (uint32_t c = 0; c < m_CascadeCount; c++)
+        {
+            float p = (float)(c + 1) / (float)m_CascadeCount;
+            float logSplit = nearDepth * glm::pow(shadowDepth / nearDepth, p);
+            float uniformSplit = nearDepth + (shadowDepth - nearDepth) * p;
+            float sliceEnd = glm::mix(uniformSplit, logSplit, m_SplitLambda);
+
+            std::array<glm::vec3, 8> corners;
+            glm::vec3 center(0.0f);
+            for (uint32_t i = 0; i < 4; i++)
+            {
+                glm::vec3 ray = farCorners[i] - nearCorners[i];
+                glm::vec3 start = nearCorners[i] + ray * ((sliceStart - nearDepth) / (farDepth - nearDepth));
+                glm::vec3 end = nearCorners[i] + ray * ((sliceEnd - nearDepth) / (farDepth - nearDepth));
+                corners[i] = glm::vec3(inverseView * glm::vec4(start, 1.0f));
+                corners[i + 4] = glm::vec3(inverseView * glm::vec4(end, 1.0f));
+                center += corners[i] + corners[i + 4];
+            }
+            center /= 8.0f;
+
+            float radius = 0.0f;
+            for (const auto& corner : corners)
+                radius = glm::max(radius, glm::length(corner - center));
+            // Rounded up so float noise in the corners can't change the projection's size
+            radius = glm::ceil(radius * 16.0f) / 16.0f;
+
+            float texelSize = 2.0f * radius / (float)m_Resolution;
+            glm::vec3 lightCenter = glm::vec3(lightView * glm::vec4(center, 1.0f));
+            lightCenter.x = glm::floor(lightCenter.x / texelSize) * texelSize;
+            lightCenter.y = glm::floor(lightCenter.y / texelSize) * texelSize;
+
+            float zNear = glm::max(lightCenter.z + radius, casterTop);
+            float zFar = lightCenter.z - radius;
+            glm::mat4 lightProjection = glm::ortho(lightCenter.x - radius, lightCenter.x + radius,
+                                                   lightCenter.y - radius, lightCenter.y + radius,
+                                                   -zNear, -zFar);
+
+            ShadowCascade& cascade = m_Cascades[c];
+            cascade.ViewProjection = lightProjection * lightView;
+            cascade.SplitDepth = sliceEnd;
+            cascade.TexelDepth = texelSize / (zNear - zFar);
+
+            sliceStart = sliceEnd;
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Renderer/Bounds.h"
+
+namespace Aether {
+
+    struct ShadowCascade
+    {
+        glm::mat4 ViewProjection = glm::mat4(1.0f);
+        // View-space depth where the cascade ends
+        float SplitDepth = 0.0f;
+        // How far one shadow texel spans in the cascade's [0, 1] depth, for scaling the receiver bias
+        float TexelDepth = 0.0f;
+    };
+
+    // Shadow projections for a directional light. The camera frustum (up to the max distance) is cut into
+    // depth slices with the practical split scheme, a blend of logarithmic and uniform splits, and each
+    // slice gets an orthographic projection around its bounding sphere. The sphere keeps the size fixed as
+    // the camera turns and the center is snapped to whole texels, so shadow edges don't shimmer. Depth
+    // reaches back to `casterBounds` so casters outside the view still land in the map.
+    class AETHER_API CascadedShadowMap
+    {
+    public:
+        static constexpr uint32_t MaxCascades = 4;
+
+        // 2 to MaxCascades
+        void SetCascadeCount(uint32_t count);
+        uint32_t GetCascadeCount() const { return m_CascadeCount; }
+
+        // 0 gives uniform splits, 1 logarithmic
+        void SetSplitLambda(float lambda) { m_SplitLambda = glm::clamp(lambda, 0.0f, 1.0f); }
+        float GetSplitLambda() const { return m_SplitLambda; }
+
+        // Of one cascade layer; texel snapping depends on it
+        void SetResolution(uint32_t resolution) { m_Resolution = resolution; }
+        uint32_t GetResolution() const { return m_Resolution; }
+
+        // Shadows end here, or at the camera's far plane if that is closer
+        void SetMaxDistance(float distance) { m_MaxDistance = distance; }
+        float GetMaxDistance() const { return m_MaxDistance; }
+
+        // `lightDirection` points from the light into the scene
+        void Update(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& lightDirection, const AABB& casterBounds);
+
+        const ShadowCascade& GetCascade(uint32_t index) const { AE_CORE_ASSERT(index < m_CascadeCount, "Cascade index out of range!"); return m_Cascades[index]; }
+    private:
+        std::array<ShadowCascade, MaxCascades> m_Cascades;
+        uint32_t m_CascadeCount = MaxCascades;
+        float m_SplitLambda = 0.75f;
+        uint32_t m_Resolution = 2048;
+        float m_MaxDistance = 50.0f;
+    };
+}
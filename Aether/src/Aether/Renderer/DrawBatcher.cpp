@@ -0,0 +1,133 @@
+#include "aepch.h"
+#include "Aether/Renderer/DrawBatcher.h"
+#include "Aether/Renderer/Renderer.h"
+#include "Aether/Resources/Mesh.h"
+#include "Aether/Resources/Material.h"
+
+namespace Aether {
+
+    static const BufferLayout s_InstanceLayout = {
+        { "a_InstanceModel", ShaderDataType::Mat4 }
+    };
+
+    void DrawBatcher::Submit(Mesh* mesh, uint32_t submesh, Material* material, const glm::mat4& transform)
+    {
+        AE_CORE_ASSERT(submesh < mesh->GetSubMeshes().size(), "DrawBatcher: Submesh index out of range!");
+        m_Draws.push_back({ mesh, submesh, material, transform });
+        m_Dirty = true;
+    }
+
+    void DrawBatcher::Clear()
+    {
+        m_Draws.clear();
+        m_Batches.clear();
+        m_Instances = {};
+        m_Dirty = false;
+    }
+
+    void DrawBatcher::Build()
+    {
+        m_Batches.clear();
+        m_Instances = {};
+        m_BuiltFrame = RenderThread::GetReplayFrameIndex();
+        m_Dirty = false;
+        if (m_Draws.empty())
+            return;
+
+        // Material first so consecutive batches share bindings; submission order is kept inside a batch
+        m_Order.resize(m_Draws.size());
+        for (uint32_t i = 0; i < (uint32_t)m_Order.size(); i++)
+            m_Order[i] = i;
+        std::stable_sort(m_Order.begin(), m_Order.end(), [this](uint32_t a, uint32_t b)
+        {
+            const auto& lhs = m_Draws[a];
+            const auto& rhs = m_Draws[b];
+            if (lhs.Material != rhs.Material)
+                return lhs.Material < rhs.Material;
+            if (lhs.Mesh != rhs.Mesh)
+                return lhs.Mesh < rhs.Mesh;
+            return lhs.Submesh < rhs.Submesh;
+        });
+
+        for (uint32_t i = 0; i < (uint32_t)m_Order.size(); i++)
+        {
+            const auto& draw = m_Draws[m_Order[i]];
+            if (m_Batches.empty() || m_Batches.back().Material != draw.Material || m_Batches.back().Mesh != draw.Mesh || m_Batches.back().Submesh != draw.Submesh)
+                m_Batches.push_back({ draw.Mesh, draw.Submesh, draw.Material, i, 0 });
+            m_Batches.back().InstanceCount++;
+        }
+
+        auto& ring = Renderer::GetRingBuffer();
+        m_Instances = ring.Allocate(m_Order.size() * sizeof(glm::mat4), sizeof(glm::mat4));
+        if (!m_Instances)
+        {
+            AE_CORE_WARN("DrawBatcher: {0} instances don't fit in the ring buffer, drawing them one by one", m_Order.size());
+            return;
+        }
+
+        glm::mat4* transforms = (glm::mat4*)m_Instances.Data;
+        for (uint32_t i = 0; i < (uint32_t)m_Order.size(); i++)
+            transforms[i] = m_Draws[m_Order[i]].Transform;
+        ring.Commit(m_Instances);
+    }
+
+    void DrawBatcher::Draw(Material* material)
+    {
+        // The transforms live in this frame's ring region; an older one may already be overwritten
+        if (m_Dirty || m_BuiltFrame != RenderThread::GetReplayFrameIndex())
+            Build();
+
+        bool baseInstance = RenderCommand::SupportsBaseInstance();
+        Material* bound = nullptr;
+        VertexArray* pointed = nullptr;
+
+        for (const auto& batch : m_Batches)
+        {
+            Material* batchMaterial = material ? material : batch.Material;
+            if (batchMaterial != bound)
+            {
+                if (bound)
+                    bound->GetShader()->SetInt("u_UseInstancing", 0);
+                if (!material)
+                {
+                    batchMaterial->Bind(0);
+                    batchMaterial->UploadMaterial();
+                }
+                batchMaterial->GetShader()->SetInt("u_UseInstancing", m_Instances ? 1 : 0);
+                bound = batchMaterial;
+            }
+
+            const auto& submesh = batch.Mesh->GetSubMeshes()[batch.Submesh];
+            Ref<VertexArray> vertexArray = batch.Mesh->GetVertexArray();
+
+            if (!m_Instances)
+            {
+                for (uint32_t i = 0; i < batch.InstanceCount; i++)
+                {
+                    batchMaterial->GetShader()->SetMat4("u_Model", m_Draws[m_Order[batch.FirstInstance + i]].Transform);
+                    RenderCommand::DrawIndexedBaseVertex(vertexArray, submesh.IndexCount, (void*)(submesh.BaseIndex * sizeof(uint32_t)), submesh.BaseVertex);
+                }
+                continue;
+            }
+
+            // With base instances the attributes point at the whole stream once per vertex array;
+            // without, they are moved to each batch's slice
+            if (!baseInstance)
+            {
+                vertexArray->SetInstanceBuffer(m_Instances.Slice(batch.FirstInstance * sizeof(glm::mat4), batch.InstanceCount * sizeof(glm::mat4)), s_InstanceLayout, m_InstanceLocation);
+                RenderCommand::DrawIndexedInstanced(vertexArray, submesh.IndexCount, submesh.BaseIndex, submesh.BaseVertex, batch.InstanceCount);
+                continue;
+            }
+
+            if (vertexArray.get() != pointed)
+            {
+                vertexArray->SetInstanceBuffer(m_Instances, s_InstanceLayout, m_InstanceLocation);
+                pointed = vertexArray.get();
+            }
+            RenderCommand::DrawIndexedInstanced(vertexArray, submesh.IndexCount, submesh.BaseIndex, submesh.BaseVertex, batch.InstanceCount, batch.FirstInstance);
+        }
+
+        if (bound)
+            bound->GetShader()->SetInt("u_UseInstancing", 0);
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Renderer/RingBuffer.h"
+
+namespace Aether {
+
+    class Mesh;
+    class Material;
+
+    // Collects (mesh, submesh, material) draws with their transforms and issues one instanced draw
+    // per distinct triple. Transforms are written to the renderer's ring buffer once per Build() and
+    // each batch starts at its own base instance, so several passes can draw the same batches.
+    // A batcher kept across frames is rebuilt on its first Draw() of each frame, since the ring
+    // region it wrote is handed out again once the frame retires.
+    // Shaders must read the transform from `a_InstanceModel` at GetInstanceLocation() when
+    // `u_UseInstancing` is set. Render thread only; pointers must stay valid until Clear().
+    class AETHER_API DrawBatcher
+    {
+    public:
+        // Has to come after the mesh's own vertex attributes
+        DrawBatcher(uint32_t instanceLocation = 3) : m_InstanceLocation(instanceLocation) {}
+
+        void Submit(Mesh* mesh, uint32_t submesh, Material* material, const glm::mat4& transform);
+        void Clear();
+
+        // Groups the submitted draws and uploads their transforms; Draw() calls it when needed,
+        // including when the last Build() was in an earlier frame
+        void Build();
+
+        // Binds each batch's material and draws it. With `material`, every batch uses that one
+        // instead and the caller has already bound it and uploaded its uniforms, e.g. a depth-only pass.
+        void Draw(Material* material = nullptr);
+
+        uint32_t GetInstanceLocation() const { return m_InstanceLocation; }
+        uint32_t GetBatchCount() const { return (uint32_t)m_Batches.size(); }
+        uint32_t GetInstanceCount() const { return (uint32_t)m_Draws.size(); }
+    private:
+        struct DrawItem
+        {
+            Aether::Mesh* Mesh;
+            uint32_t Submesh;
+            Aether::Material* Material;
+            glm::mat4 Transform;
+        };
+
+        struct Batch
+        {
+            Aether::Mesh* Mesh;
+            uint32_t Submesh;
+            Aether::Material* Material;
+            uint32_t FirstInstance;
+            uint32_t InstanceCount;
+        };
+
+        uint32_t m_InstanceLocation;
+
+        std::vector<DrawItem> m_Draws;
+        std::vector<uint32_t> m_Order;
+        std::vector<Batch> m_Batches;
+        RingAllocation m_Instances;
+        // Replayed frame m_Instances was allocated in
+        uint64_t m_BuiltFrame = 0;
+        bool m_Dirty = false;
+    };
+}
@@ -166,6 +166,17 @@ namespace Aether {
         }
     }
 
+    Ray EditorCamera::ScreenPointToRay(float x, float y) const
+    {
+        glm::vec2 ndc(2.0f * x / m_ViewportWidth - 1.0f, 1.0f - 2.0f * y / m_ViewportHeight);
+        glm::mat4 inverse = glm::inverse(GetViewProjection());
+
+        glm::vec4 nearPoint = inverse * glm::vec4(ndc.x, ndc.y, -1.0f, 1.0f);
+        glm::vec4 farPoint = inverse * glm::vec4(ndc.x, ndc.y, 1.0f, 1.0f);
+        glm::vec3 origin = glm::vec3(nearPoint) / nearPoint.w;
+        return { origin, glm::normalize(glm::vec3(farPoint) / farPoint.w - origin) };
+    }
+
     glm::vec3 EditorCamera::GetUpDirection() const
     {
         return glm::rotate(GetOrientation(), glm::vec3(0.0f, 1.0f, 0.0f));
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Camera.h"
+#include "Bounds.h"
 #include "Aether/Core/Timestep.h"
 #include "Aether/Events/Event.h"
 #include "Aether/Events/MouseEvent.h"
@@ -26,6 +27,9 @@ namespace Aether {
         const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
         glm::mat4 GetViewProjection() const { return m_Projection * m_ViewMatrix; }
 
+        // World-space ray through a viewport pixel (origin top-left), starting on the near plane
+        Ray ScreenPointToRay(float x, float y) const;
+
         glm::vec3 GetUpDirection() const;
         glm::vec3 GetRightDirection() const;
         glm::vec3 GetForwardDirection() const;
@@ -1,6 +1,7 @@
 #include "Aether/Renderer/FrameBuffer.h"
 #include "Aether/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLFrameBuffer.h"
+#include "Platform/Null/NullFrameBuffer.h"
 
 namespace Aether {
 	
@@ -10,6 +11,7 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLFrameBuffer>(spec);
+			case RendererAPI::API::Null:    return CreateRef<NullFrameBuffer>(spec);
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -38,6 +38,8 @@ namespace Aether {
 		uint32_t Width = 0, Height = 0;
 		FramebufferAttachmentSpecification Attachments;
 		uint32_t Samples = 1;
+		// Non-zero makes the depth attachment a 2D array of this many layers; color attachments stay 2D
+		uint32_t Layers = 0;
 
 		bool SwapChainTarget = false;
 	};
@@ -56,6 +58,8 @@ namespace Aether {
 		virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) = 0;
 
 		virtual void ClearAttachment(uint32_t attachmentIndex, int value) = 0;
+		// Which layer of a layered depth attachment draws and clears go to
+		virtual void SetDepthLayer(uint32_t layer) = 0;
 
         virtual void BindDepthTexture(uint32_t slot = 0) const = 0;
 		virtual void BindColorTexture(uint32_t slot = 0, uint32_t index = 0) const = 0;
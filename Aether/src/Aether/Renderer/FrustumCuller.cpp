@@ -0,0 +1,204 @@
+#include "aepch.h"
+#include "Aether/Renderer/FrustumCuller.h"
+#include "Aether/Core/JobSystem.h"
+
+#if defined(__AVX__)
+    #define AE_CULLING_AVX 1
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define AE_CULLING_SSE 1
+    #include <xmmintrin.h>
+#endif
+
+namespace Aether {
+
+    // Boxes per ParallelFor batch; a multiple of every SIMD width
+    static constexpr uint32_t s_BoxesPerBatch = 16384;
+
+    Frustum Frustum::FromViewProjection(const glm::mat4& m)
+    {
+        // Rows of the matrix; glm stores columns
+        glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        Frustum frustum;
+        frustum.Planes = { row3 + row0, row3 - row0, row3 + row1, row3 - row1, row3 + row2, row3 - row2 };
+        for (auto& plane : frustum.Planes)
+            plane /= glm::length(glm::vec3(plane));
+        return frustum;
+    }
+
+    bool Frustum::Intersects(const glm::vec3& min, const glm::vec3& max) const
+    {
+        for (const auto& plane : Planes)
+        {
+            // The corner furthest along the plane normal
+            glm::vec3 corner(plane.x >= 0.0f ? max.x : min.x, plane.y >= 0.0f ? max.y : min.y, plane.z >= 0.0f ? max.z : min.z);
+            if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    uint32_t FrustumCuller::Add(const glm::vec3& min, const glm::vec3& max)
+    {
+        m_MinX.push_back(min.x); m_MinY.push_back(min.y); m_MinZ.push_back(min.z);
+        m_MaxX.push_back(max.x); m_MaxY.push_back(max.y); m_MaxZ.push_back(max.z);
+        return (uint32_t)m_MinX.size() - 1;
+    }
+
+    void FrustumCuller::Set(uint32_t index, const glm::vec3& min, const glm::vec3& max)
+    {
+        m_MinX[index] = min.x; m_MinY[index] = min.y; m_MinZ[index] = min.z;
+        m_MaxX[index] = max.x; m_MaxY[index] = max.y; m_MaxZ[index] = max.z;
+    }
+
+    void FrustumCuller::Reserve(uint32_t count)
+    {
+        for (auto* array : { &m_MinX, &m_MinY, &m_MinZ, &m_MaxX, &m_MaxY, &m_MaxZ })
+            array->reserve(count);
+    }
+
+    void FrustumCuller::Clear()
+    {
+        for (auto* array : { &m_MinX, &m_MinY, &m_MinZ, &m_MaxX, &m_MaxY, &m_MaxZ })
+            array->clear();
+    }
+
+    void FrustumCuller::Cull(const Frustum& frustum, std::vector<uint32_t>& visible)
+    {
+        visible.clear();
+        uint32_t count = GetCount();
+        if (count == 0)
+            return;
+
+        // A plane's sign pattern is the same for every box, so the corner to test is picked once per
+        // plane by choosing between the min and max arrays rather than per box
+        struct PlaneSource
+        {
+            const float* X;
+            const float* Y;
+            const float* Z;
+            glm::vec4 Plane;
+        };
+        std::array<PlaneSource, 6> planes;
+        for (uint32_t p = 0; p < 6; p++)
+        {
+            const glm::vec4& plane = frustum.Planes[p];
+            planes[p] = {
+                plane.x >= 0.0f ? m_MaxX.data() : m_MinX.data(),
+                plane.y >= 0.0f ? m_MaxY.data() : m_MinY.data(),
+                plane.z >= 0.0f ? m_MaxZ.data() : m_MinZ.data(),
+                plane
+            };
+        }
+
+        uint32_t batches = (count + s_BoxesPerBatch - 1) / s_BoxesPerBatch;
+        m_BatchVisible.resize(batches);
+
+        JobSystem::ParallelFor(count, s_BoxesPerBatch, [&](uint32_t begin, uint32_t end)
+        {
+            auto& out = m_BatchVisible[begin / s_BoxesPerBatch];
+            out.resize(end - begin);
+            uint32_t written = 0;
+            uint32_t i = begin;
+
+#if defined(AE_CULLING_AVX)
+            __m256 a[6], b[6], c[6], d[6];
+            for (uint32_t p = 0; p < 6; p++)
+            {
+                a[p] = _mm256_set1_ps(planes[p].Plane.x);
+                b[p] = _mm256_set1_ps(planes[p].Plane.y);
+                c[p] = _mm256_set1_ps(planes[p].Plane.z);
+                d[p] = _mm256_set1_ps(planes[p].Plane.w);
+            }
+
+            const __m256 zero = _mm256_setzero_ps();
+            for (; i + 8 <= end; i += 8)
+            {
+                __m256 outside = zero;
+                for (uint32_t p = 0; p < 6; p++)
+                {
+                    __m256 distance = _mm256_add_ps(_mm256_mul_ps(a[p], _mm256_loadu_ps(planes[p].X + i)), d[p]);
+                    distance = _mm256_add_ps(distance, _mm256_mul_ps(b[p], _mm256_loadu_ps(planes[p].Y + i)));
+                    distance = _mm256_add_ps(distance, _mm256_mul_ps(c[p], _mm256_loadu_ps(planes[p].Z + i)));
+                    outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, zero, _CMP_LT_OQ));
+                }
+
+                // Branchless compaction: every lane is written, only visible ones advance the cursor
+                uint32_t mask = ~(uint32_t)_mm256_movemask_ps(outside);
+                for (uint32_t lane = 0; lane < 8; lane++)
+                {
+                    out[written] = i + lane;
+                    written += (mask >> lane) & 1;
+                }
+            }
+#elif defined(AE_CULLING_SSE)
+            __m128 a[6], b[6], c[6], d[6];
+            for (uint32_t p = 0; p < 6; p++)
+            {
+                a[p] = _mm_set1_ps(planes[p].Plane.x);
+                b[p] = _mm_set1_ps(planes[p].Plane.y);
+                c[p] = _mm_set1_ps(planes[p].Plane.z);
+                d[p] = _mm_set1_ps(planes[p].Plane.w);
+            }
+
+            const __m128 zero = _mm_setzero_ps();
+            for (; i + 4 <= end; i += 4)
+            {
+                __m128 outside = zero;
+                for (uint32_t p = 0; p < 6; p++)
+                {
+                    __m128 distance = _mm_add_ps(_mm_mul_ps(a[p], _mm_loadu_ps(planes[p].X + i)), d[p]);
+                    distance = _mm_add_ps(distance, _mm_mul_ps(b[p], _mm_loadu_ps(planes[p].Y + i)));
+                    distance = _mm_add_ps(distance, _mm_mul_ps(c[p], _mm_loadu_ps(planes[p].Z + i)));
+                    outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, zero));
+                }
+
+                uint32_t mask = ~(uint32_t)_mm_movemask_ps(outside);
+                for (uint32_t lane = 0; lane < 4; lane++)
+                {
+                    out[written] = i + lane;
+                    written += (mask >> lane) & 1;
+                }
+            }
+#endif
+
+            for (; i < end; i++)
+            {
+                bool inside = true;
+                for (const auto& plane : planes)
+                    inside &= plane.Plane.x * plane.X[i] + plane.Plane.y * plane.Y[i] + plane.Plane.z * plane.Z[i] + plane.Plane.w >= 0.0f;
+                out[written] = i;
+                written += inside ? 1 : 0;
+            }
+
+            out.resize(written);
+        });
+
+        size_t total = 0;
+        for (uint32_t batch = 0; batch < batches; batch++)
+            total += m_BatchVisible[batch].size();
+        visible.reserve(total);
+        for (uint32_t batch = 0; batch < batches; batch++)
+            visible.insert(visible.end(), m_BatchVisible[batch].begin(), m_BatchVisible[batch].end());
+    }
+
+    void FrustumCuller::TransformBounds(const glm::mat4& transform, const glm::vec3& min, const glm::vec3& max, glm::vec3& outMin, glm::vec3& outMax)
+    {
+        // Arvo: each output axis sums the smaller and larger of every matrix term times the input extent
+        outMin = outMax = glm::vec3(transform[3]);
+        for (int col = 0; col < 3; col++)
+        {
+            for (int row = 0; row < 3; row++)
+            {
+                float a = transform[col][row] * min[col];
+                float b = transform[col][row] * max[col];
+                outMin[row] += glm::min(a, b);
+                outMax[row] += glm::max(a, b);
+            }
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "aepch.h"
+
+namespace Aether {
+
+    // Six inward-facing planes, normalized; a point p is inside when dot(plane.xyz, p) + plane.w >= 0 for all
+    struct Frustum
+    {
+        std::array<glm::vec4, 6> Planes;
+
+        // GL clip space (-w <= z <= w), e.g. EditorCamera::GetViewProjection() or a light-space matrix
+        static Frustum FromViewProjection(const glm::mat4& viewProjection);
+
+        bool Intersects(const glm::vec3& min, const glm::vec3& max) const;
+    };
+
+    // World-space AABBs kept as structure-of-arrays and tested against a frustum 8 (AVX), 4 (SSE)
+    // or 1 box at a time, spread over the JobSystem. Boxes that straddle a plane count as visible.
+    class AETHER_API FrustumCuller
+    {
+    public:
+        // Returns the index Cull() reports the box under
+        uint32_t Add(const glm::vec3& min, const glm::vec3& max);
+        void Set(uint32_t index, const glm::vec3& min, const glm::vec3& max);
+        void Reserve(uint32_t count);
+        void Clear();
+
+        uint32_t GetCount() const { return (uint32_t)m_MinX.size(); }
+        void GetBounds(uint32_t index, glm::vec3& min, glm::vec3& max) const
+        {
+            min = { m_MinX[index], m_MinY[index], m_MinZ[index] };
+            max = { m_MaxX[index], m_MaxY[index], m_MaxZ[index] };
+        }
+
+        // Replaces `visible` with the indices of boxes inside or touching the frustum, in ascending order
+        void Cull(const Frustum& frustum, std::vector<uint32_t>& visible);
+
+        // Bounds of a local-space box after `transform`
+        static void TransformBounds(const glm::mat4& transform, const glm::vec3& min, const glm::vec3& max, glm::vec3& outMin, glm::vec3& outMax);
+    private:
+        std::vector<float> m_MinX, m_MinY, m_MinZ;
+        std::vector<float> m_MaxX, m_MaxY, m_MaxZ;
+
+        // Per-batch results, kept between calls so culling doesn't allocate once warmed up
+        std::vector<std::vector<uint32_t>> m_BatchVisible;
+    };
+}
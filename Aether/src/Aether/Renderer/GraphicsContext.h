@@ -9,6 +9,8 @@ namespace Aether {
 
 		virtual void Init() = 0;
 		virtual void SwapBuffers() = 0;
+		// Binds the context to (or releases it from) the calling thread
+		virtual void MakeCurrent(bool current) = 0;
 
 		static Scope<GraphicsContext> Create(void* window);
 	};
@@ -0,0 +1,269 @@
+#include "aepch.h"
+#include "Aether/Renderer/OcclusionCuller.h"
+#include "Aether/Renderer/FrustumCuller.h"
+#include "Aether/Core/JobSystem.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define AE_OCCLUSION_SSE 1
+    #include <emmintrin.h>
+#endif
+
+namespace Aether {
+
+    // Occludees per ParallelFor batch
+    static constexpr uint32_t s_BoxesPerBatch = 1024;
+    // Vertices closer than this in clip w are treated as crossing the near plane
+    static constexpr float s_NearW = 1e-4f;
+
+    static const uint32_t s_BoxIndices[36] = {
+        0,1,3, 0,3,2, 4,6,7, 4,7,5, 0,4,5, 0,5,1,
+        2,3,7, 2,7,6, 0,2,6, 0,6,4, 1,5,7, 1,7,3
+    };
+
+    OcclusionCuller::OcclusionCuller(uint32_t width, uint32_t height)
+    {
+        m_TilesX = std::max((width + TileSize - 1) / TileSize, 1u);
+        m_TilesY = std::max((height + TileSize - 1) / TileSize, 1u);
+        m_Width = m_TilesX * TileSize;
+        m_Height = m_TilesY * TileSize;
+
+        m_Depth.assign((size_t)m_Width * m_Height, 1.0f);
+        m_TileMax.assign((size_t)m_TilesX * m_TilesY, 1.0f);
+    }
+
+    void OcclusionCuller::BeginFrame(const glm::mat4& viewProjection)
+    {
+        m_ViewProjection = viewProjection;
+        m_Triangles.clear();
+    }
+
+    void OcclusionCuller::AddOccluder(const glm::vec3* positions, const uint32_t* indices, uint32_t indexCount, const glm::mat4& transform)
+    {
+        AE_CORE_ASSERT(indexCount % 3 == 0, "Occluder index count must be a multiple of 3!");
+
+        glm::mat4 mvp = m_ViewProjection * transform;
+        for (uint32_t i = 0; i + 2 < indexCount; i += 3)
+        {
+            AddTriangle(mvp * glm::vec4(positions[indices[i]], 1.0f),
+                        mvp * glm::vec4(positions[indices[i + 1]], 1.0f),
+                        mvp * glm::vec4(positions[indices[i + 2]], 1.0f));
+        }
+    }
+
+    void OcclusionCuller::AddOccluderBox(const glm::vec3& min, const glm::vec3& max, const glm::mat4& transform)
+    {
+        glm::vec3 corners[8];
+        for (uint32_t i = 0; i < 8; i++)
+            corners[i] = glm::vec3(i & 4 ? max.x : min.x, i & 2 ? max.y : min.y, i & 1 ? max.z : min.z);
+        AddOccluder(corners, s_BoxIndices, 36, transform);
+    }
+
+    void OcclusionCuller::AddTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2)
+    {
+        // Not clipped: dropping a triangle only loses occlusion, it never hides anything wrongly
+        if (v0.w < s_NearW || v1.w < s_NearW || v2.w < s_NearW)
+            return;
+
+        glm::vec3 p[3] = { glm::vec3(v0) / v0.w, glm::vec3(v1) / v1.w, glm::vec3(v2) / v2.w };
+        for (auto& point : p)
+        {
+            point.x = (point.x * 0.5f + 0.5f) * (float)m_Width;
+            point.y = (point.y * 0.5f + 0.5f) * (float)m_Height;
+        }
+
+        float area = (p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[1].y - p[0].y) * (p[2].x - p[0].x);
+        if (std::abs(area) < 1e-6f)
+            return;
+
+        Triangle tri;
+        tri.MinX = std::max((int32_t)std::floor(std::min({ p[0].x, p[1].x, p[2].x })), 0);
+        tri.MinY = std::max((int32_t)std::floor(std::min({ p[0].y, p[1].y, p[2].y })), 0);
+        tri.MaxX = std::min((int32_t)std::ceil(std::max({ p[0].x, p[1].x, p[2].x })), (int32_t)m_Width - 1);
+        tri.MaxY = std::min((int32_t)std::ceil(std::max({ p[0].y, p[1].y, p[2].y })), (int32_t)m_Height - 1);
+        if (tri.MinX > tri.MaxX || tri.MinY > tri.MaxY)
+            return;
+
+        // Both windings are kept, so occluder meshes don't need consistent face orientation
+        float sign = area > 0.0f ? 1.0f : -1.0f;
+        auto edge = [sign](const glm::vec3& a, const glm::vec3& b)
+        {
+            float ex = (a.y - b.y) * sign;
+            float ey = (b.x - a.x) * sign;
+            return glm::vec3(ex, ey, -(ex * a.x + ey * a.y));
+        };
+        tri.EdgeA = edge(p[0], p[1]);
+        tri.EdgeB = edge(p[1], p[2]);
+        tri.EdgeC = edge(p[2], p[0]);
+
+        glm::vec3 d1 = p[1] - p[0];
+        glm::vec3 d2 = p[2] - p[0];
+        tri.DepthDx = (d1.z * d2.y - d2.z * d1.y) / area;
+        tri.DepthDy = (d2.z * d1.x - d1.z * d2.x) / area;
+        tri.Depth0 = p[0].z - tri.DepthDx * p[0].x - tri.DepthDy * p[0].y;
+
+        m_Triangles.push_back(tri);
+    }
+
+    void OcclusionCuller::Rasterize()
+    {
+        JobSystem::ParallelFor(m_TilesY, 1, [this](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t tileRow = begin; tileRow < end; tileRow++)
+                RasterizeBand(tileRow);
+        });
+    }
+
+    void OcclusionCuller::RasterizeBand(uint32_t tileRow)
+    {
+        int32_t bandMinY = (int32_t)(tileRow * TileSize);
+        int32_t bandMaxY = bandMinY + (int32_t)TileSize - 1;
+
+        float* band = m_Depth.data() + (size_t)bandMinY * m_Width;
+        std::fill(band, band + (size_t)TileSize * m_Width, 1.0f);
+
+        for (const Triangle& tri : m_Triangles)
+        {
+            if (tri.MaxY < bandMinY || tri.MinY > bandMaxY)
+                continue;
+
+            int32_t y0 = std::max(tri.MinY, bandMinY);
+            int32_t y1 = std::min(tri.MaxY, bandMaxY);
+
+            for (int32_t y = y0; y <= y1; y++)
+            {
+                float* row = m_Depth.data() + (size_t)y * m_Width;
+                float py = (float)y + 0.5f;
+                float rowA = tri.EdgeA.y * py + tri.EdgeA.z;
+                float rowB = tri.EdgeB.y * py + tri.EdgeB.z;
+                float rowC = tri.EdgeC.y * py + tri.EdgeC.z;
+                float rowDepth = tri.DepthDy * py + tri.Depth0;
+
+                int32_t x = tri.MinX;
+#if defined(AE_OCCLUSION_SSE)
+                // Rows are a whole number of tiles wide, so aligned groups of 4 never run off the end
+                x &= ~3;
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 lane = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+                for (; x <= tri.MaxX; x += 4)
+                {
+                    __m128 px = _mm_add_ps(_mm_set1_ps((float)x), lane);
+                    __m128 a = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.EdgeA.x), px), _mm_set1_ps(rowA));
+                    __m128 b = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.EdgeB.x), px), _mm_set1_ps(rowB));
+                    __m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.EdgeC.x), px), _mm_set1_ps(rowC));
+                    __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(a, zero), _mm_cmpge_ps(b, zero)), _mm_cmpge_ps(c, zero));
+                    if (_mm_movemask_ps(inside) == 0)
+                        continue;
+
+                    __m128 depth = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.DepthDx), px), _mm_set1_ps(rowDepth));
+                    __m128 current = _mm_loadu_ps(row + x);
+                    __m128 nearest = _mm_min_ps(current, depth);
+                    _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, current)));
+                }
+#else
+                for (; x <= tri.MaxX; x++)
+                {
+                    float px = (float)x + 0.5f;
+                    if (tri.EdgeA.x * px + rowA >= 0.0f && tri.EdgeB.x * px + rowB >= 0.0f && tri.EdgeC.x * px + rowC >= 0.0f)
+                        row[x] = std::min(row[x], tri.DepthDx * px + rowDepth);
+                }
+#endif
+            }
+        }
+
+        for (uint32_t tileX = 0; tileX < m_TilesX; tileX++)
+        {
+            float farthest = -FLT_MAX;
+            for (uint32_t y = 0; y < TileSize; y++)
+            {
+                const float* row = band + (size_t)y * m_Width + tileX * TileSize;
+                for (uint32_t x = 0; x < TileSize; x++)
+                    farthest = std::max(farthest, row[x]);
+            }
+            m_TileMax[(size_t)tileRow * m_TilesX + tileX] = farthest;
+        }
+    }
+
+    bool OcclusionCuller::IsVisible(const glm::vec3& min, const glm::vec3& max) const
+    {
+        glm::vec2 screenMin(FLT_MAX), screenMax(-FLT_MAX);
+        float nearest = FLT_MAX;
+        // Corners are the min corner plus any of the three edge vectors, which stay linear in clip space
+        glm::vec4 corners[8];
+        corners[0] = m_ViewProjection * glm::vec4(min, 1.0f);
+        corners[1] = corners[0] + m_ViewProjection[2] * (max.z - min.z);
+        corners[2] = corners[0] + m_ViewProjection[1] * (max.y - min.y);
+        corners[3] = corners[1] + m_ViewProjection[1] * (max.y - min.y);
+        glm::vec4 dx = m_ViewProjection[0] * (max.x - min.x);
+        for (uint32_t i = 0; i < 4; i++)
+            corners[i + 4] = corners[i] + dx;
+
+        for (const glm::vec4& clip : corners)
+        {
+            if (clip.w < s_NearW)
+                return true;
+
+            glm::vec3 ndc = glm::vec3(clip) / clip.w;
+            screenMin = glm::min(screenMin, glm::vec2(ndc));
+            screenMax = glm::max(screenMax, glm::vec2(ndc));
+            nearest = std::min(nearest, ndc.z);
+        }
+
+        // Every pixel the rectangle touches, not just the centers inside it
+        int32_t x0 = std::max((int32_t)std::floor((screenMin.x * 0.5f + 0.5f) * (float)m_Width), 0);
+        int32_t y0 = std::max((int32_t)std::floor((screenMin.y * 0.5f + 0.5f) * (float)m_Height), 0);
+        int32_t x1 = std::min((int32_t)std::floor((screenMax.x * 0.5f + 0.5f) * (float)m_Width), (int32_t)m_Width - 1);
+        int32_t y1 = std::min((int32_t)std::floor((screenMax.y * 0.5f + 0.5f) * (float)m_Height), (int32_t)m_Height - 1);
+        if (x0 > x1 || y0 > y1)
+            return false;
+
+        for (int32_t tileY = y0 / (int32_t)TileSize; tileY <= y1 / (int32_t)TileSize; tileY++)
+        {
+            for (int32_t tileX = x0 / (int32_t)TileSize; tileX <= x1 / (int32_t)TileSize; tileX++)
+            {
+                // Everything in the tile is nearer than the box
+                if (nearest > m_TileMax[(size_t)tileY * m_TilesX + tileX])
+                    continue;
+
+                int32_t px0 = std::max(x0, tileX * (int32_t)TileSize), px1 = std::min(x1, tileX * (int32_t)TileSize + (int32_t)TileSize - 1);
+                int32_t py0 = std::max(y0, tileY * (int32_t)TileSize), py1 = std::min(y1, tileY * (int32_t)TileSize + (int32_t)TileSize - 1);
+                for (int32_t y = py0; y <= py1; y++)
+                {
+                    const float* row = m_Depth.data() + (size_t)y * m_Width;
+                    for (int32_t x = px0; x <= px1; x++)
+                    {
+                        if (nearest <= row[x])
+                            return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    void OcclusionCuller::Cull(const FrustumCuller& boxes, std::vector<uint32_t>& visible)
+    {
+        uint32_t count = (uint32_t)visible.size();
+        if (count == 0)
+            return;
+
+        uint32_t batches = (count + s_BoxesPerBatch - 1) / s_BoxesPerBatch;
+        m_BatchVisible.resize(batches);
+
+        JobSystem::ParallelFor(count, s_BoxesPerBatch, [&](uint32_t begin, uint32_t end)
+        {
+            auto& out = m_BatchVisible[begin / s_BoxesPerBatch];
+            out.clear();
+            for (uint32_t i = begin; i < end; i++)
+            {
+                glm::vec3 min, max;
+                boxes.GetBounds(visible[i], min, max);
+                if (IsVisible(min, max))
+                    out.push_back(visible[i]);
+            }
+        });
+
+        visible.clear();
+        for (uint32_t batch = 0; batch < batches; batch++)
+            visible.insert(visible.end(), m_BatchVisible[batch].begin(), m_BatchVisible[batch].end());
+    }
+}
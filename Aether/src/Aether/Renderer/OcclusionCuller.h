@@ -0,0 +1,65 @@
+#pragma once
+
+#include "aepch.h"
+
+namespace Aether {
+
+    class FrustumCuller;
+
+    // Software occlusion culling: occluder triangles are rasterized on the CPU into a small depth
+    // buffer split into 8x8 tiles, each keeping the farthest depth it holds, then occludee boxes are
+    // tested tile first and pixel second. No GPU state, so it runs anywhere the JobSystem does.
+    // Occluders should be solid and conservative (never larger than what they stand for).
+    class AETHER_API OcclusionCuller
+    {
+    public:
+        static constexpr uint32_t TileSize = 8;
+
+        // Rounded up to whole tiles; the aspect ratio doesn't need to match the viewport
+        OcclusionCuller(uint32_t width = 320, uint32_t height = 192);
+
+        // Drops last frame's occluders; boxes and triangles are projected with `viewProjection`
+        void BeginFrame(const glm::mat4& viewProjection);
+
+        void AddOccluder(const glm::vec3* positions, const uint32_t* indices, uint32_t indexCount, const glm::mat4& transform);
+        void AddOccluderBox(const glm::vec3& min, const glm::vec3& max, const glm::mat4& transform);
+
+        // Clears and fills the depth buffer, one band of tiles per job
+        void Rasterize();
+
+        // Conservative: boxes crossing the near plane are always visible
+        bool IsVisible(const glm::vec3& min, const glm::vec3& max) const;
+
+        // Keeps the entries of `visible` (indices into `boxes`) that aren't hidden, in order
+        void Cull(const FrustumCuller& boxes, std::vector<uint32_t>& visible);
+
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetHeight() const { return m_Height; }
+        uint32_t GetOccluderTriangleCount() const { return (uint32_t)m_Triangles.size(); }
+        // Row-major from the bottom-left, NDC depth with 1 as far
+        const std::vector<float>& GetDepthBuffer() const { return m_Depth; }
+    private:
+        // Screen-space setup: inside where all three edge functions are >= 0, depth is a plane in x and y
+        struct Triangle
+        {
+            glm::vec3 EdgeA, EdgeB, EdgeC;
+            float DepthDx, DepthDy, Depth0;
+            int32_t MinX, MinY, MaxX, MaxY;
+        };
+
+        void RasterizeBand(uint32_t tileRow);
+        void AddTriangle(const glm::vec4& v0, const glm::vec4& v1, const glm::vec4& v2);
+
+        uint32_t m_Width, m_Height;
+        uint32_t m_TilesX, m_TilesY;
+
+        glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+        std::vector<Triangle> m_Triangles;
+        std::vector<glm::vec4> m_Clip;
+
+        std::vector<float> m_Depth;
+        std::vector<float> m_TileMax;
+
+        std::vector<std::vector<uint32_t>> m_BatchVisible;
+    };
+}
@@ -3,6 +3,6 @@
 
 namespace Aether {
 
-	Scope<RendererAPI> RenderCommand::s_RendererAPI = RendererAPI::Create();
+	Scope<RendererAPI> RenderCommand::s_RendererAPI;
 
 }
\ No newline at end of file
@@ -5,6 +5,7 @@ namespace Aether {
     class AETHER_API RenderCommand {
     public:
         static void Init() {
+            s_RendererAPI = RendererAPI::Create();
             s_RendererAPI->Init();
         }
         
@@ -36,6 +37,16 @@ namespace Aether {
             s_RendererAPI->DrawIndexedBaseVertex(vertexArray, indexCount, indices, baseVertex);
         }
 
+        static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseIndex, int32_t baseVertex, uint32_t instanceCount, uint32_t baseInstance = 0)
+        {
+            s_RendererAPI->DrawIndexedInstanced(vertexArray, indexCount, baseIndex, baseVertex, instanceCount, baseInstance);
+        }
+
+        static bool SupportsBaseInstance()
+        {
+            return s_RendererAPI->SupportsBaseInstance();
+        }
+
 		static void SetLineWidth(float width)
 		{
 			s_RendererAPI->SetLineWidth(width);
@@ -50,6 +61,16 @@ namespace Aether {
         {
             s_RendererAPI->SetViewport(x, y, width, height);
         }
+
+        static uint64_t InsertFence()
+        {
+            return s_RendererAPI->InsertFence();
+        }
+
+        static void WaitFence(uint64_t fence)
+        {
+            s_RendererAPI->WaitFence(fence);
+        }
     private:
         static Scope<RendererAPI> s_RendererAPI;
     };
@@ -0,0 +1,63 @@
+#include "aepch.h"
+#include "Aether/Renderer/RenderCommandQueue.h"
+
+namespace Aether {
+
+    static constexpr size_t AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    RenderCommandQueue::~RenderCommandQueue()
+    {
+        // Commands own their captures; running them is the only way to release those safely
+        AE_CORE_ASSERT(m_CommandCount == 0, "Render command queue destroyed with commands pending!");
+        for (auto& block : m_Blocks)
+            ::operator delete(block.Data, std::align_val_t(s_Alignment));
+    }
+
+    void* RenderCommandQueue::Allocate(CommandFn invoke, uint32_t size)
+    {
+        size_t payloadOffset = AlignUp(sizeof(Header), s_Alignment);
+        size_t entrySize = payloadOffset + AlignUp(size, s_Alignment);
+
+        while (m_CurrentBlock < m_Blocks.size() && m_Blocks[m_CurrentBlock].Used + entrySize > m_Blocks[m_CurrentBlock].Capacity)
+            m_CurrentBlock++;
+
+        if (m_CurrentBlock == m_Blocks.size())
+        {
+            Block block;
+            block.Capacity = std::max(s_BlockSize, entrySize);
+            block.Data = (uint8_t*)::operator new(block.Capacity, std::align_val_t(s_Alignment));
+            m_Blocks.push_back(block);
+        }
+
+        Block& block = m_Blocks[m_CurrentBlock];
+        uint8_t* entry = block.Data + block.Used;
+        block.Used += entrySize;
+        m_CommandCount++;
+
+        new (entry) Header{ invoke, (uint32_t)entrySize };
+        return entry + payloadOffset;
+    }
+
+    void RenderCommandQueue::Execute()
+    {
+        size_t payloadOffset = AlignUp(sizeof(Header), s_Alignment);
+
+        for (size_t i = 0; i <= m_CurrentBlock && i < m_Blocks.size(); i++)
+        {
+            Block& block = m_Blocks[i];
+            for (size_t offset = 0; offset < block.Used;)
+            {
+                auto* header = (Header*)(block.Data + offset);
+                header->Invoke(block.Data + offset + payloadOffset);
+                offset += header->Size;
+            }
+            block.Used = 0;
+        }
+
+        m_CurrentBlock = 0;
+        m_CommandCount = 0;
+    }
+}
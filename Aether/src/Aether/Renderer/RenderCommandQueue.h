@@ -0,0 +1,65 @@
+#pragma once
+
+#include "aepch.h"
+
+namespace Aether {
+
+    // Recorded render work, replayed later in submission order. Commands are closures stored
+    // inline in fixed-size blocks, so recording doesn't allocate once the blocks have grown to
+    // a frame's worth. Not thread-safe: one thread records while nobody replays it.
+    class AETHER_API RenderCommandQueue
+    {
+    public:
+        using CommandFn = void(*)(void*);
+
+        RenderCommandQueue() = default;
+        ~RenderCommandQueue();
+
+        RenderCommandQueue(const RenderCommandQueue&) = delete;
+        RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+        template<typename FuncT>
+        void Submit(FuncT&& func)
+        {
+            using Command = std::decay_t<FuncT>;
+            static_assert(alignof(Command) <= s_Alignment, "Render command is over-aligned!");
+
+            // Runs the command and destroys it in place; the queue never copies closures
+            CommandFn invoke = [](void* storage)
+            {
+                auto* command = (Command*)storage;
+                (*command)();
+                command->~Command();
+            };
+
+            new (Allocate(invoke, sizeof(Command))) Command(std::forward<FuncT>(func));
+        }
+
+        // Replays every command and leaves the queue empty, keeping its blocks
+        void Execute();
+
+        uint32_t GetCommandCount() const { return m_CommandCount; }
+    private:
+        static constexpr size_t s_Alignment = 16;
+        static constexpr size_t s_BlockSize = 1024 * 1024;
+
+        struct Header
+        {
+            CommandFn Invoke;
+            uint32_t Size;
+        };
+
+        struct Block
+        {
+            uint8_t* Data = nullptr;
+            size_t Capacity = 0;
+            size_t Used = 0;
+        };
+
+        void* Allocate(CommandFn invoke, uint32_t size);
+
+        std::vector<Block> m_Blocks;
+        size_t m_CurrentBlock = 0;
+        uint32_t m_CommandCount = 0;
+    };
+}
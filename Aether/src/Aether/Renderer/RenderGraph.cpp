@@ -0,0 +1,207 @@
+#include "aepch.h"
+#include "Aether/Renderer/RenderGraph.h"
+#include "Aether/Renderer/RenderTargetPool.h"
+#include "Aether/Renderer/RenderCommand.h"
+
+namespace Aether {
+
+    void RenderGraph::Builder::Read(const std::string& target)
+    {
+        m_Graph.m_Passes[m_Pass].Reads.push_back(m_Graph.GetTargetIndex(target));
+    }
+
+    void RenderGraph::Builder::Write(const std::string& target)
+    {
+        auto& pass = m_Graph.m_Passes[m_Pass];
+        AE_CORE_ASSERT(pass.Write == s_NoTarget, "A render graph pass writes a single target!");
+        pass.Write = m_Graph.GetTargetIndex(target);
+    }
+
+    const Ref<FrameBuffer>& RenderGraph::Resources::GetTarget(const std::string& name) const
+    {
+        static const Ref<FrameBuffer> s_None;
+        auto it = m_Graph.m_TargetIndices.find(name);
+        return it != m_Graph.m_TargetIndices.end() ? m_Graph.m_Targets[it->second].Instance : s_None;
+    }
+
+    RenderGraph::RenderGraph()
+    {
+        GetTargetIndex(Backbuffer);
+        m_Targets[0].Declared = true;
+    }
+
+    void RenderGraph::AddPass(const std::string& name, const SetupFunc& setup, const ExecuteFunc& execute)
+    {
+        m_Passes.push_back({ name, execute });
+        Builder builder(*this, (uint32_t)m_Passes.size() - 1);
+        setup(builder);
+        m_Dirty = true;
+    }
+
+    void RenderGraph::SetPassEnabled(const std::string& name, bool enabled)
+    {
+        for (auto& pass : m_Passes)
+        {
+            if (pass.Name == name && pass.Enabled != enabled)
+            {
+                pass.Enabled = enabled;
+                m_Dirty = true;
+            }
+        }
+    }
+
+    void RenderGraph::SetTarget(const std::string& name, const FramebufferSpecification& spec, const glm::vec4& clearColor)
+    {
+        auto& target = m_Targets[GetTargetIndex(name)];
+        AE_CORE_ASSERT(target.Name != Backbuffer, "Use SetBackbuffer() for the default framebuffer!");
+        target.Spec = spec;
+        target.ClearColor = clearColor;
+        target.Declared = true;
+    }
+
+    void RenderGraph::SetBackbuffer(uint32_t width, uint32_t height, const glm::vec4& clearColor)
+    {
+        m_BackbufferWidth = width;
+        m_BackbufferHeight = height;
+        m_Targets[0].ClearColor = clearColor;
+    }
+
+    uint32_t RenderGraph::GetTargetIndex(const std::string& name)
+    {
+        auto it = m_TargetIndices.find(name);
+        if (it != m_TargetIndices.end())
+            return it->second;
+
+        uint32_t index = (uint32_t)m_Targets.size();
+        m_Targets.push_back({ name });
+        m_TargetIndices[name] = index;
+        return index;
+    }
+
+    void RenderGraph::Compile()
+    {
+        m_Schedule.clear();
+
+        // Walk back from the roots: a pass survives if a surviving pass reads what it writes.
+        // Writers after the first load the target, so every earlier writer of a needed target is kept too.
+        std::vector<bool> needed(m_Targets.size(), false);
+        std::vector<bool> keep(m_Passes.size(), false);
+        for (size_t i = m_Passes.size(); i-- > 0;)
+        {
+            const auto& pass = m_Passes[i];
+            if (!pass.Enabled)
+                continue;
+
+            bool root = pass.Write == s_NoTarget || pass.Write == 0;
+            if (!root && !needed[pass.Write])
+                continue;
+
+            keep[i] = true;
+            for (uint32_t read : pass.Reads)
+                needed[read] = true;
+            if (pass.Write != s_NoTarget)
+                needed[pass.Write] = true;
+        }
+
+        std::vector<int> firstUse(m_Targets.size(), -1), lastUse(m_Targets.size(), -1);
+        std::vector<bool> written(m_Targets.size(), false);
+        uint32_t bound = s_NoTarget;
+
+        for (uint32_t i = 0; i < (uint32_t)m_Passes.size(); i++)
+        {
+            if (!keep[i])
+                continue;
+
+            const auto& pass = m_Passes[i];
+            int step = (int)m_Schedule.size();
+            m_Schedule.push_back({ i, false, false });
+
+            auto use = [&](uint32_t target)
+            {
+                if (firstUse[target] < 0)
+                    firstUse[target] = step;
+                lastUse[target] = step;
+            };
+
+            for (uint32_t read : pass.Reads)
+            {
+                if (!written[read])
+                    AE_CORE_WARN("RenderGraph: Pass '{0}' reads '{1}' before anything writes it", pass.Name, m_Targets[read].Name);
+                use(read);
+            }
+
+            if (pass.Write != s_NoTarget)
+            {
+                auto& scheduled = m_Schedule.back();
+                scheduled.Bind = pass.Write != bound;
+                scheduled.Clear = !written[pass.Write];
+                written[pass.Write] = true;
+                bound = pass.Write;
+                use(pass.Write);
+            }
+        }
+
+        for (uint32_t target = 1; target < (uint32_t)m_Targets.size(); target++)
+        {
+            if (firstUse[target] < 0)
+                continue;
+
+            AE_CORE_ASSERT(m_Targets[target].Declared, "RenderGraph: Target used without SetTarget()!");
+            m_Schedule[firstUse[target]].Acquire.push_back(target);
+            m_Schedule[lastUse[target]].Release.push_back(target);
+        }
+
+        m_Dirty = false;
+    }
+
+    void RenderGraph::Execute()
+    {
+        if (m_Dirty)
+            Compile();
+
+        Resources resources(*this);
+        Ref<FrameBuffer> bound;
+
+        for (const auto& step : m_Schedule)
+        {
+            const auto& pass = m_Passes[step.Pass];
+
+            for (uint32_t target : step.Acquire)
+                m_Targets[target].Instance = RenderTargetPool::Acquire(m_Targets[target].Spec);
+
+            if (step.Bind)
+            {
+                auto& target = m_Targets[pass.Write];
+                if (target.Instance)
+                {
+                    target.Instance->Bind();
+                    bound = target.Instance;
+                }
+                else
+                {
+                    if (bound)
+                        bound->Unbind();
+                    bound.reset();
+                    RenderCommand::SetViewport(0, 0, m_BackbufferWidth, m_BackbufferHeight);
+                }
+            }
+
+            if (step.Clear)
+            {
+                RenderCommand::SetClearColor(m_Targets[pass.Write].ClearColor);
+                RenderCommand::Clear();
+            }
+
+            pass.Execute(resources);
+
+            for (uint32_t target : step.Release)
+            {
+                RenderTargetPool::Release(m_Targets[target].Instance);
+                m_Targets[target].Instance.reset();
+            }
+        }
+
+        if (bound)
+            bound->Unbind();
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Renderer/FrameBuffer.h"
+
+#include <unordered_map>
+
+namespace Aether {
+
+    // Declarative pass scheduling. Passes name the targets they read and the one they render into;
+    // Execute() culls passes whose output nobody consumes, binds each target only when the next pass
+    // renders elsewhere, clears a target only for its first writer of the frame, and takes transient
+    // targets from RenderTargetPool for exactly their lifetime, so disjoint ones alias. The compiled
+    // schedule is kept until passes or their enabled state change. Render thread only.
+    class AETHER_API RenderGraph
+    {
+    public:
+        // The default framebuffer; passes that write it are the roots everything else is kept for
+        static constexpr const char* Backbuffer = "Backbuffer";
+
+        class Builder
+        {
+        public:
+            void Read(const std::string& target);
+            // One per pass; a pass that writes nothing is always kept
+            void Write(const std::string& target);
+        private:
+            Builder(RenderGraph& graph, uint32_t pass) : m_Graph(graph), m_Pass(pass) {}
+
+            RenderGraph& m_Graph;
+            uint32_t m_Pass;
+
+            friend class RenderGraph;
+        };
+
+        class Resources
+        {
+        public:
+            // Null for the backbuffer, or a target outside the current pass's lifetime
+            const Ref<FrameBuffer>& GetTarget(const std::string& name) const;
+        private:
+            Resources(const RenderGraph& graph) : m_Graph(graph) {}
+
+            const RenderGraph& m_Graph;
+
+            friend class RenderGraph;
+        };
+
+        using SetupFunc = std::function<void(Builder&)>;
+        // Must leave the framebuffer binding alone; the graph owns it
+        using ExecuteFunc = std::function<void(const Resources&)>;
+
+        RenderGraph();
+
+        void AddPass(const std::string& name, const SetupFunc& setup, const ExecuteFunc& execute);
+        void SetPassEnabled(const std::string& name, bool enabled);
+
+        // Declares or updates a transient target. Size and format changes don't recompile the graph.
+        void SetTarget(const std::string& name, const FramebufferSpecification& spec, const glm::vec4& clearColor = glm::vec4(0.0f));
+        void SetBackbuffer(uint32_t width, uint32_t height, const glm::vec4& clearColor);
+
+        void Execute();
+
+        uint32_t GetPassCount() const { return (uint32_t)m_Passes.size(); }
+        // Passes that survived culling in the last compile
+        uint32_t GetScheduledPassCount() const { return (uint32_t)m_Schedule.size(); }
+    private:
+        static constexpr uint32_t s_NoTarget = ~0u;
+
+        struct Target
+        {
+            std::string Name;
+            FramebufferSpecification Spec;
+            glm::vec4 ClearColor = glm::vec4(0.0f);
+            bool Declared = false;
+            // Only while the target is alive during Execute()
+            Ref<FrameBuffer> Instance;
+        };
+
+        struct Pass
+        {
+            std::string Name;
+            ExecuteFunc Execute;
+            std::vector<uint32_t> Reads;
+            uint32_t Write = s_NoTarget;
+            bool Enabled = true;
+        };
+
+        struct Step
+        {
+            uint32_t Pass;
+            bool Bind;
+            bool Clear;
+            std::vector<uint32_t> Acquire;
+            std::vector<uint32_t> Release;
+        };
+
+        uint32_t GetTargetIndex(const std::string& name);
+        void Compile();
+
+        std::vector<Target> m_Targets;
+        std::unordered_map<std::string, uint32_t> m_TargetIndices;
+        std::vector<Pass> m_Passes;
+
+        std::vector<Step> m_Schedule;
+        bool m_Dirty = true;
+
+        uint32_t m_BackbufferWidth = 0, m_BackbufferHeight = 0;
+    };
+}
@@ -0,0 +1,119 @@
+#include "aepch.h"
+#include "Aether/Renderer/RenderTargetPool.h"
+
+namespace Aether {
+
+    // Long enough to ride out a resize drag or a toggled effect without recreating
+    static constexpr uint32_t s_MaxIdleFrames = 4;
+
+    namespace Utils {
+
+        static bool IsSameKey(const FramebufferSpecification& a, const FramebufferSpecification& b)
+        {
+            if (a.Width != b.Width || a.Height != b.Height || a.Samples != b.Samples || a.Layers != b.Layers)
+                return false;
+
+            const auto& attachmentsA = a.Attachments.Attachments;
+            const auto& attachmentsB = b.Attachments.Attachments;
+            if (attachmentsA.size() != attachmentsB.size())
+                return false;
+
+            for (size_t i = 0; i < attachmentsA.size(); i++)
+            {
+                if (attachmentsA[i].TextureFormat != attachmentsB[i].TextureFormat)
+                    return false;
+            }
+            return true;
+        }
+    }
+
+    struct PooledTarget
+    {
+        Ref<FrameBuffer> Target;
+        uint32_t LastUsedFrame = 0;
+        bool InUse = false;
+    };
+
+    struct RenderTargetPoolData
+    {
+        std::vector<PooledTarget> Targets;
+        uint32_t Frame = 0;
+    };
+
+    static RenderTargetPoolData& GetData()
+    {
+        static RenderTargetPoolData s_Data;
+        return s_Data;
+    }
+
+    Ref<FrameBuffer> RenderTargetPool::Acquire(const FramebufferSpecification& spec)
+    {
+        AE_CORE_ASSERT(!spec.SwapChainTarget, "The swap chain target can't be pooled!");
+
+        auto& data = GetData();
+        for (auto& pooled : data.Targets)
+        {
+            if (!pooled.InUse && Utils::IsSameKey(pooled.Target->GetSpecification(), spec))
+            {
+                pooled.InUse = true;
+                pooled.LastUsedFrame = data.Frame;
+                return pooled.Target;
+            }
+        }
+
+        auto target = FrameBuffer::Create(spec);
+        if (!target)
+            return nullptr;
+
+        data.Targets.push_back({ target, data.Frame, true });
+        return target;
+    }
+
+    void RenderTargetPool::Release(const Ref<FrameBuffer>& target)
+    {
+        if (!target)
+            return;
+
+        auto& data = GetData();
+        for (auto& pooled : data.Targets)
+        {
+            if (pooled.Target == target)
+            {
+                AE_CORE_ASSERT(pooled.InUse, "Render target released twice!");
+                pooled.InUse = false;
+                pooled.LastUsedFrame = data.Frame;
+                return;
+            }
+        }
+
+        AE_CORE_ASSERT(false, "Releasing a render target the pool doesn't own!");
+    }
+
+    void RenderTargetPool::Update()
+    {
+        auto& data = GetData();
+        data.Frame++;
+
+        auto& targets = data.Targets;
+        targets.erase(std::remove_if(targets.begin(), targets.end(), [&](const PooledTarget& pooled)
+        {
+            return !pooled.InUse && data.Frame - pooled.LastUsedFrame > s_MaxIdleFrames;
+        }), targets.end());
+    }
+
+    void RenderTargetPool::Shutdown()
+    {
+        GetData().Targets.clear();
+    }
+
+    uint32_t RenderTargetPool::GetTargetCount()
+    {
+        return (uint32_t)GetData().Targets.size();
+    }
+
+    uint32_t RenderTargetPool::GetTargetsInUse()
+    {
+        const auto& targets = GetData().Targets;
+        return (uint32_t)std::count_if(targets.begin(), targets.end(), [](const PooledTarget& pooled) { return pooled.InUse; });
+    }
+}
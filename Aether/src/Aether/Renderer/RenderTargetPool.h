@@ -0,0 +1,27 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Renderer/FrameBuffer.h"
+
+namespace Aether {
+
+    // Transient framebuffers keyed by size, attachment formats and sample count. Acquire() hands
+    // out a released target with the same key before creating one, so targets whose lifetimes
+    // don't overlap share storage, and resizes or effect toggles stop reallocating attachments.
+    // Thread that owns the GL context only.
+    class AETHER_API RenderTargetPool
+    {
+    public:
+        static Ref<FrameBuffer> Acquire(const FramebufferSpecification& spec);
+        // The contents may be overwritten by the next Acquire() of the same key, even this frame
+        static void Release(const Ref<FrameBuffer>& target);
+
+        // Submitted once per frame by Application; destroys targets nobody acquired for a few frames
+        static void Update();
+        // Destroys every pooled target; called by Renderer::Shutdown() while the context is alive
+        static void Shutdown();
+
+        static uint32_t GetTargetCount();
+        static uint32_t GetTargetsInUse();
+    };
+}
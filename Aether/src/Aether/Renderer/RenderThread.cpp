@@ -0,0 +1,217 @@
+#include "aepch.h"
+#include "Aether/Renderer/RenderThread.h"
+#include "Aether/Renderer/Renderer.h"
+#include "Aether/Renderer/GraphicsContext.h"
+
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+namespace Aether {
+
+    namespace {
+
+        struct RenderThreadData
+        {
+            ThreadingPolicy Policy = ThreadingPolicy::SingleThreaded;
+            GraphicsContext* Context = nullptr;
+
+            std::array<RenderCommandQueue, 2> Queues;
+            uint32_t SubmitQueue = 0;
+            uint64_t Frame = 0;
+
+            // GPU fences of the last frames replayed, by frame slot; 0 when none is pending
+            std::array<uint64_t, Renderer::FramesInFlight> Fences{};
+
+            std::thread Thread;
+            std::thread::id ThreadID;
+            std::mutex Mutex;
+            std::condition_variable Condition;
+            bool Running = false;
+            bool Busy = false;
+            uint32_t ReplayQueue = 0;
+            uint64_t ReplayFrame = 0;
+
+            // Render thread side; set for the duration of Replay()
+            bool Replaying = false;
+            uint64_t ReplayingFrame = 0;
+        };
+
+        RenderThreadData& GetData()
+        {
+            static RenderThreadData s_Data;
+            return s_Data;
+        }
+    }
+
+    void RenderThread::Init(ThreadingPolicy policy, GraphicsContext* context)
+    {
+        auto& data = GetData();
+        data.Policy = policy;
+        data.Context = context;
+
+        if (policy == ThreadingPolicy::SingleThreaded)
+            return;
+
+        // The context can only be current on one thread
+        if (context)
+            context->MakeCurrent(false);
+
+        data.Running = true;
+        data.Thread = std::thread(&RenderThread::ThreadLoop, context);
+        data.ThreadID = data.Thread.get_id();
+
+        AE_CORE_INFO("RenderThread: Replaying frames on a dedicated thread");
+    }
+
+    void RenderThread::Shutdown()
+    {
+        auto& data = GetData();
+
+        if (data.Policy == ThreadingPolicy::MultiThreaded)
+        {
+            WaitIdle();
+            {
+                std::lock_guard<std::mutex> lock(data.Mutex);
+                data.Running = false;
+            }
+            data.Condition.notify_all();
+            data.Thread.join();
+
+            if (data.Context)
+                data.Context->MakeCurrent(true);
+            data.Policy = ThreadingPolicy::SingleThreaded;
+        }
+
+        // Whatever was recorded after the last kick, e.g. by layers shutting down
+        Replay(data.SubmitQueue, data.Frame++);
+
+        for (auto& fence : data.Fences)
+        {
+            if (fence)
+                RenderCommand::WaitFence(fence);
+            fence = 0;
+        }
+    }
+
+    bool RenderThread::IsMultiThreaded()
+    {
+        return GetData().Policy == ThreadingPolicy::MultiThreaded;
+    }
+
+    bool RenderThread::IsRenderThread()
+    {
+        auto& data = GetData();
+        return data.Policy == ThreadingPolicy::SingleThreaded || std::this_thread::get_id() == data.ThreadID;
+    }
+
+    void RenderThread::Kick()
+    {
+        auto& data = GetData();
+        uint32_t queue = data.SubmitQueue;
+        uint64_t frame = data.Frame;
+
+        if (data.Policy == ThreadingPolicy::SingleThreaded)
+        {
+            // Swap first, so commands recorded while replaying land in the next frame
+            data.SubmitQueue ^= 1;
+            data.Frame++;
+            Replay(queue, frame);
+            return;
+        }
+
+        WaitIdle();
+        {
+            std::lock_guard<std::mutex> lock(data.Mutex);
+            data.SubmitQueue ^= 1;
+            data.Frame++;
+            data.ReplayQueue = queue;
+            data.ReplayFrame = frame;
+            data.Busy = true;
+        }
+        data.Condition.notify_all();
+    }
+
+    void RenderThread::WaitIdle()
+    {
+        auto& data = GetData();
+        if (data.Policy == ThreadingPolicy::SingleThreaded)
+            return;
+
+        std::unique_lock<std::mutex> lock(data.Mutex);
+        data.Condition.wait(lock, [&data]() { return !data.Busy; });
+    }
+
+    RenderCommandQueue& RenderThread::GetSubmitQueue()
+    {
+        auto& data = GetData();
+        return data.Queues[data.SubmitQueue];
+    }
+
+    uint64_t RenderThread::GetFrameIndex()
+    {
+        return GetData().Frame;
+    }
+
+    uint64_t RenderThread::GetReplayFrameIndex()
+    {
+        auto& data = GetData();
+        AE_CORE_ASSERT(data.Replaying, "RenderThread: No frame is replaying!");
+        return data.ReplayingFrame;
+    }
+
+    void RenderThread::ThreadLoop(GraphicsContext* context)
+    {
+        auto& data = GetData();
+        if (context)
+            context->MakeCurrent(true);
+
+        while (true)
+        {
+            uint32_t queue;
+            uint64_t frame;
+            {
+                std::unique_lock<std::mutex> lock(data.Mutex);
+                data.Condition.wait(lock, [&data]() { return data.Busy || !data.Running; });
+                if (!data.Busy)
+                    break;
+                queue = data.ReplayQueue;
+                frame = data.ReplayFrame;
+            }
+
+            Replay(queue, frame);
+
+            {
+                std::lock_guard<std::mutex> lock(data.Mutex);
+                data.Busy = false;
+            }
+            data.Condition.notify_all();
+        }
+
+        if (context)
+            context->MakeCurrent(false);
+    }
+
+    void RenderThread::Replay(uint32_t queue, uint64_t frame)
+    {
+        auto& data = GetData();
+        data.Replaying = true;
+        data.ReplayingFrame = frame;
+        data.Queues[queue].Execute();
+        data.Replaying = false;
+
+        data.Fences[frame % Renderer::FramesInFlight] = RenderCommand::InsertFence();
+
+        // Recording of the next frame may already be running (multi-threaded) or starts right
+        // after this (single-threaded); either way the GPU must be done with the frame that
+        // last used the slot it will write
+        uint64_t lag = data.Policy == ThreadingPolicy::MultiThreaded ? Renderer::FramesInFlight - 2 : Renderer::FramesInFlight - 1;
+        if (frame >= lag)
+        {
+            uint64_t& fence = data.Fences[(frame - lag) % Renderer::FramesInFlight];
+            if (fence)
+                RenderCommand::WaitFence(fence);
+            fence = 0;
+        }
+    }
+}
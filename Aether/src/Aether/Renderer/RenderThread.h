@@ -0,0 +1,49 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Renderer/RenderCommandQueue.h"
+
+namespace Aether {
+
+    class GraphicsContext;
+
+    enum class ThreadingPolicy
+    {
+        // Recorded commands replay on the main thread at the end of each frame
+        SingleThreaded = 0,
+        // A render thread owns the context and replays frame N while the main thread records N + 1.
+        // Every GPU call must then go through Renderer::Submit.
+        MultiThreaded
+    };
+
+    // Owns the two command queues behind Renderer::Submit: the main thread records into one while
+    // the other replays. After replaying a frame it fences the GPU, so that once recording of
+    // frame N starts, frame N - Renderer::FramesInFlight has finished on the GPU and per-frame
+    // data in that slot can be overwritten.
+    class AETHER_API RenderThread
+    {
+    public:
+        // Main thread. With MultiThreaded, `context` is made current on the render thread instead.
+        static void Init(ThreadingPolicy policy, GraphicsContext* context);
+        // Replays whatever is still recorded and hands the context back to the main thread
+        static void Shutdown();
+
+        static bool IsMultiThreaded();
+        // The thread GPU calls belong to; the main thread when single-threaded
+        static bool IsRenderThread();
+
+        // Main thread, once per frame after recording: waits for the previous frame's replay,
+        // swaps the queues and starts replaying this frame
+        static void Kick();
+        static void WaitIdle();
+
+        static RenderCommandQueue& GetSubmitQueue();
+        // Frame currently being recorded
+        static uint64_t GetFrameIndex();
+        // Frame whose commands are replaying; only valid inside a submitted command
+        static uint64_t GetReplayFrameIndex();
+    private:
+        static void ThreadLoop(GraphicsContext* context);
+        static void Replay(uint32_t queue, uint64_t frame);
+    };
+}
@@ -1,22 +1,38 @@
 #include "aepch.h"
 #include "Aether/Renderer/Renderer.h"
+#include "Aether/Renderer/RenderTargetPool.h"
+#include "Platform/Null/NullRendererAPI.h"
 
 namespace Aether {
 
 	Scope<Renderer::SceneData> Renderer::s_SceneData = CreateScope<Renderer::SceneData>();
+	Ref<RingBuffer> Renderer::s_RingBuffer;
+
+	static constexpr uint64_t s_RingBufferFrameSize = 4 * 1024 * 1024;
 
 	void Renderer::Init()
 	{
 		RenderCommand::Init();
+		s_RingBuffer = RingBuffer::Create(s_RingBufferFrameSize);
 	}
 
 	void Renderer::Shutdown()
 	{
-		
+		RenderTargetPool::Shutdown();
+		s_RingBuffer.reset();
+
+		if (GetAPI() == RendererAPI::API::Null)
+		{
+			const auto& stats = NullRendererAPI::GetStats();
+			uint64_t frames = std::max<uint64_t>(stats.Frames, 1);
+			AE_CORE_INFO("Null renderer: {0} frames, {1} draws/frame, {2} instances/frame, {3} state changes/frame, {4} uniform updates/frame, {5} clears/frame",
+				stats.Frames, stats.DrawCalls / frames, stats.Instances / frames, stats.StateChanges / frames, stats.UniformUpdates / frames, stats.Clears / frames);
+			AE_CORE_INFO("Null renderer: {0} bytes uploaded, {1} resources created", stats.BytesUploaded, stats.ResourcesCreated);
+		}
 	}
 
 	void Renderer::OnWindowResize(uint32_t width, uint32_t height)
 	{
-		RenderCommand::SetViewport(0, 0, width, height);
+		Submit([width, height]() { RenderCommand::SetViewport(0, 0, width, height); });
 	}
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Aether/Renderer/RenderCommand.h"
+#include "Aether/Renderer/RenderThread.h"
+#include "Aether/Renderer/RingBuffer.h"
 #include "Aether/Resources/Shader.h"
 
 namespace Aether {
@@ -14,6 +16,24 @@ namespace Aether {
 		static void OnWindowResize(uint32_t width, uint32_t height);
 
 		static RendererAPI::API GetAPI() { return RendererAPI::GetAPI(); }
+
+		// Per-frame dynamic data is kept this many times over; see RenderThread
+		static constexpr uint32_t FramesInFlight = 3;
+
+		// Records GPU work for the render thread. Captures are copied, so anything the main
+		// thread keeps changing must be passed by value.
+		template<typename FuncT>
+		static void Submit(FuncT&& func)
+		{
+			RenderThread::GetSubmitQueue().Submit(std::forward<FuncT>(func));
+		}
+
+		static uint64_t GetFrameIndex() { return RenderThread::GetFrameIndex(); }
+		// Which copy of per-frame data the frame being recorded may write
+		static uint32_t GetFrameSlot() { return (uint32_t)(GetFrameIndex() % FramesInFlight); }
+
+		// Shared per-frame stream memory; see RingBuffer
+		static RingBuffer& GetRingBuffer() { return *s_RingBuffer; }
 	private:
 		struct SceneData
 		{
@@ -21,5 +41,6 @@ namespace Aether {
 		};
 
 		static Scope<SceneData> s_SceneData;
+		static Ref<RingBuffer> s_RingBuffer;
 	};
 }
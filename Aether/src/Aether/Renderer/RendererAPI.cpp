@@ -2,6 +2,7 @@
 #include "Aether/Renderer/RendererAPI.h"
 
 #include "Platform/OpenGL/OpenGLRendererAPI.h"
+#include "Platform/Null/NullRendererAPI.h"
 
 namespace Aether {
 
@@ -13,6 +14,7 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLRendererAPI>();
+			case RendererAPI::API::Null:    return CreateScope<NullRendererAPI>();
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
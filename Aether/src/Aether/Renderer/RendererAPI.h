@@ -9,7 +9,8 @@ namespace Aether {
     {
     public:
         enum class API {
-            None = 0, OpenGL = 1
+            // Null records calls without a GPU, for headless benchmarks and CI
+            None = 0, OpenGL = 1, Null = 2
         };
 
     public:
@@ -24,10 +25,20 @@ namespace Aether {
         virtual void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount) = 0;
 		virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) = 0;
         virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, void* indices, int32_t baseVertex) = 0;
+        // Instances [baseInstance, baseInstance + instanceCount) of a submesh; a non-zero baseInstance needs SupportsBaseInstance()
+        virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseIndex, int32_t baseVertex, uint32_t instanceCount, uint32_t baseInstance) = 0;
+        virtual bool SupportsBaseInstance() const = 0;
 		
 		virtual void SetLineWidth(float width) = 0;
+
+		// Marks the end of the work submitted so far; WaitFence blocks until the GPU reaches it
+		// and releases it. 0 stands for a fence that is already signaled.
+		virtual uint64_t InsertFence() = 0;
+		virtual void WaitFence(uint64_t fence) = 0;
         
         static API GetAPI() { return s_API; }
+        // Only before the Application is created; the window and every GPU object follow it
+        static void SetAPI(API api) { s_API = api; }
         static Scope<RendererAPI> Create();
     private:
         static API s_API;
@@ -0,0 +1,23 @@
+#include "aepch.h"
+#include "RingBuffer.h"
+
+#include "Aether/Renderer/Renderer.h"
+#include "Platform/OpenGL/OpenGLRingBuffer.h"
+#include "Platform/Null/NullBuffer.h"
+
+namespace Aether {
+
+	Ref<RingBuffer> RingBuffer::Create(uint64_t frameSize)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLRingBuffer>(frameSize);
+			case RendererAPI::API::Null:    return CreateRef<NullRingBuffer>(frameSize);
+		}
+
+		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "aepch.h"
+
+namespace Aether {
+
+	// A slice of the current frame's ring region. Data stays writable until the frame has replayed.
+	struct RingAllocation
+	{
+		void* Data = nullptr;
+		uint32_t BufferID = 0;
+		uint64_t Offset = 0;
+		uint64_t Size = 0;
+
+		explicit operator bool() const { return Data != nullptr; }
+
+		RingAllocation Slice(uint64_t offset, uint64_t size) const
+		{
+			RingAllocation slice = *this;
+			slice.Data = (uint8_t*)Data + offset;
+			slice.Offset = Offset + offset;
+			slice.Size = size;
+			return slice;
+		}
+	};
+
+	// Mapped once for the lifetime of the app and split into Renderer::FramesInFlight regions.
+	// Each replayed frame bump-allocates from its own region, and the render thread's per-frame
+	// fences guarantee the GPU is done with a region before it comes around again, so writes
+	// never stall on the driver. Instance, uniform and other per-frame stream data go here.
+	// Render thread only, from inside submitted commands.
+	class AETHER_API RingBuffer
+	{
+	public:
+		virtual ~RingBuffer() = default;
+
+		// Empty when this frame's region is exhausted; `alignment` must be a power of two
+		virtual RingAllocation Allocate(uint64_t size, uint64_t alignment = 16) = 0;
+
+		// Call after writing. Free with a coherent persistent mapping; an upload of the range otherwise.
+		virtual void Commit(const RingAllocation& allocation) = 0;
+
+		// Binds the range to a uniform block binding. Allocate with GetUniformAlignment().
+		virtual void BindUniform(uint32_t binding, const RingAllocation& allocation) = 0;
+
+		virtual uint64_t GetFrameCapacity() const = 0;
+		virtual uint64_t GetUniformAlignment() const = 0;
+
+		// `frameSize` bytes per frame in flight
+		static Ref<RingBuffer> Create(uint64_t frameSize);
+	};
+
+}
@@ -0,0 +1,23 @@
+#include "aepch.h"
+#include "StagingBuffer.h"
+
+#include "Aether/Renderer/Renderer.h"
+#include "Platform/OpenGL/OpenGLStagingBuffer.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
+
+namespace Aether {
+
+	Ref<StagingBuffer> StagingBuffer::Create(uint64_t size)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:  return OpenGLExtensions::PersistentMapping ? CreateRef<OpenGLStagingBuffer>(size) : nullptr;
+			case RendererAPI::API::Null:    return nullptr;
+		}
+
+		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "aepch.h"
+
+namespace Aether {
+
+	// A slice of staging memory. Data is CPU-writable from any thread until the
+	// allocation is handed back through StagingBuffer::Release().
+	struct StagingAllocation
+	{
+		void* Data = nullptr;
+		uint32_t BufferID = 0;
+		uint64_t Offset = 0;
+		uint64_t Size = 0;
+		// Offset of the block this slice belongs to; identifies it on Release()
+		uint64_t Block = 0;
+
+		explicit operator bool() const { return Data != nullptr; }
+
+		StagingAllocation Slice(uint64_t offset, uint64_t size) const
+		{
+			StagingAllocation slice = *this;
+			slice.Data = (uint8_t*)Data + offset;
+			slice.Offset = Offset + offset;
+			slice.Size = size;
+			return slice;
+		}
+	};
+
+	// Persistently mapped upload ring. Workers allocate and fill blocks directly; the main
+	// thread issues the GPU copies, then releases each block behind a fence. Space comes
+	// back in allocation order once those fences signal.
+	class AETHER_API StagingBuffer
+	{
+	public:
+		virtual ~StagingBuffer() = default;
+
+		// Any thread. Returns an empty allocation when the ring is full
+		virtual StagingAllocation Allocate(uint64_t size) = 0;
+
+		// Render thread, after the commands reading the block have been issued
+		virtual void Release(const StagingAllocation& allocation) = 0;
+
+		// Render thread, once per frame: recycles blocks the GPU has finished with
+		virtual void Reclaim() = 0;
+
+		virtual uint64_t GetCapacity() const = 0;
+
+		// Null when the backend can't map buffers persistently; callers upload from client memory instead
+		static Ref<StagingBuffer> Create(uint64_t size);
+	};
+
+}
@@ -0,0 +1,272 @@
+#include "aepch.h"
+#include "Aether/Renderer/TriangleBVH.h"
+
+namespace Aether {
+
+    static constexpr uint32_t s_BuildBins = 8;
+    // Leaves this small aren't worth pricing a split for
+    static constexpr uint32_t s_MinSplitTriangles = 2;
+    static constexpr uint32_t s_StackSize = 64;
+    // Nodes this deep stay leaves, so a traversal never holds more than s_StackSize entries
+    static constexpr uint32_t s_MaxDepth = s_StackSize - 2;
+
+    TriangleBVH::TriangleBVH(const float* positions, uint32_t vertexCount, const uint32_t* indices, const std::vector<TriangleRange>& submeshes)
+    {
+        auto vertex = [positions](uint32_t i) { return glm::vec3(positions[3 * i], positions[3 * i + 1], positions[3 * i + 2]); };
+
+        for (uint32_t submesh = 0; submesh < (uint32_t)submeshes.size(); submesh++)
+        {
+            const TriangleRange& range = submeshes[submesh];
+            for (uint32_t i = 0; i + 2 < range.IndexCount; i += 3)
+            {
+                uint32_t corners[3];
+                bool valid = true;
+                for (uint32_t k = 0; k < 3; k++)
+                {
+                    corners[k] = range.BaseVertex + indices[range.BaseIndex + i + k];
+                    valid &= corners[k] < vertexCount;
+                }
+                if (!valid)
+                {
+                    AE_CORE_WARN("TriangleBVH: submesh {0} indexes past its {1} vertices, skipping a triangle", submesh, vertexCount);
+                    continue;
+                }
+
+                glm::vec3 v0 = vertex(corners[0]), v1 = vertex(corners[1]), v2 = vertex(corners[2]);
+                m_Triangles.push_back({ v0, v1 - v0, v2 - v0, submesh, i / 3 });
+            }
+        }
+
+        m_Nodes.reserve(std::max<size_t>(2 * m_Triangles.size(), 1));
+        m_Nodes.emplace_back();
+        m_Nodes[0].Count = (uint32_t)m_Triangles.size();
+        if (m_Triangles.empty())
+            return;
+
+        // Kept in step with m_Triangles while partitioning; box centers stand in for centroids
+        std::vector<AABB> bounds(m_Triangles.size());
+        for (size_t i = 0; i < m_Triangles.size(); i++)
+        {
+            const Triangle& tri = m_Triangles[i];
+            glm::vec3 v1 = tri.V0 + tri.Edge1, v2 = tri.V0 + tri.Edge2;
+            bounds[i] = { glm::min(tri.V0, glm::min(v1, v2)), glm::max(tri.V0, glm::max(v1, v2)) };
+        }
+
+        UpdateBounds(0, bounds);
+        Subdivide(0, bounds, 0);
+    }
+
+    void TriangleBVH::UpdateBounds(uint32_t index, const std::vector<AABB>& bounds)
+    {
+        Node& node = m_Nodes[index];
+        node.Box = AABB();
+        for (uint32_t i = node.LeftOrFirst; i < node.LeftOrFirst + node.Count; i++)
+            node.Box = AABB::Union(node.Box, bounds[i]);
+    }
+
+    void TriangleBVH::Subdivide(uint32_t index, std::vector<AABB>& bounds, uint32_t depth)
+    {
+        uint32_t first = m_Nodes[index].LeftOrFirst;
+        uint32_t count = m_Nodes[index].Count;
+        if (count <= s_MinSplitTriangles || depth >= s_MaxDepth)
+            return;
+
+        // Centroids are kept doubled (Min + Max) to save the multiply
+        AABB centroidBounds;
+        for (uint32_t i = first; i < first + count; i++)
+        {
+            glm::vec3 centroid = bounds[i].Min + bounds[i].Max;
+            centroidBounds.Min = glm::min(centroidBounds.Min, centroid);
+            centroidBounds.Max = glm::max(centroidBounds.Max, centroid);
+        }
+
+        // Best binned split over all three axes
+        int bestAxis = -1;
+        uint32_t bestSplit = 0;
+        float bestCost = FLT_MAX;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float extent = centroidBounds.Max[axis] - centroidBounds.Min[axis];
+            if (extent <= 0.0f)
+                continue;
+
+            struct Bin
+            {
+                AABB Box;
+                uint32_t Count = 0;
+            };
+            std::array<Bin, s_BuildBins> bins;
+
+            float scale = (float)s_BuildBins / extent;
+            for (uint32_t i = first; i < first + count; i++)
+            {
+                float centroid = bounds[i].Min[axis] + bounds[i].Max[axis];
+                uint32_t b = std::min((uint32_t)((centroid - centroidBounds.Min[axis]) * scale), s_BuildBins - 1);
+                bins[b].Box = AABB::Union(bins[b].Box, bounds[i]);
+                bins[b].Count++;
+            }
+
+            std::array<float, s_BuildBins> rightCost;
+            AABB rightBox;
+            uint32_t rightCount = 0;
+            for (uint32_t i = s_BuildBins - 1; i > 0; i--)
+            {
+                rightBox = AABB::Union(rightBox, bins[i].Box);
+                rightCount += bins[i].Count;
+                rightCost[i] = rightCount ? rightBox.SurfaceArea() * rightCount : 0.0f;
+            }
+
+            AABB leftBox;
+            uint32_t leftCount = 0;
+            for (uint32_t i = 0; i + 1 < s_BuildBins; i++)
+            {
+                leftBox = AABB::Union(leftBox, bins[i].Box);
+                leftCount += bins[i].Count;
+                if (leftCount == 0 || leftCount == count)
+                    continue;
+
+                float cost = leftBox.SurfaceArea() * leftCount + rightCost[i + 1];
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = i;
+                }
+            }
+        }
+
+        // Splitting has to beat testing every triangle here
+        if (bestAxis < 0 || bestCost >= m_Nodes[index].Box.SurfaceArea() * count)
+            return;
+
+        float scale = (float)s_BuildBins / (centroidBounds.Max[bestAxis] - centroidBounds.Min[bestAxis]);
+        uint32_t i = first;
+        uint32_t j = first + count - 1;
+        while (i <= j)
+        {
+            float centroid = bounds[i].Min[bestAxis] + bounds[i].Max[bestAxis];
+            uint32_t b = std::min((uint32_t)((centroid - centroidBounds.Min[bestAxis]) * scale), s_BuildBins - 1);
+            if (b <= bestSplit)
+                i++;
+            else
+            {
+                std::swap(m_Triangles[i], m_Triangles[j]);
+                std::swap(bounds[i], bounds[j]);
+                j--;
+            }
+        }
+
+        uint32_t leftCount = i - first;
+        if (leftCount == 0 || leftCount == count)
+            return;
+
+        uint32_t left = (uint32_t)m_Nodes.size();
+        m_Nodes.emplace_back();
+        m_Nodes.emplace_back();
+        m_Nodes[left].LeftOrFirst = first;
+        m_Nodes[left].Count = leftCount;
+        m_Nodes[left + 1].LeftOrFirst = i;
+        m_Nodes[left + 1].Count = count - leftCount;
+        m_Nodes[index].LeftOrFirst = left;
+        m_Nodes[index].Count = 0;
+
+        UpdateBounds(left, bounds);
+        UpdateBounds(left + 1, bounds);
+        Subdivide(left, bounds, depth + 1);
+        Subdivide(left + 1, bounds, depth + 1);
+    }
+
+    bool TriangleBVH::RayCast(const Ray& ray, float maxDistance, TriangleHit& hit) const
+    {
+        if (m_Triangles.empty())
+            return false;
+
+        glm::vec3 invDirection = 1.0f / ray.Direction;
+        float closest = maxDistance;
+        bool found = false;
+
+        struct Entry
+        {
+            uint32_t Node;
+            float Distance;
+        };
+        Entry stack[s_StackSize];
+        uint32_t count = 0;
+
+        float distance;
+        if (!Ray::Intersects(m_Nodes[0].Box, ray.Origin, invDirection, closest, distance))
+            return false;
+        stack[count++] = { 0, distance };
+
+        while (count > 0)
+        {
+            Entry entry = stack[--count];
+            if (entry.Distance > closest)
+                continue;
+
+            const Node& node = m_Nodes[entry.Node];
+            if (node.Count > 0)
+            {
+                // Moller-Trumbore, both faces
+                for (uint32_t i = node.LeftOrFirst; i < node.LeftOrFirst + node.Count; i++)
+                {
+                    const Triangle& tri = m_Triangles[i];
+                    glm::vec3 h = glm::cross(ray.Direction, tri.Edge2);
+                    float a = glm::dot(tri.Edge1, h);
+                    if (a == 0.0f)
+                        continue;
+
+                    float f = 1.0f / a;
+                    glm::vec3 s = ray.Origin - tri.V0;
+                    float u = f * glm::dot(s, h);
+                    if (u < 0.0f || u > 1.0f)
+                        continue;
+
+                    glm::vec3 q = glm::cross(s, tri.Edge1);
+                    float v = f * glm::dot(ray.Direction, q);
+                    if (v < 0.0f || u + v > 1.0f)
+                        continue;
+
+                    float t = f * glm::dot(tri.Edge2, q);
+                    if (t < 0.0f || t > closest)
+                        continue;
+
+                    closest = t;
+                    hit.Distance = t;
+                    hit.Submesh = tri.Submesh;
+                    hit.Triangle = tri.Index;
+                    hit.U = u;
+                    hit.V = v;
+                    found = true;
+                }
+                continue;
+            }
+
+            uint32_t left = node.LeftOrFirst, right = left + 1;
+            float d1, d2;
+            bool hit1 = Ray::Intersects(m_Nodes[left].Box, ray.Origin, invDirection, closest, d1);
+            bool hit2 = Ray::Intersects(m_Nodes[right].Box, ray.Origin, invDirection, closest, d2);
+
+            // The nearer child goes on top so it's visited first
+            AE_CORE_ASSERT(count + 2 <= s_StackSize, "Triangle BVH is too deep!");
+            if (hit1 && hit2)
+            {
+                if (d1 <= d2)
+                {
+                    stack[count++] = { right, d2 };
+                    stack[count++] = { left, d1 };
+                }
+                else
+                {
+                    stack[count++] = { left, d1 };
+                    stack[count++] = { right, d2 };
+                }
+            }
+            else if (hit1)
+                stack[count++] = { left, d1 };
+            else if (hit2)
+                stack[count++] = { right, d2 };
+        }
+        return found;
+    }
+}
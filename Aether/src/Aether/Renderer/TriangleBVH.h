@@ -0,0 +1,67 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Renderer/Bounds.h"
+
+namespace Aether {
+
+    // Triangles of one submesh: indices[BaseIndex, BaseIndex + IndexCount) offset by BaseVertex
+    struct TriangleRange
+    {
+        uint32_t BaseVertex = 0;
+        uint32_t BaseIndex = 0;
+        uint32_t IndexCount = 0;
+    };
+
+    struct TriangleHit
+    {
+        float Distance = 0.0f;
+        uint32_t Submesh = 0;
+        // Index of the triangle within its submesh
+        uint32_t Triangle = 0;
+        // Barycentrics of the hit: weight of the second and third vertex
+        float U = 0.0f, V = 0.0f;
+    };
+
+    // Static binned-SAH hierarchy over a mesh's triangles in model space, for CPU ray queries such
+    // as editor picking. Built once (at import, on a worker) and immutable afterwards, so queries
+    // are safe from any thread.
+    class AETHER_API TriangleBVH
+    {
+    public:
+        // `positions` holds xyz per vertex
+        TriangleBVH(const float* positions, uint32_t vertexCount, const uint32_t* indices, const std::vector<TriangleRange>& submeshes);
+
+        // Nearest hit on either face within `maxDistance`, in multiples of the ray direction
+        bool RayCast(const Ray& ray, float maxDistance, TriangleHit& hit) const;
+
+        const AABB& GetBounds() const { return m_Nodes[0].Box; }
+        uint32_t GetTriangleCount() const { return (uint32_t)m_Triangles.size(); }
+        uint32_t GetNodeCount() const { return (uint32_t)m_Nodes.size(); }
+        uint64_t GetMemorySize() const { return m_Nodes.size() * sizeof(Node) + m_Triangles.size() * sizeof(Triangle); }
+    private:
+        struct Node
+        {
+            AABB Box;
+            // Leaves: first triangle; interior nodes: the left child, with the right one after it
+            uint32_t LeftOrFirst = 0;
+            // Triangles in a leaf, 0 for interior nodes
+            uint32_t Count = 0;
+        };
+
+        // Stored as a corner and two edges, the form the intersection test wants
+        struct Triangle
+        {
+            glm::vec3 V0, Edge1, Edge2;
+            uint32_t Submesh;
+            uint32_t Index;
+        };
+
+        // `bounds` holds a box per triangle, reordered along with m_Triangles
+        void Subdivide(uint32_t node, std::vector<AABB>& bounds, uint32_t depth);
+        void UpdateBounds(uint32_t node, const std::vector<AABB>& bounds);
+
+        std::vector<Node> m_Nodes;
+        std::vector<Triangle> m_Triangles;
+    };
+}
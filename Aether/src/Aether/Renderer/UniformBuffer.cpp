@@ -2,6 +2,7 @@
 
 #include "Aether/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLUniformBuffer.h"
+#include "Platform/Null/NullBuffer.h"
 
 namespace Aether {
 
@@ -11,6 +12,7 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLUniformBuffer>(size, binding);
+			case RendererAPI::API::Null:    return CreateRef<NullUniformBuffer>(size, binding);
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
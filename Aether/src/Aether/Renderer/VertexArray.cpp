@@ -1,6 +1,7 @@
 #include "Aether/Renderer/VertexArray.h"
 #include "Aether/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
+#include "Platform/Null/NullVertexArray.h"
 
 namespace Aether {
     Ref<VertexArray> VertexArray::Create()
@@ -9,6 +10,7 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexArray>();
+			case RendererAPI::API::Null:    return CreateRef<NullVertexArray>();
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
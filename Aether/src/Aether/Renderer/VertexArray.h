@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Aether/Renderer/Buffer.h"
+#include "Aether/Renderer/RingBuffer.h"
 #include "aepch.h"
 namespace Aether {
     class AETHER_API VertexArray
@@ -15,6 +16,8 @@ namespace Aether {
         virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t startLocation) = 0;
         virtual void AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t startLocation) = 0;
         virtual void AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer) = 0;
+        // Re-points per-instance attributes at a ring allocation; cheap enough to call before every draw
+        virtual void SetInstanceBuffer(const RingAllocation& allocation, const BufferLayout& layout, uint32_t startLocation) = 0;
         virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) = 0;
 
         virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const = 0;
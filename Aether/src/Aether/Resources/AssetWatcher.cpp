@@ -0,0 +1,113 @@
+#include "aepch.h"
+#include "Aether/Resources/AssetWatcher.h"
+#include "Aether/Resources/Shader.h"
+#include "Aether/Resources/Texture.h"
+#include "Aether/Resources/ModelLoader.h"
+
+#include <FileWatch.hpp>
+#include <filesystem>
+
+namespace Aether {
+
+    std::vector<Scope<filewatch::FileWatch<std::string>>> AssetWatcher::s_Watchers;
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> AssetWatcher::s_PendingChanges;
+    std::mutex AssetWatcher::s_Mutex;
+
+    static constexpr auto s_SettleTime = std::chrono::milliseconds(100);
+
+    void AssetWatcher::Init(const std::string& root)
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(root, ec))
+        {
+            AE_CORE_WARN("AssetWatcher: '{0}' is not a directory, hot reload disabled", root);
+            return;
+        }
+
+        // inotify watches are not recursive, so every directory gets its own watcher
+        std::vector<std::string> directories = { root };
+        for (auto it = std::filesystem::recursive_directory_iterator(root, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+        {
+            if (it->is_directory(ec))
+                directories.push_back(it->path().string());
+        }
+
+        for (const auto& directory : directories)
+        {
+            try
+            {
+                s_Watchers.push_back(CreateScope<filewatch::FileWatch<std::string>>(directory,
+                    [directory](const std::string& path, const filewatch::Event event)
+                    {
+                        if (event == filewatch::Event::modified || event == filewatch::Event::added || event == filewatch::Event::renamed_new)
+                            OnFileEvent(directory + "/" + path);
+                    }));
+            }
+            catch (const std::exception& e)
+            {
+                AE_CORE_WARN("AssetWatcher: Could not watch '{0}' ({1})", directory, e.what());
+            }
+        }
+
+        AE_CORE_INFO("AssetWatcher: Watching {0} directories under '{1}'", s_Watchers.size(), root);
+    }
+
+    void AssetWatcher::Shutdown()
+    {
+        s_Watchers.clear();
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_PendingChanges.clear();
+    }
+
+    void AssetWatcher::Update()
+    {
+        std::vector<std::string> settled;
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            if (s_PendingChanges.empty())
+                return;
+
+            auto now = std::chrono::steady_clock::now();
+            for (auto it = s_PendingChanges.begin(); it != s_PendingChanges.end();)
+            {
+                if (now - it->second < s_SettleTime)
+                {
+                    ++it;
+                    continue;
+                }
+                settled.push_back(it->first);
+                it = s_PendingChanges.erase(it);
+            }
+        }
+
+        for (const auto& filepath : settled)
+            Dispatch(filepath);
+    }
+
+    void AssetWatcher::OnFileEvent(const std::string& filepath)
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_PendingChanges[NormalizePath(filepath)] = std::chrono::steady_clock::now();
+    }
+
+    void AssetWatcher::Dispatch(const std::string& filepath)
+    {
+        std::string extension = std::filesystem::path(filepath).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+
+        AE_CORE_TRACE("AssetWatcher: '{0}' changed", filepath);
+
+        if (extension == ".shader" || extension == ".glsl")
+            ShaderLibrary::OnFileChanged(filepath);
+        else if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp" || extension == ".hdr" || extension == ".ktx2")
+            Texture2DLibrary::OnFileChanged(filepath);
+        else if (extension == ".glb" || extension == ".gltf")
+            ModelLoader::OnFileChanged(filepath);
+    }
+
+    std::string AssetWatcher::NormalizePath(const std::string& filepath)
+    {
+        return std::filesystem::path(filepath).lexically_normal().generic_string();
+    }
+}
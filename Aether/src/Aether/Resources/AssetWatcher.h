@@ -0,0 +1,36 @@
+#pragma once
+
+#include "aepch.h"
+
+#include <chrono>
+#include <mutex>
+
+namespace filewatch {
+    template<typename T> class FileWatch;
+}
+
+namespace Aether {
+
+    // Watches the asset tree and hands changed files to the owning library.
+    // Events arrive on the watcher threads; dispatch happens on the main thread.
+    class AETHER_API AssetWatcher
+    {
+    public:
+        static void Init(const std::string& root = "assets");
+        static void Shutdown();
+
+        // Called once per frame: reloads files whose writes have settled
+        static void Update();
+
+        static std::string NormalizePath(const std::string& filepath);
+
+    private:
+        static void OnFileEvent(const std::string& filepath);
+        static void Dispatch(const std::string& filepath);
+
+        static std::vector<Scope<filewatch::FileWatch<std::string>>> s_Watchers;
+        // Editors often write a file in several chunks, so changes are debounced per path
+        static std::unordered_map<std::string, std::chrono::steady_clock::time_point> s_PendingChanges;
+        static std::mutex s_Mutex;
+    };
+}
@@ -0,0 +1,178 @@
+#include "aepch.h"
+#include "Aether/Resources/Environment.h"
+#include "Aether/Core/Hash.h"
+#include "Aether/Core/AssetsRegister.h"
+
+#include <filesystem>
+#include <iomanip>
+
+namespace Aether {
+
+    static const char* s_CacheDirectory = "cache/environment";
+    static const char* s_BRDFLutPath = "cache/brdf_lut.bin";
+
+    static constexpr UUID s_BRDFLutID = AssetsRegister::Get("Tex_BRDFLut");
+    static constexpr uint32_t s_BRDFLutSize = 128;
+    static constexpr uint32_t s_BRDFLutSamples = 1024;
+    static constexpr uint32_t s_BRDFLutMagic = 0x54554C41; // "ALUT"
+
+    namespace Utils {
+
+        static std::string GetCachePath(const std::string& filepath, const EnvironmentSettings& settings)
+        {
+            std::error_code ec;
+            uintmax_t size = std::filesystem::file_size(filepath, ec);
+            auto writeTime = std::filesystem::last_write_time(filepath, ec).time_since_epoch().count();
+
+            std::stringstream key;
+            key << std::filesystem::path(filepath).lexically_normal().generic_string() << '|' << size << '|' << writeTime << '|'
+                << settings.FaceSize << '|' << settings.PrefilterSize << '|' << settings.PrefilterLevels << '|' << settings.SampleCount;
+            std::string keyString = key.str();
+
+            std::stringstream path;
+            path << s_CacheDirectory << '/' << std::hex << std::setw(16) << std::setfill('0')
+                 << Hash::XXH64(keyString.data(), keyString.size()) << ".aeenv";
+            return path.str();
+        }
+
+        static bool ReadBRDFLut(std::vector<glm::vec2>& lut)
+        {
+            std::ifstream in(s_BRDFLutPath, std::ios::in | std::ios::binary);
+            uint32_t header[3];
+            if (!in || !in.read((char*)header, sizeof(header)))
+                return false;
+            if (header[0] != s_BRDFLutMagic || header[1] != s_BRDFLutSize || header[2] != s_BRDFLutSamples)
+                return false;
+
+            lut.resize((size_t)s_BRDFLutSize * s_BRDFLutSize);
+            return (bool)in.read((char*)lut.data(), lut.size() * sizeof(glm::vec2));
+        }
+
+        static void WriteBRDFLut(const std::vector<glm::vec2>& lut)
+        {
+            std::error_code ec;
+            std::filesystem::create_directories(std::filesystem::path(s_BRDFLutPath).parent_path(), ec);
+
+            std::ofstream out(s_BRDFLutPath, std::ios::out | std::ios::binary);
+            if (!out)
+            {
+                AE_CORE_WARN("Environment: Could not write '{0}'", s_BRDFLutPath);
+                return;
+            }
+
+            uint32_t header[3] = { s_BRDFLutMagic, s_BRDFLutSize, s_BRDFLutSamples };
+            out.write((const char*)header, sizeof(header));
+            out.write((const char*)lut.data(), lut.size() * sizeof(glm::vec2));
+        }
+    }
+
+    Environment::Environment(const EnvironmentData& data)
+        : m_Irradiance(data.Irradiance)
+    {
+        m_BRDFLut = GetBRDFLut();
+        m_Skybox = Upload(data.Radiance);
+        m_Prefiltered = Upload(data.Prefiltered);
+    }
+
+    Ref<Environment> Environment::Load(const std::string& filepath, const EnvironmentSettings& settings)
+    {
+        std::string cachePath = Utils::GetCachePath(filepath, settings);
+        if (auto cached = EnvironmentBaker::Load(cachePath))
+        {
+            AE_CORE_INFO("Environment: Loaded '{0}' from cache", filepath);
+            return CreateRef<Environment>(*cached);
+        }
+
+        auto data = EnvironmentBaker::Bake(filepath, settings);
+        if (!data)
+            return nullptr;
+
+        std::error_code ec;
+        std::filesystem::create_directories(s_CacheDirectory, ec);
+        if (!ec)
+            EnvironmentBaker::Save(cachePath, *data);
+
+        AE_CORE_INFO("Environment: Baked '{0}'", filepath);
+        return CreateRef<Environment>(*data);
+    }
+
+    void Environment::Bind(const Ref<Shader>& shader, uint32_t slot) const
+    {
+        static const std::array<std::string, 9> s_Names = []()
+        {
+            std::array<std::string, 9> names;
+            for (uint32_t i = 0; i < 9; i++)
+                names[i] = "u_IrradianceSH[" + std::to_string(i) + "]";
+            return names;
+        }();
+
+        // Folds the cosine lobe of each band and the Lambert 1/pi in, so the shader only sums basis terms
+        static constexpr float s_Band[3] = { 1.0f, 2.0f / 3.0f, 0.25f };
+        static constexpr uint32_t s_BandOf[9] = { 0, 1, 1, 1, 2, 2, 2, 2, 2 };
+
+        m_Prefiltered->Bind(slot);
+        shader->SetInt("u_PrefilteredMap", slot);
+        shader->SetFloat("u_PrefilteredMaxLod", (float)(m_Prefiltered->GetMipLevelCount() - 1));
+        m_BRDFLut->Bind(slot + 1);
+        shader->SetInt("u_BRDFLut", slot + 1);
+        for (uint32_t i = 0; i < 9; i++)
+            shader->SetFloat3(s_Names[i], m_Irradiance.Coefficients[i] * s_Band[s_BandOf[i]]);
+        shader->SetInt("u_HasEnvironment", 1);
+    }
+
+    void Environment::BindFallback(const Ref<Shader>& shader, uint32_t slot)
+    {
+        // Left at unit 0 the samplers would collide with the material's albedo map
+        shader->SetInt("u_PrefilteredMap", slot);
+        shader->SetInt("u_BRDFLut", slot + 1);
+        shader->SetInt("u_HasEnvironment", 0);
+    }
+
+    Ref<Texture2D> Environment::GetBRDFLut()
+    {
+        if (Texture2DLibrary::Exists(s_BRDFLutID))
+            return Texture2DLibrary::Get(s_BRDFLutID);
+
+        std::vector<glm::vec2> lut;
+        if (!Utils::ReadBRDFLut(lut))
+        {
+            lut = EnvironmentBaker::BakeBRDFLut(s_BRDFLutSize, s_BRDFLutSamples);
+            Utils::WriteBRDFLut(lut);
+            AE_CORE_INFO("Environment: Baked the BRDF LUT");
+        }
+
+        TextureSpec spec;
+        spec.Width = spec.Height = s_BRDFLutSize;
+        spec.Format = ImageFormat::RGBA16F;
+        spec.GenerateMips = false;
+        spec.WrapMode = true;
+
+        // Float formats take 32-bit RGBA client data
+        std::vector<glm::vec4> pixels(lut.size());
+        for (size_t i = 0; i < lut.size(); i++)
+            pixels[i] = glm::vec4(lut[i].x, lut[i].y, 0.0f, 1.0f);
+
+        auto texture = Texture2DLibrary::Load(spec, s_BRDFLutID);
+        if (texture)
+            texture->SetData(pixels.data(), (uint32_t)(pixels.size() * sizeof(glm::vec4)));
+        return texture;
+    }
+
+    Ref<TextureCube> Environment::Upload(const CubemapData& cubemap)
+    {
+        TextureSpec spec;
+        spec.Width = spec.Height = cubemap.Size;
+        spec.Format = ImageFormat::RGBA16F;
+        spec.GenerateMips = false;
+        spec.MipLevels = cubemap.MipLevels;
+
+        auto texture = TextureCube::Create(spec);
+        for (uint32_t level = 0; level < cubemap.MipLevels; level++)
+        {
+            uint32_t size = cubemap.GetLevelSize(level);
+            for (uint32_t face = 0; face < 6; face++)
+                texture->SetFaceData(face, level, cubemap.GetFace(level, face), size * size * sizeof(glm::vec4));
+        }
+        return texture;
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Resources/EnvironmentBaker.h"
+#include "Aether/Resources/Texture.h"
+#include "Aether/Resources/Shader.h"
+
+namespace Aether {
+
+    // Image-based lighting on the GPU: the skybox, its GGX-prefiltered specular cubemap and
+    // SH9 diffuse irradiance, as consumed by assets/shaders/include/IBL.glsl
+    class AETHER_API Environment
+    {
+    public:
+        Environment(const EnvironmentData& data);
+
+        // Bakes on first use and reuses the result from disk afterwards; the cache entry is keyed
+        // by the source file (path, size, write time) and the settings
+        static Ref<Environment> Load(const std::string& filepath, const EnvironmentSettings& settings = {});
+
+        const Ref<TextureCube>& GetSkybox() const { return m_Skybox; }
+        const Ref<TextureCube>& GetPrefiltered() const { return m_Prefiltered; }
+        const SH9& GetIrradiance() const { return m_Irradiance; }
+
+        // Sets the IBL uniforms on a bound shader; the prefiltered map takes texture unit `slot`
+        // and the BRDF LUT `slot + 1`
+        void Bind(const Ref<Shader>& shader, uint32_t slot) const;
+        // Same units, with u_HasEnvironment = 0, for shaders that include IBL.glsl but have no environment
+        static void BindFallback(const Ref<Shader>& shader, uint32_t slot);
+
+        // RGBA16F split-sum LUT shared by every environment and kept in Texture2DLibrary. Read from
+        // the cache directory when present, otherwise baked on the job system and written there.
+        static Ref<Texture2D> GetBRDFLut();
+    private:
+        static Ref<TextureCube> Upload(const CubemapData& cubemap);
+
+        Ref<Texture2D> m_BRDFLut;
+        Ref<TextureCube> m_Skybox;
+        Ref<TextureCube> m_Prefiltered;
+        SH9 m_Irradiance;
+    };
+}
@@ -0,0 +1,556 @@
+#include "aepch.h"
+#include "Aether/Resources/EnvironmentBaker.h"
+#include "Aether/Resources/Texture.h"
+#include "Aether/Core/JobSystem.h"
+
+#include <cmath>
+#include <stb_image.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define AE_ENVIRONMENT_SSE 1
+    #include <xmmintrin.h>
+#endif
+
+namespace Aether {
+
+    static constexpr float s_Pi = 3.14159265359f;
+
+    static constexpr uint32_t s_CacheMagic = 0x564E4541; // "AENV"
+    static constexpr uint32_t s_CacheVersion = 1;
+
+    // Rows handed to one ParallelFor batch
+    static constexpr uint32_t s_RowsPerBatch = 8;
+
+    namespace Utils {
+
+        // Four-wide accumulation for the filtering loops, scalar where SSE is unavailable
+#ifdef AE_ENVIRONMENT_SSE
+        using Vec4 = __m128;
+        static inline Vec4 Zero() { return _mm_setzero_ps(); }
+        static inline Vec4 Load(const glm::vec4& v) { return _mm_loadu_ps(&v.x); }
+        static inline Vec4 Add(Vec4 a, Vec4 b) { return _mm_add_ps(a, b); }
+        static inline Vec4 MulAdd(Vec4 acc, Vec4 v, float w) { return _mm_add_ps(acc, _mm_mul_ps(v, _mm_set1_ps(w))); }
+        static inline glm::vec4 Store(Vec4 v) { glm::vec4 r; _mm_storeu_ps(&r.x, v); return r; }
+#else
+        using Vec4 = glm::vec4;
+        static inline Vec4 Zero() { return glm::vec4(0.0f); }
+        static inline Vec4 Load(const glm::vec4& v) { return v; }
+        static inline Vec4 Add(Vec4 a, Vec4 b) { return a + b; }
+        static inline Vec4 MulAdd(Vec4 acc, Vec4 v, float w) { return acc + v * w; }
+        static inline glm::vec4 Store(Vec4 v) { return v; }
+#endif
+
+        // Inverse of CubemapData::TexelDirection; s and t come back in [-1, 1]
+        static uint32_t DirectionToFace(const glm::vec3& d, float& s, float& t)
+        {
+            glm::vec3 a = glm::abs(d);
+            uint32_t face;
+            float sc, tc, ma;
+            if (a.x >= a.y && a.x >= a.z)
+            {
+                face = d.x > 0.0f ? 0 : 1;
+                sc = d.x > 0.0f ? -d.z : d.z;
+                tc = -d.y;
+                ma = a.x;
+            }
+            else if (a.y >= a.z)
+            {
+                face = d.y > 0.0f ? 2 : 3;
+                sc = d.x;
+                tc = d.y > 0.0f ? d.z : -d.z;
+                ma = a.y;
+            }
+            else
+            {
+                face = d.z > 0.0f ? 4 : 5;
+                sc = d.z > 0.0f ? d.x : -d.x;
+                tc = -d.y;
+                ma = a.z;
+            }
+
+            s = sc / ma;
+            t = tc / ma;
+            return face;
+        }
+
+        static Vec4 SampleLevel(const CubemapData& cubemap, uint32_t level, const glm::vec3& direction)
+        {
+            float s, t;
+            uint32_t face = DirectionToFace(direction, s, t);
+            uint32_t size = cubemap.GetLevelSize(level);
+            const glm::vec4* texels = cubemap.GetFace(level, face);
+
+            float x = glm::clamp((s * 0.5f + 0.5f) * size - 0.5f, 0.0f, (float)(size - 1));
+            float y = glm::clamp((t * 0.5f + 0.5f) * size - 0.5f, 0.0f, (float)(size - 1));
+            uint32_t x0 = (uint32_t)x, y0 = (uint32_t)y;
+            uint32_t x1 = std::min(x0 + 1, size - 1), y1 = std::min(y0 + 1, size - 1);
+            float fx = x - x0, fy = y - y0;
+
+            Vec4 result = MulAdd(Zero(), Load(texels[y0 * size + x0]), (1.0f - fx) * (1.0f - fy));
+            result = MulAdd(result, Load(texels[y0 * size + x1]), fx * (1.0f - fy));
+            result = MulAdd(result, Load(texels[y1 * size + x0]), (1.0f - fx) * fy);
+            return MulAdd(result, Load(texels[y1 * size + x1]), fx * fy);
+        }
+
+        static Vec4 SampleTrilinear(const CubemapData& cubemap, const glm::vec3& direction, float lod)
+        {
+            lod = glm::clamp(lod, 0.0f, (float)(cubemap.MipLevels - 1));
+            uint32_t level = (uint32_t)lod;
+            float blend = lod - level;
+            if (blend <= 0.0f || level + 1 >= cubemap.MipLevels)
+                return SampleLevel(cubemap, level, direction);
+
+            Vec4 result = MulAdd(Zero(), SampleLevel(cubemap, level, direction), 1.0f - blend);
+            return MulAdd(result, SampleLevel(cubemap, level + 1, direction), blend);
+        }
+
+        static glm::vec4 SampleImage(const float* rgba, uint32_t width, uint32_t height, float x, float y, bool wrapX)
+        {
+            x -= 0.5f;
+            y = glm::clamp(y - 0.5f, 0.0f, (float)(height - 1));
+            if (wrapX)
+                x -= std::floor(x / width) * width;
+            else
+                x = glm::clamp(x, 0.0f, (float)(width - 1));
+
+            uint32_t x0 = std::min((uint32_t)x, width - 1), y0 = (uint32_t)y;
+            uint32_t x1 = x0 + 1 < width ? x0 + 1 : (wrapX ? 0 : width - 1);
+            uint32_t y1 = std::min(y0 + 1, height - 1);
+            float fx = x - x0, fy = y - y0;
+
+            auto texel = [&](uint32_t px, uint32_t py)
+            {
+                const float* p = rgba + ((size_t)py * width + px) * 4;
+                return glm::vec4(p[0], p[1], p[2], p[3]);
+            };
+            return glm::mix(glm::mix(texel(x0, y0), texel(x1, y0), fx), glm::mix(texel(x0, y1), texel(x1, y1), fx), fy);
+        }
+
+        // Fills levels 1.. with 2x2 box averages of the level above
+        static void GenerateMips(CubemapData& cubemap)
+        {
+            for (uint32_t level = 1; level < cubemap.MipLevels; level++)
+            {
+                uint32_t size = cubemap.GetLevelSize(level);
+                uint32_t srcSize = cubemap.GetLevelSize(level - 1);
+                for (uint32_t face = 0; face < 6; face++)
+                {
+                    const glm::vec4* src = cubemap.GetFace(level - 1, face);
+                    glm::vec4* dst = cubemap.GetFace(level, face);
+                    for (uint32_t y = 0; y < size; y++)
+                    {
+                        uint32_t sy0 = std::min(y * 2, srcSize - 1), sy1 = std::min(y * 2 + 1, srcSize - 1);
+                        for (uint32_t x = 0; x < size; x++)
+                        {
+                            uint32_t sx0 = std::min(x * 2, srcSize - 1), sx1 = std::min(x * 2 + 1, srcSize - 1);
+                            Vec4 sum = Add(Add(Load(src[sy0 * srcSize + sx0]), Load(src[sy0 * srcSize + sx1])),
+                                           Add(Load(src[sy1 * srcSize + sx0]), Load(src[sy1 * srcSize + sx1])));
+                            dst[y * size + x] = Store(MulAdd(Zero(), sum, 0.25f));
+                        }
+                    }
+                }
+            }
+        }
+
+        static glm::vec2 Hammersley(uint32_t i, uint32_t count)
+        {
+            uint32_t bits = i;
+            bits = (bits << 16u) | (bits >> 16u);
+            bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+            bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+            bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+            bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+            return glm::vec2((float)i / count, bits * 2.3283064365386963e-10f);
+        }
+    }
+
+    std::array<float, 9> SH9::EvaluateBasis(const glm::vec3& d)
+    {
+        return {
+            0.282095f,
+            0.488603f * d.y,
+            0.488603f * d.z,
+            0.488603f * d.x,
+            1.092548f * d.x * d.y,
+            1.092548f * d.y * d.z,
+            0.315392f * (3.0f * d.z * d.z - 1.0f),
+            1.092548f * d.x * d.z,
+            0.546274f * (d.x * d.x - d.y * d.y)
+        };
+    }
+
+    glm::vec3 SH9::EvaluateIrradiance(const glm::vec3& normal) const
+    {
+        // Clamped-cosine convolution per band (Ramamoorthi & Hanrahan)
+        static constexpr float s_Band[9] = {
+            s_Pi,
+            2.0f * s_Pi / 3.0f, 2.0f * s_Pi / 3.0f, 2.0f * s_Pi / 3.0f,
+            s_Pi / 4.0f, s_Pi / 4.0f, s_Pi / 4.0f, s_Pi / 4.0f, s_Pi / 4.0f
+        };
+
+        auto basis = EvaluateBasis(glm::normalize(normal));
+        glm::vec3 result(0.0f);
+        for (uint32_t i = 0; i < 9; i++)
+            result += Coefficients[i] * (basis[i] * s_Band[i]);
+        return glm::max(result, glm::vec3(0.0f));
+    }
+
+    size_t CubemapData::GetFaceOffset(uint32_t level, uint32_t face) const
+    {
+        size_t offset = 0;
+        for (uint32_t i = 0; i < level; i++)
+            offset += (size_t)GetLevelSize(i) * GetLevelSize(i) * 6;
+        return offset + (size_t)GetLevelSize(level) * GetLevelSize(level) * face;
+    }
+
+    void CubemapData::Allocate(uint32_t size, uint32_t mipLevels)
+    {
+        Size = size;
+        MipLevels = mipLevels;
+        Texels.assign(GetFaceOffset(mipLevels, 0), glm::vec4(0.0f));
+    }
+
+    glm::vec4 CubemapData::Sample(const glm::vec3& direction, float lod) const
+    {
+        return Utils::Store(Utils::SampleTrilinear(*this, direction, lod));
+    }
+
+    glm::vec3 CubemapData::TexelDirection(uint32_t face, float s, float t)
+    {
+        switch (face)
+        {
+            case 0: return glm::normalize(glm::vec3(1.0f, -t, -s));
+            case 1: return glm::normalize(glm::vec3(-1.0f, -t, s));
+            case 2: return glm::normalize(glm::vec3(s, 1.0f, t));
+            case 3: return glm::normalize(glm::vec3(s, -1.0f, -t));
+            case 4: return glm::normalize(glm::vec3(s, -t, 1.0f));
+            case 5: return glm::normalize(glm::vec3(-s, -t, -1.0f));
+        }
+        return glm::vec3(0.0f, 0.0f, 1.0f);
+    }
+
+    Ref<EnvironmentData> EnvironmentBaker::Bake(const std::string& filepath, const EnvironmentSettings& settings)
+    {
+        // The global flip flag would race with other workers
+        stbi_set_flip_vertically_on_load_thread(0);
+
+        int width, height, channels;
+        float* data = stbi_loadf(filepath.c_str(), &width, &height, &channels, 4);
+        if (!data)
+        {
+            AE_CORE_ERROR("EnvironmentBaker: Failed to load '{0}'", filepath);
+            return nullptr;
+        }
+
+        auto result = Bake(data, width, height, settings);
+        stbi_image_free(data);
+        return result;
+    }
+
+    Ref<EnvironmentData> EnvironmentBaker::Bake(const float* rgba, uint32_t width, uint32_t height, const EnvironmentSettings& settings)
+    {
+        if (width != height * 2 && width * 3 != height * 4)
+        {
+            AE_CORE_ERROR("EnvironmentBaker: {0}x{1} is neither equirectangular (2:1) nor a horizontal cross (4:3)", width, height);
+            return nullptr;
+        }
+
+        auto data = CreateRef<EnvironmentData>();
+        data->Radiance = Resample(rgba, width, height, settings.FaceSize);
+        data->Irradiance = ProjectSH(data->Radiance);
+        data->Prefiltered = Prefilter(data->Radiance, settings.PrefilterSize, settings.PrefilterLevels, settings.SampleCount);
+        return data;
+    }
+
+    CubemapData EnvironmentBaker::Resample(const float* rgba, uint32_t width, uint32_t height, uint32_t faceSize)
+    {
+        bool equirect = width == height * 2;
+        uint32_t crossFace = width / 4;
+
+        // Grid cells of each face in the cross, matching OpenGLTextureCube
+        static constexpr uint32_t s_CrossCells[6][2] = { { 2, 1 }, { 0, 1 }, { 1, 0 }, { 1, 2 }, { 1, 1 }, { 3, 1 } };
+
+        CubemapData cubemap;
+        cubemap.Allocate(faceSize, Texture::CalculateMipCount(faceSize, faceSize));
+
+        JobSystem::ParallelFor(6 * faceSize, s_RowsPerBatch, [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t row = begin; row < end; row++)
+            {
+                uint32_t face = row / faceSize, y = row % faceSize;
+                glm::vec4* dst = cubemap.GetFace(0, face) + (size_t)y * faceSize;
+                float t = (y + 0.5f) / faceSize * 2.0f - 1.0f;
+
+                for (uint32_t x = 0; x < faceSize; x++)
+                {
+                    float s = (x + 0.5f) / faceSize * 2.0f - 1.0f;
+                    glm::vec3 d = CubemapData::TexelDirection(face, s, t);
+
+                    if (equirect)
+                    {
+                        float u = std::atan2(d.z, d.x) / (2.0f * s_Pi) + 0.5f;
+                        float v = std::acos(glm::clamp(d.y, -1.0f, 1.0f)) / s_Pi;
+                        dst[x] = Utils::SampleImage(rgba, width, height, u * width, v * height, true);
+                    }
+                    else
+                    {
+                        // Stay inside the face's cell so neighbours in the cross don't bleed in
+                        const auto& cell = s_CrossCells[face];
+                        float px = glm::clamp((s * 0.5f + 0.5f) * crossFace, 0.5f, crossFace - 0.5f);
+                        float py = glm::clamp((t * 0.5f + 0.5f) * crossFace, 0.5f, crossFace - 0.5f);
+                        dst[x] = Utils::SampleImage(rgba, width, height, cell[0] * crossFace + px, cell[1] * crossFace + py, false);
+                    }
+                }
+            }
+        });
+
+        Utils::GenerateMips(cubemap);
+        return cubemap;
+    }
+
+    SH9 EnvironmentBaker::ProjectSH(const CubemapData& cubemap)
+    {
+        uint32_t size = cubemap.Size;
+        uint32_t rows = 6 * size;
+        uint32_t batches = (rows + s_RowsPerBatch - 1) / s_RowsPerBatch;
+
+        // One partial sum per batch, reduced in order so results don't depend on scheduling
+        struct Partial
+        {
+            Utils::Vec4 Sums[9];
+            float Weight = 0.0f;
+        };
+        std::vector<Partial> partials(batches);
+
+        JobSystem::ParallelFor(rows, s_RowsPerBatch, [&](uint32_t begin, uint32_t end)
+        {
+            Partial& partial = partials[begin / s_RowsPerBatch];
+            std::fill(std::begin(partial.Sums), std::end(partial.Sums), Utils::Zero());
+
+            for (uint32_t row = begin; row < end; row++)
+            {
+                uint32_t face = row / size, y = row % size;
+                const glm::vec4* texels = cubemap.GetFace(0, face) + (size_t)y * size;
+                float t = (y + 0.5f) / size * 2.0f - 1.0f;
+
+                for (uint32_t x = 0; x < size; x++)
+                {
+                    float s = (x + 0.5f) / size * 2.0f - 1.0f;
+                    // Solid angle of the texel: its area on the unit cube over the cube of the distance
+                    float r2 = 1.0f + s * s + t * t;
+                    float solidAngle = 4.0f / (size * size * r2 * std::sqrt(r2));
+
+                    auto basis = SH9::EvaluateBasis(CubemapData::TexelDirection(face, s, t));
+                    Utils::Vec4 color = Utils::Load(texels[x]);
+                    for (uint32_t i = 0; i < 9; i++)
+                        partial.Sums[i] = Utils::MulAdd(partial.Sums[i], color, basis[i] * solidAngle);
+                    partial.Weight += solidAngle;
+                }
+            }
+        });
+
+        std::array<glm::vec4, 9> sums{};
+        float weight = 0.0f;
+        for (const auto& partial : partials)
+        {
+            for (uint32_t i = 0; i < 9; i++)
+                sums[i] += Utils::Store(partial.Sums[i]);
+            weight += partial.Weight;
+        }
+
+        // The texel solid angles only approximate the sphere; renormalize to exactly 4 pi
+        SH9 sh;
+        float normalization = 4.0f * s_Pi / weight;
+        for (uint32_t i = 0; i < 9; i++)
+            sh.Coefficients[i] = glm::vec3(sums[i]) * normalization;
+        return sh;
+    }
+
+    CubemapData EnvironmentBaker::Prefilter(const CubemapData& source, uint32_t size, uint32_t levels, uint32_t sampleCount)
+    {
+        levels = std::max(std::min(levels, Texture::CalculateMipCount(size, size)), 1u);
+        sampleCount = std::max(sampleCount, 1u);
+
+        CubemapData prefiltered;
+        prefiltered.Allocate(size, levels);
+
+        // Importance samples only depend on roughness, so they are built once per level in
+        // tangent space, each with the source mip matching its footprint (filtered importance sampling)
+        struct Sample
+        {
+            glm::vec3 Direction;
+            float Weight;
+            float Lod;
+        };
+
+        float texelSolidAngle = 4.0f * s_Pi / (6.0f * source.Size * source.Size);
+
+        for (uint32_t level = 0; level < levels; level++)
+        {
+            uint32_t levelSize = prefiltered.GetLevelSize(level);
+            float roughness = levels > 1 ? (float)level / (levels - 1) : 0.0f;
+
+            std::vector<Sample> samples;
+            if (level == 0)
+            {
+                // Mirror reflection: the source at the matching resolution
+                samples.push_back({ glm::vec3(0.0f, 0.0f, 1.0f), 1.0f, std::log2((float)source.Size / levelSize) });
+            }
+            else
+            {
+                float a = roughness * roughness;
+                float a2 = a * a;
+                for (uint32_t i = 0; i < sampleCount; i++)
+                {
+                    glm::vec2 xi = Utils::Hammersley(i, sampleCount);
+                    float phi = 2.0f * s_Pi * xi.x;
+                    float cosTheta = std::sqrt((1.0f - xi.y) / (1.0f + (a2 - 1.0f) * xi.y));
+                    float sinTheta = std::sqrt(1.0f - cosTheta * cosTheta);
+
+                    // N = V, so L is H reflected about the normal
+                    glm::vec3 h(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+                    glm::vec3 l = 2.0f * cosTheta * h - glm::vec3(0.0f, 0.0f, 1.0f);
+                    if (l.z <= 0.0f)
+                        continue;
+
+                    float denom = cosTheta * cosTheta * (a2 - 1.0f) + 1.0f;
+                    float pdf = a2 / (s_Pi * denom * denom) * 0.25f;
+                    float sampleSolidAngle = 1.0f / (sampleCount * pdf + 0.0001f);
+                    samples.push_back({ l, l.z, 0.5f * std::log2(sampleSolidAngle / texelSolidAngle) + 1.0f });
+                }
+            }
+
+            float totalWeight = 0.0f;
+            for (const auto& sample : samples)
+                totalWeight += sample.Weight;
+
+            JobSystem::ParallelFor(6 * levelSize, s_RowsPerBatch, [&](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t row = begin; row < end; row++)
+                {
+                    uint32_t face = row / levelSize, y = row % levelSize;
+                    glm::vec4* dst = prefiltered.GetFace(level, face) + (size_t)y * levelSize;
+                    float t = (y + 0.5f) / levelSize * 2.0f - 1.0f;
+
+                    for (uint32_t x = 0; x < levelSize; x++)
+                    {
+                        float s = (x + 0.5f) / levelSize * 2.0f - 1.0f;
+                        glm::vec3 n = CubemapData::TexelDirection(face, s, t);
+                        glm::vec3 up = std::abs(n.z) < 0.999f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+                        glm::vec3 tangent = glm::normalize(glm::cross(up, n));
+                        glm::vec3 bitangent = glm::cross(n, tangent);
+
+                        Utils::Vec4 sum = Utils::Zero();
+                        for (const auto& sample : samples)
+                        {
+                            glm::vec3 l = tangent * sample.Direction.x + bitangent * sample.Direction.y + n * sample.Direction.z;
+                            sum = Utils::MulAdd(sum, Utils::SampleTrilinear(source, l, sample.Lod), sample.Weight);
+                        }
+                        dst[x] = Utils::Store(sum) / totalWeight;
+                    }
+                }
+            });
+        }
+
+        return prefiltered;
+    }
+
+    std::vector<glm::vec2> EnvironmentBaker::BakeBRDFLut(uint32_t size, uint32_t sampleCount)
+    {
+        sampleCount = std::max(sampleCount, 1u);
+        std::vector<glm::vec2> lut((size_t)size * size);
+
+        JobSystem::ParallelFor(size, 1, [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t y = begin; y < end; y++)
+            {
+                float roughness = (y + 0.5f) / size;
+                float a = roughness * roughness;
+                float a2 = a * a;
+                // Smith-Schlick k for image-based lighting
+                float k = a * 0.5f;
+
+                for (uint32_t x = 0; x < size; x++)
+                {
+                    float NdotV = (x + 0.5f) / size;
+                    glm::vec3 v(std::sqrt(1.0f - NdotV * NdotV), 0.0f, NdotV);
+
+                    glm::vec2 sum(0.0f);
+                    for (uint32_t i = 0; i < sampleCount; i++)
+                    {
+                        glm::vec2 xi = Utils::Hammersley(i, sampleCount);
+                        float phi = 2.0f * s_Pi * xi.x;
+                        float cosTheta = std::sqrt((1.0f - xi.y) / (1.0f + (a2 - 1.0f) * xi.y));
+                        float sinTheta = std::sqrt(1.0f - cosTheta * cosTheta);
+
+                        glm::vec3 h(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+                        float VdotH = glm::dot(v, h);
+                        glm::vec3 l = 2.0f * VdotH * h - v;
+
+                        float NdotL = l.z;
+                        if (NdotL <= 0.0f)
+                            continue;
+
+                        VdotH = std::max(VdotH, 0.0f);
+                        float G = (NdotV / (NdotV * (1.0f - k) + k)) * (NdotL / (NdotL * (1.0f - k) + k));
+                        float visibility = G * VdotH / (cosTheta * NdotV);
+                        float fresnel = std::pow(1.0f - VdotH, 5.0f);
+                        sum += glm::vec2((1.0f - fresnel) * visibility, fresnel * visibility);
+                    }
+
+                    lut[(size_t)y * size + x] = sum / (float)sampleCount;
+                }
+            }
+        });
+
+        return lut;
+    }
+
+    bool EnvironmentBaker::Save(const std::string& filepath, const EnvironmentData& data)
+    {
+        std::ofstream out(filepath, std::ios::out | std::ios::binary);
+        if (!out)
+        {
+            AE_CORE_ERROR("EnvironmentBaker: Could not write '{0}'", filepath);
+            return false;
+        }
+
+        uint32_t header[6] = { s_CacheMagic, s_CacheVersion, data.Radiance.Size, data.Radiance.MipLevels, data.Prefiltered.Size, data.Prefiltered.MipLevels };
+        out.write((const char*)header, sizeof(header));
+        out.write((const char*)data.Irradiance.Coefficients.data(), sizeof(data.Irradiance.Coefficients));
+        out.write((const char*)data.Radiance.Texels.data(), data.Radiance.Texels.size() * sizeof(glm::vec4));
+        out.write((const char*)data.Prefiltered.Texels.data(), data.Prefiltered.Texels.size() * sizeof(glm::vec4));
+        return (bool)out;
+    }
+
+    Ref<EnvironmentData> EnvironmentBaker::Load(const std::string& filepath)
+    {
+        std::ifstream in(filepath, std::ios::in | std::ios::binary);
+        if (!in)
+            return nullptr;
+
+        uint32_t header[6];
+        if (!in.read((char*)header, sizeof(header)) || header[0] != s_CacheMagic || header[1] != s_CacheVersion)
+            return nullptr;
+
+        // Sizes come from disk; reject anything a bake could not have produced
+        if (!header[2] || !header[4] || header[3] != Texture::CalculateMipCount(header[2], header[2])
+            || !header[5] || header[5] > Texture::CalculateMipCount(header[4], header[4]))
+            return nullptr;
+
+        auto data = CreateRef<EnvironmentData>();
+        data->Radiance.Allocate(header[2], header[3]);
+        data->Prefiltered.Allocate(header[4], header[5]);
+
+        in.read((char*)data->Irradiance.Coefficients.data(), sizeof(data->Irradiance.Coefficients));
+        in.read((char*)data->Radiance.Texels.data(), data->Radiance.Texels.size() * sizeof(glm::vec4));
+        in.read((char*)data->Prefiltered.Texels.data(), data->Prefiltered.Texels.size() * sizeof(glm::vec4));
+        if (!in)
+        {
+            AE_CORE_WARN("EnvironmentBaker: Truncated cache '{0}'", filepath);
+            return nullptr;
+        }
+
+        return data;
+    }
+}
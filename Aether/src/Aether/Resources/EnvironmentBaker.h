@@ -0,0 +1,80 @@
+#pragma once
+
+#include "aepch.h"
+
+namespace Aether {
+
+    // Order-2 spherical harmonics of an environment's radiance, one RGB triple per basis function
+    struct SH9
+    {
+        std::array<glm::vec3, 9> Coefficients{};
+
+        static std::array<float, 9> EvaluateBasis(const glm::vec3& direction);
+
+        // Cosine-convolved: irradiance arriving at a surface facing `normal`
+        glm::vec3 EvaluateIrradiance(const glm::vec3& normal) const;
+    };
+
+    // CPU cubemap in linear RGBA float. Faces are ordered +X, -X, +Y, -Y, +Z, -Z in the GL layout
+    // (row 0 at t = -1); texels are stored level by level, then face by face.
+    struct CubemapData
+    {
+        uint32_t Size = 0;
+        uint32_t MipLevels = 0;
+        std::vector<glm::vec4> Texels;
+
+        uint32_t GetLevelSize(uint32_t level) const { return std::max(Size >> level, 1u); }
+        size_t GetFaceOffset(uint32_t level, uint32_t face) const;
+        glm::vec4* GetFace(uint32_t level, uint32_t face) { return Texels.data() + GetFaceOffset(level, face); }
+        const glm::vec4* GetFace(uint32_t level, uint32_t face) const { return Texels.data() + GetFaceOffset(level, face); }
+
+        void Allocate(uint32_t size, uint32_t mipLevels);
+
+        // Bilinear within a face; `lod` blends the two nearest levels
+        glm::vec4 Sample(const glm::vec3& direction, float lod = 0.0f) const;
+
+        static glm::vec3 TexelDirection(uint32_t face, float s, float t);
+    };
+
+    struct EnvironmentSettings
+    {
+        // Face size of the skybox cubemap the source is resampled to
+        uint32_t FaceSize = 256;
+        // Face size of the mirror level of the prefiltered chain; roughness 1 lands on its last level
+        uint32_t PrefilterSize = 128;
+        uint32_t PrefilterLevels = 6;
+        uint32_t SampleCount = 64;
+    };
+
+    struct EnvironmentData
+    {
+        CubemapData Radiance;
+        // Level i is GGX-filtered for roughness i / (levels - 1)
+        CubemapData Prefiltered;
+        SH9 Irradiance;
+    };
+
+    // Turns an equirectangular (2:1) or horizontal-cross (4:3) image into a skybox cubemap,
+    // its SH9 irradiance and a GGX-prefiltered specular chain. CPU only; the work is split
+    // across JobSystem::ParallelFor, so it needs no GPU and can be checked offline.
+    class AETHER_API EnvironmentBaker
+    {
+    public:
+        // Decodes with stb_image; LDR files are linearized
+        static Ref<EnvironmentData> Bake(const std::string& filepath, const EnvironmentSettings& settings = {});
+        // `rgba` is linear float, row 0 at the top
+        static Ref<EnvironmentData> Bake(const float* rgba, uint32_t width, uint32_t height, const EnvironmentSettings& settings = {});
+
+        static CubemapData Resample(const float* rgba, uint32_t width, uint32_t height, uint32_t faceSize);
+        static SH9 ProjectSH(const CubemapData& cubemap);
+        static CubemapData Prefilter(const CubemapData& source, uint32_t size, uint32_t levels, uint32_t sampleCount);
+
+        // Split-sum GGX BRDF, row-major with NdotV along x and roughness along y; each texel
+        // holds the scale and bias applied to F0
+        static std::vector<glm::vec2> BakeBRDFLut(uint32_t size, uint32_t sampleCount);
+
+        // Binary cache of a bake, so startup skips the filtering
+        static bool Save(const std::string& filepath, const EnvironmentData& data);
+        static Ref<EnvironmentData> Load(const std::string& filepath);
+    };
+}
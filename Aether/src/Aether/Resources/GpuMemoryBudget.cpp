@@ -0,0 +1,77 @@
+#include "aepch.h"
+#include "Aether/Resources/GpuMemoryBudget.h"
+#include "Aether/Resources/ResourceRegistry.h"
+
+namespace Aether {
+
+    static std::atomic<uint64_t> s_Budget{ 0 };
+    static std::atomic<uint64_t> s_Usage{ 0 };
+    // Warn once per overrun instead of every frame
+    static bool s_OverBudget = false;
+
+    // Anything drawn this recently is likely still on screen; evicting it would just thrash
+    static constexpr uint32_t s_MinIdleFrames = 3;
+
+    void GpuMemoryBudget::SetBudget(uint64_t bytes)
+    {
+        s_Budget.store(bytes, std::memory_order_relaxed);
+    }
+
+    uint64_t GpuMemoryBudget::GetBudget()
+    {
+        return s_Budget.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GpuMemoryBudget::GetUsage()
+    {
+        return s_Usage.load(std::memory_order_relaxed);
+    }
+
+    void GpuMemoryBudget::Update()
+    {
+        std::lock_guard<std::mutex> lock(ResourceRegistryBase::GetRegistriesMutex());
+        auto& registries = ResourceRegistryBase::GetRegistries();
+
+        uint64_t usage = 0;
+        for (auto* registry : registries)
+            usage += registry->GetResidentBytes();
+        s_Usage.store(usage, std::memory_order_relaxed);
+
+        uint64_t budget = GetBudget();
+        if (budget == 0 || usage <= budget)
+        {
+            s_OverBudget = false;
+            return;
+        }
+
+        uint32_t frame = ResourceRegistryBase::GetFrameIndex();
+        if (frame <= s_MinIdleFrames)
+            return;
+
+        std::vector<ResourceRegistryBase::EvictionCandidate> candidates;
+        for (auto* registry : registries)
+            registry->GatherEvictionCandidates(candidates, frame - s_MinIdleFrames);
+
+        std::sort(candidates.begin(), candidates.end(),
+            [](const auto& a, const auto& b) { return a.LastUsed < b.LastUsed; });
+
+        uint32_t evicted = 0;
+        for (const auto& candidate : candidates)
+        {
+            if (usage <= budget)
+                break;
+            if (!candidate.Registry->Evict(candidate.Handle))
+                continue;
+
+            usage -= std::min(usage, candidate.Bytes);
+            evicted++;
+        }
+        s_Usage.store(usage, std::memory_order_relaxed);
+
+        if (evicted)
+            AE_CORE_TRACE("GpuMemoryBudget: Evicted {0} resources, {1:.1f} / {2:.1f} MB resident", evicted, usage / (1024.0 * 1024.0), budget / (1024.0 * 1024.0));
+        if (usage > budget && !s_OverBudget)
+            AE_CORE_WARN("GpuMemoryBudget: {0:.1f} MB in use exceeds the {1:.1f} MB budget", usage / (1024.0 * 1024.0), budget / (1024.0 * 1024.0));
+        s_OverBudget = usage > budget;
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "aepch.h"
+
+namespace Aether {
+
+    // Keeps tracked GPU resources (textures, meshes) under a byte budget by evicting
+    // the least recently used ones. Evicted resources keep their IDs and handles and
+    // are reloaded from their source the next time something resolves them.
+    class AETHER_API GpuMemoryBudget
+    {
+    public:
+        // 0 disables eviction
+        static void SetBudget(uint64_t bytes);
+        static uint64_t GetBudget();
+
+        // Resident bytes as of the last Update()
+        static uint64_t GetUsage();
+
+        // Called once per frame by Application, after ResourceRegistryBase::CollectAll()
+        static void Update();
+    };
+}
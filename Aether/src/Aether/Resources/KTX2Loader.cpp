@@ -0,0 +1,264 @@
+#include "aepch.h"
+#include "Aether/Resources/KTX2Loader.h"
+
+#include <basisu/transcoder/basisu_transcoder.h>
+#include <basisu/zstd/zstd.h>
+
+#include <mutex>
+
+namespace Aether {
+
+    namespace Utils {
+
+        static constexpr uint8_t s_KTX2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+        struct KTX2Header
+        {
+            uint8_t Identifier[12];
+            uint32_t VkFormat;
+            uint32_t TypeSize;
+            uint32_t PixelWidth;
+            uint32_t PixelHeight;
+            uint32_t PixelDepth;
+            uint32_t LayerCount;
+            uint32_t FaceCount;
+            uint32_t LevelCount;
+            uint32_t SupercompressionScheme;
+            uint32_t DfdByteOffset;
+            uint32_t DfdByteLength;
+            uint32_t KvdByteOffset;
+            uint32_t KvdByteLength;
+            uint64_t SgdByteOffset;
+            uint64_t SgdByteLength;
+        };
+        static_assert(sizeof(KTX2Header) == 80, "KTX2 header layout");
+
+        // One entry per level, finest first
+        struct KTX2LevelIndex
+        {
+            uint64_t ByteOffset;
+            uint64_t ByteLength;
+            uint64_t UncompressedByteLength;
+        };
+
+        static constexpr uint32_t s_SupercompressionNone = 0;
+        static constexpr uint32_t s_SupercompressionZstd = 2;
+
+        // sRGB variants load as their UNORM twins, like every other texture in the pipeline
+        static ImageFormat VkFormatToImageFormat(uint32_t vkFormat)
+        {
+            switch (vkFormat)
+            {
+                case 37:  // VK_FORMAT_R8G8B8A8_UNORM
+                case 43:  return ImageFormat::RGBA8;    // VK_FORMAT_R8G8B8A8_SRGB
+                case 109: return ImageFormat::RGBA32F;  // VK_FORMAT_R32G32B32A32_SFLOAT
+                case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+                case 132: return ImageFormat::BC1;      // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+                case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+                case 138: return ImageFormat::BC3;      // VK_FORMAT_BC3_SRGB_BLOCK
+                case 141: return ImageFormat::BC5;      // VK_FORMAT_BC5_UNORM_BLOCK
+                case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+                case 146: return ImageFormat::BC7;      // VK_FORMAT_BC7_SRGB_BLOCK
+            }
+            return ImageFormat::None;
+        }
+
+        static basist::transcoder_texture_format ToTranscoderFormat(ImageFormat format)
+        {
+            switch (format)
+            {
+                case ImageFormat::BC1: return basist::transcoder_texture_format::cTFBC1_RGB;
+                case ImageFormat::BC3: return basist::transcoder_texture_format::cTFBC3_RGBA;
+                case ImageFormat::BC5: return basist::transcoder_texture_format::cTFBC5_RG;
+                case ImageFormat::BC7: return basist::transcoder_texture_format::cTFBC7_RGBA;
+                default:               return basist::transcoder_texture_format::cTFRGBA32;
+            }
+        }
+    }
+
+    bool KTX2Loader::IsKTX2(const void* data, size_t size)
+    {
+        return size >= sizeof(Utils::KTX2Header) && memcmp(data, Utils::s_KTX2Identifier, sizeof(Utils::s_KTX2Identifier)) == 0;
+    }
+
+    Ref<MipChain> KTX2Loader::Load(const void* data, size_t size, bool wrapMode, ImageFormat preferred)
+    {
+        if (!IsKTX2(data, size))
+        {
+            AE_CORE_ERROR("KTX2Loader: Not a KTX2 file");
+            return nullptr;
+        }
+
+        Utils::KTX2Header header;
+        memcpy(&header, data, sizeof(header));
+        if (header.PixelDepth > 1 || header.LayerCount > 1 || header.FaceCount != 1)
+        {
+            AE_CORE_ERROR("KTX2Loader: Only 2D textures are supported");
+            return nullptr;
+        }
+
+        // Basis payloads (ETC1S via BasisLZ, UASTC with or without Zstd) leave vkFormat undefined
+        auto chain = header.VkFormat == 0 ? Transcode(data, size, preferred) : ReadLevels(data, size);
+        if (!chain)
+            return nullptr;
+
+        chain->Spec.WrapMode = wrapMode;
+        chain->Spec.Streamed = true;
+        chain->Spec.GenerateMips = false;
+        chain->Spec.MipLevels = (uint32_t)chain->Levels.size();
+        return chain;
+    }
+
+    Ref<MipChain> KTX2Loader::LoadFile(const std::string& filepath, bool wrapMode, ImageFormat preferred)
+    {
+        std::ifstream in(filepath, std::ios::in | std::ios::binary);
+        if (!in)
+        {
+            AE_CORE_ERROR("KTX2Loader: Could not open '{0}'", filepath);
+            return nullptr;
+        }
+
+        in.seekg(0, std::ios::end);
+        std::vector<uint8_t> data((size_t)in.tellg());
+        in.seekg(0, std::ios::beg);
+        in.read((char*)data.data(), data.size());
+
+        return Load(data.data(), data.size(), wrapMode, preferred);
+    }
+
+    Ref<MipChain> KTX2Loader::Transcode(const void* data, size_t size, ImageFormat preferred)
+    {
+        static std::once_flag s_InitFlag;
+        std::call_once(s_InitFlag, []() { basist::basisu_transcoder_init(); });
+
+        // One transcoder per call keeps workers independent
+        basist::ktx2_transcoder transcoder;
+        if (!transcoder.init(data, (uint32_t)size) || !transcoder.start_transcoding())
+        {
+            AE_CORE_ERROR("KTX2Loader: Invalid Basis Universal payload");
+            return nullptr;
+        }
+
+        ImageFormat format = TextureCooker::SelectCompression(preferred);
+        if (format == ImageFormat::BC1 && transcoder.get_has_alpha())
+            format = TextureCooker::SelectCompression(ImageFormat::BC3);
+        if (format == ImageFormat::None)
+            format = ImageFormat::RGBA8;
+
+        auto target = Utils::ToTranscoderFormat(format);
+        uint32_t unitSize = basist::basis_get_bytes_per_block_or_pixel(target);
+
+        auto chain = CreateRef<MipChain>();
+        chain->Spec.Width = transcoder.get_width();
+        chain->Spec.Height = transcoder.get_height();
+        chain->Spec.Format = format;
+
+        // Blocks for BCn, pixels for the RGBA fallback
+        std::vector<uint32_t> units;
+        size_t totalSize = 0;
+        for (uint32_t level = 0; level < std::max(transcoder.get_levels(), 1u); level++)
+        {
+            basist::ktx2_image_level_info info;
+            if (!transcoder.get_image_level_info(info, level, 0, 0))
+            {
+                AE_CORE_ERROR("KTX2Loader: Missing level {0}", level);
+                return nullptr;
+            }
+
+            units.push_back(format == ImageFormat::RGBA8 ? info.m_orig_width * info.m_orig_height : info.m_total_blocks);
+            chain->Levels.push_back({ info.m_orig_width, info.m_orig_height, totalSize, (size_t)units.back() * unitSize });
+            totalSize += chain->Levels.back().Size;
+        }
+
+        chain->Data.resize(totalSize);
+        for (uint32_t level = 0; level < (uint32_t)chain->Levels.size(); level++)
+        {
+            if (!transcoder.transcode_image_level(level, 0, 0, chain->Data.data() + chain->Levels[level].Offset, units[level], target))
+            {
+                AE_CORE_ERROR("KTX2Loader: Failed to transcode level {0}", level);
+                return nullptr;
+            }
+        }
+
+        return chain;
+    }
+
+    Ref<MipChain> KTX2Loader::ReadLevels(const void* data, size_t size)
+    {
+        const uint8_t* bytes = (const uint8_t*)data;
+
+        Utils::KTX2Header header;
+        memcpy(&header, bytes, sizeof(header));
+
+        ImageFormat format = Utils::VkFormatToImageFormat(header.VkFormat);
+        if (format == ImageFormat::None || !Texture2D::IsFormatSupported(format))
+        {
+            AE_CORE_ERROR("KTX2Loader: Unsupported vkFormat {0}", header.VkFormat);
+            return nullptr;
+        }
+
+        if (header.SupercompressionScheme != Utils::s_SupercompressionNone && header.SupercompressionScheme != Utils::s_SupercompressionZstd)
+        {
+            AE_CORE_ERROR("KTX2Loader: Unsupported supercompression scheme {0}", header.SupercompressionScheme);
+            return nullptr;
+        }
+
+        // A level count of 0 asks for runtime mip generation; only the base level is stored
+        uint32_t levelCount = std::max(header.LevelCount, 1u);
+        if (sizeof(header) + levelCount * sizeof(Utils::KTX2LevelIndex) > size)
+        {
+            AE_CORE_ERROR("KTX2Loader: Truncated level index");
+            return nullptr;
+        }
+
+        auto chain = CreateRef<MipChain>();
+        chain->Spec.Width = header.PixelWidth;
+        chain->Spec.Height = header.PixelHeight;
+        chain->Spec.Format = format;
+
+        std::vector<Utils::KTX2LevelIndex> index(levelCount);
+        memcpy(index.data(), bytes + sizeof(header), levelCount * sizeof(Utils::KTX2LevelIndex));
+
+        size_t totalSize = 0;
+        for (uint32_t level = 0; level < levelCount; level++)
+        {
+            uint32_t width = std::max(header.PixelWidth >> level, 1u);
+            uint32_t height = std::max(header.PixelHeight >> level, 1u);
+            size_t levelSize = (size_t)Texture::CalculateLevelSize(format, width, height);
+
+            const auto& entry = index[level];
+            uint64_t stored = header.SupercompressionScheme == Utils::s_SupercompressionZstd ? entry.UncompressedByteLength : entry.ByteLength;
+            if (entry.ByteOffset + entry.ByteLength > size || stored != levelSize)
+            {
+                AE_CORE_ERROR("KTX2Loader: Level {0} is malformed", level);
+                return nullptr;
+            }
+
+            chain->Levels.push_back({ width, height, totalSize, levelSize });
+            totalSize += levelSize;
+        }
+
+        chain->Data.resize(totalSize);
+        for (uint32_t level = 0; level < levelCount; level++)
+        {
+            const auto& entry = index[level];
+            const auto& mip = chain->Levels[level];
+            uint8_t* dst = chain->Data.data() + mip.Offset;
+
+            if (header.SupercompressionScheme == Utils::s_SupercompressionNone)
+            {
+                memcpy(dst, bytes + entry.ByteOffset, mip.Size);
+                continue;
+            }
+
+            size_t result = ZSTD_decompress(dst, mip.Size, bytes + entry.ByteOffset, (size_t)entry.ByteLength);
+            if (ZSTD_isError(result) || result != mip.Size)
+            {
+                AE_CORE_ERROR("KTX2Loader: Failed to inflate level {0}", level);
+                return nullptr;
+            }
+        }
+
+        return chain;
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Resources/TextureCooker.h"
+
+namespace Aether {
+
+    // Reads 2D KTX2 textures into a MipChain ready for TextureStreamer. Basis Universal payloads
+    // (ETC1S / UASTC) are transcoded to the requested block format, or the closest one the GPU
+    // supports; files that already hold BCn or RGBA levels are passed through, Zstd included.
+    // CPU only, safe on worker threads. KTX2 textures keep the file's orientation.
+    class AETHER_API KTX2Loader
+    {
+    public:
+        static bool IsKTX2(const void* data, size_t size);
+
+        static Ref<MipChain> Load(const void* data, size_t size, bool wrapMode = false, ImageFormat preferred = ImageFormat::BC7);
+        static Ref<MipChain> LoadFile(const std::string& filepath, bool wrapMode = false, ImageFormat preferred = ImageFormat::BC7);
+
+    private:
+        static Ref<MipChain> Transcode(const void* data, size_t size, ImageFormat preferred);
+        static Ref<MipChain> ReadLevels(const void* data, size_t size);
+    };
+}
@@ -1,4 +1,5 @@
 #include "Aether/Resources/Material.h"
+#include "Aether/Resources/TextureStreamer.h"
 
 namespace Aether {
     Material::Material(UUID ShaderID)
@@ -10,8 +11,17 @@ namespace Aether {
     {
         m_Shader->Bind();
 
-        for (const auto& [name, texture] : m_Textures)
+        for (auto& [name, binding] : m_Textures)
         {
+            Texture2D* texture = Texture2DLibrary::Resolve(binding.Handle);
+            if (!texture)
+            {
+                binding.Handle = Texture2DLibrary::GetHandle(binding.ID);
+                texture = Texture2DLibrary::Resolve(binding.Handle);
+                if (!texture)
+                    continue;
+            }
+
             texture->Bind(startSlot);
             m_Shader->SetInt(name, startSlot);
             startSlot++;
@@ -22,11 +32,17 @@ namespace Aether {
     {
         auto it = m_Textures.find(name);
         if (it != m_Textures.end())
-            return it->second;
+            return Texture2DLibrary::Get(it->second.ID);
         AE_CORE_WARN("NO TEXTURE FOUND IN THIS MATERIAL!");
         return nullptr;
     }
 
+    void Material::RequestTextureResolution(float screenPixels) const
+    {
+        for (const auto& [name, binding] : m_Textures)
+            TextureStreamer::Request(binding.Handle, screenPixels);
+    }
+
     void Material::UploadMaterial()
     {
         m_Shader->Bind();
@@ -51,7 +67,7 @@ namespace Aether {
 
     void Material::SetTexture(const std::string& name, UUID TextureID)
     {
-        m_Textures[name] = Texture2DLibrary::Get(TextureID);
+        m_Textures[name] = { TextureID, Texture2DLibrary::GetHandle(TextureID) };
     }
 
     void Material::SetFloat(const std::string& name, float value)
@@ -86,32 +102,31 @@ namespace Aether {
 
     void MaterialLibrary::Init()
     {
-        GetMaterials().reserve(128);
         AE_CORE_INFO("MaterialLibrary initialized");
     }
 
     void MaterialLibrary::Shutdown()
     {
-        GetMaterials().clear();
+        GetRegistry().Clear();
     }
 
     Ref<Material> MaterialLibrary::Load(UUID ShaderID, UUID id)
     {
-        auto& materials = GetMaterials();
-        if(materials.find(id) != materials.end()) 
-            return materials[id];
+        auto& registry = GetRegistry();
+        Handle<Material> handle;
+        if (!registry.Acquire(id, handle, AssetState::Loading))
+            return registry.Get(handle);
 
         auto material = CreateRef<Material>(ShaderID);
 
-        materials[id] = material;
+        registry.Publish(handle, material);
         return material;
     }
 
     Ref<Material> MaterialLibrary::Get(UUID id)
     {
-        auto& materials = GetMaterials();
-        if (materials.find(id) != materials.end()) 
-            return materials[id];
+        if (auto material = GetRegistry().Get(id))
+            return material;
 
         AE_CORE_WARN("Material Library: Material ID not found!");
         return nullptr;
@@ -119,13 +134,22 @@ namespace Aether {
 
     bool MaterialLibrary::Exists(UUID id)
     {
-        auto& materials = GetMaterials();
-        return materials.find(id) != materials.end();
+        return GetRegistry().IsReady(id);
+    }
+
+    AssetState MaterialLibrary::GetState(UUID id)
+    {
+        return GetRegistry().GetState(id);
+    }
+
+    Handle<Material> MaterialLibrary::GetHandle(UUID id)
+    {
+        return GetRegistry().Find(id);
     }
 
-    std::unordered_map<UUID, Ref<Material>>& MaterialLibrary::GetMaterials()
+    ResourceRegistry<Material>& MaterialLibrary::GetRegistry()
     {
-        static std::unordered_map<UUID, Ref<Material>> s_Materials;
-        return s_Materials;
+        static ResourceRegistry<Material> s_Registry;
+        return s_Registry;
     }
 }
\ No newline at end of file
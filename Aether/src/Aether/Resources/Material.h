@@ -3,6 +3,7 @@
 #include "Aether/Resources/Texture.h"
 #include "Aether/Resources/Shader.h"
 #include "Aether/Core/UUID.h"
+#include "Aether/Resources/ResourceRegistry.h"
 
 namespace Aether {
     enum class MaterialFlag
@@ -37,12 +38,22 @@ namespace Aether {
         void SetFloat4(const std::string& name, const glm::vec4& value);
         void SetMat4(const std::string& name, const glm::mat4& value);
 
+        // Feeds TextureStreamer: the object drawn with this material covers about `screenPixels` pixels
+        void RequestTextureResolution(float screenPixels) const;
+
         void SetFlags(uint32_t flags) { m_Flags = flags; }
         uint32_t GetFlags() const { return m_Flags; }
     private:
         Ref<Shader> m_Shader;
 
-        std::unordered_map<std::string, Ref<Texture2D>> m_Textures;
+        struct TextureBinding
+        {
+            UUID ID = 0;
+            // Re-resolved from ID only while the texture isn't loaded yet
+            Texture2DHandle Handle;
+        };
+
+        std::unordered_map<std::string, TextureBinding> m_Textures;
 
         std::unordered_map<std::string, float> m_FloatUniforms;
         std::unordered_map<std::string, int> m_IntUniforms;
@@ -66,7 +77,13 @@ namespace Aether {
         static Ref<Material> Get(UUID id);
 
         static bool Exists(UUID id);
+        static AssetState GetState(UUID id);
+
+        static Handle<Material> GetHandle(UUID id);
+        static Material* Resolve(Handle<Material> handle) { return GetRegistry().Resolve(handle); }
     private:
-        static std::unordered_map<UUID, Ref<Material>>& GetMaterials();
+        static ResourceRegistry<Material>& GetRegistry();
     };
+
+    using MaterialHandle = Handle<Material>;
 }
\ No newline at end of file
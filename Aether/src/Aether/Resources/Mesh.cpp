@@ -8,6 +8,7 @@ namespace Aether {
     
     Mesh::Mesh(const MeshSpec& spec)
         : m_SubMeshes(spec.Submeshes)
+        , m_BVH(spec.BVH)
         , m_VertexCount(spec.Streams[0].VertexCount)
         , m_IndexCount(spec.IndexCount)
     {
@@ -17,6 +18,7 @@ namespace Aether {
         m_VertexArray = VertexArray::Create();
         auto ibo = IndexBuffer::Create((uint32_t*)spec.IndexData, spec.IndexCount);
         m_VertexArray->SetIndexBuffer(ibo);
+        m_MemorySize = (uint64_t)spec.IndexCount * sizeof(uint32_t);
 
         m_VertexCount = spec.Streams[0].VertexCount;
 
@@ -30,6 +32,7 @@ namespace Aether {
             auto vbo = VertexBuffer::Create((float*)vbuffer.Data, byteSize);
             vbo->SetLayout(vbuffer.Layout);
             m_VertexArray->AddVertexBuffer(vbo);
+            m_MemorySize += byteSize;
         }
         // Create default submesh if none provided
         if (m_SubMeshes.empty())
@@ -68,44 +71,71 @@ namespace Aether {
 
     void MeshLibrary::Init()
     {
-        GetMeshes().reserve(128);
         AE_CORE_INFO("MeshLibrary initialized");
     }
 
     void MeshLibrary::Shutdown()
     {
-        
-         GetMeshes().clear();
+        GetRegistry().Clear();
     }
 
     Ref<Mesh> MeshLibrary::Load(MeshSpec spec, UUID id)
     {
-        auto& meshes = GetMeshes();
-        if (meshes.find(id) != meshes.end())
-            return meshes[id];
+        auto& registry = GetRegistry();
+        Handle<Mesh> handle;
+        if (!registry.Acquire(id, handle, AssetState::Loading))
+            return registry.Get(handle);
 
         auto mesh = CreateRef<Mesh>(spec);
-        meshes[id] = mesh;
+        registry.Publish(handle, mesh);
+        registry.SetMemorySize(handle, mesh->GetMemorySize());
         return mesh;
     }
 
     Ref<Mesh> MeshLibrary::Get(UUID id)
     {
-        auto& meshes = GetMeshes();
-        if (meshes.find(id) != meshes.end())
-            return meshes[id];
-        return nullptr;
+        return GetRegistry().Get(id);
     }
 
     bool MeshLibrary::Exists(UUID id)
     {
-        auto& meshes = GetMeshes();
-        return meshes.find(id) != meshes.end();
+        return GetRegistry().IsReady(id);
+    }
+
+    AssetState MeshLibrary::GetState(UUID id)
+    {
+        return GetRegistry().GetState(id);
+    }
+
+    Handle<Mesh> MeshLibrary::Reserve(UUID id)
+    {
+        Handle<Mesh> handle;
+        GetRegistry().Acquire(id, handle, AssetState::Queued);
+        return handle;
+    }
+
+    Handle<Mesh> MeshLibrary::GetHandle(UUID id)
+    {
+        return GetRegistry().Find(id);
+    }
+
+    void MeshLibrary::Replace(UUID id, const Ref<Mesh>& mesh)
+    {
+        AE_CORE_ASSERT(mesh, "Mesh Library: Cannot replace with a null mesh!");
+        Handle<Mesh> handle = GetRegistry().Replace(id, mesh);
+        GetRegistry().SetMemorySize(handle, mesh->GetMemorySize());
+    }
+
+    void MeshLibrary::SetReloadCallback(UUID id, std::function<void()> reload)
+    {
+        Handle<Mesh> handle = GetRegistry().Find(id);
+        AE_CORE_ASSERT(handle, "Mesh Library: Cannot set a reloader on an unknown mesh!");
+        GetRegistry().SetReloader(handle, std::move(reload));
     }
 
-    std::unordered_map<UUID, Ref<Mesh>>& MeshLibrary::GetMeshes()
+    ResourceRegistry<Mesh>& MeshLibrary::GetRegistry()
     {
-        static std::unordered_map<UUID, Ref<Mesh>> s_Meshes;
-        return s_Meshes;
+        static ResourceRegistry<Mesh> s_Registry;
+        return s_Registry;
     }
 }
\ No newline at end of file
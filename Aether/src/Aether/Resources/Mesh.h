@@ -1,10 +1,14 @@
 #pragma once
 #include "aepch.h"
 #include "Aether/Core/UUID.h"
+#include "Aether/Resources/ResourceRegistry.h"
 #include "Aether/Renderer/VertexArray.h"
 #include "Aether/Renderer/Buffer.h"
 
 namespace Aether {
+    class Material;
+    class TriangleBVH;
+
     struct SubMesh
     {
         uint32_t BaseVertex = 0;
@@ -19,6 +23,8 @@ namespace Aether {
         glm::mat4 LocalTransform = glm::mat4(1.0f);
 
         UUID MaterialID = 0;
+        // Resolved from MaterialID at upload so drawing doesn't hash per submesh
+        Handle<Material> MaterialHandle;
     };
 
     class MeshLayout 
@@ -81,6 +87,8 @@ namespace Aether {
         const uint32_t* IndexData = nullptr;
         uint32_t IndexCount = 0;
         std::vector<SubMesh> Submeshes = {};
+        // CPU-side triangles for ray picking; optional
+        Ref<TriangleBVH> BVH;
     };
 
     class AETHER_API Mesh 
@@ -94,20 +102,27 @@ namespace Aether {
         
         uint32_t GetVertexCount() const { return m_VertexCount; }
         uint32_t GetIndexCount() const { return m_IndexCount; }
+        // Bytes of every vertex stream plus the index buffer
+        uint64_t GetMemorySize() const { return m_MemorySize; }
 
         const glm::vec3& GetBoundsMin() const { return m_BoundsMin; }
         const glm::vec3& GetBoundsMax() const { return m_BoundsMax; }
         glm::vec3 GetBoundsCenter() const { return (m_BoundsMin + m_BoundsMax) * 0.5f; }
         glm::vec3 GetBoundsExtents() const { return (m_BoundsMax - m_BoundsMin) * 0.5f; }
 
+        // Null for meshes created without one, e.g. procedural shapes
+        const Ref<TriangleBVH>& GetBVH() const { return m_BVH; }
+
     private:
         Ref<VertexArray> m_VertexArray;
 
         BufferLayout m_Layout;
         std::vector<SubMesh> m_SubMeshes;
+        Ref<TriangleBVH> m_BVH;
         
         uint32_t m_VertexCount = 0;
         uint32_t m_IndexCount = 0;
+        uint64_t m_MemorySize = 0;
         glm::vec3 m_BoundsMin = glm::vec3(0.0f);
         glm::vec3 m_BoundsMax = glm::vec3(0.0f);
 
@@ -121,10 +136,24 @@ namespace Aether {
         static void Shutdown();
 
         static Ref<Mesh> Load(MeshSpec spec, UUID id);
+        // Claims an ID in the Queued state so its handle exists before the mesh is built; Replace() fills it
+        static Handle<Mesh> Reserve(UUID id);
         static Ref<Mesh> Get(UUID id);
         static bool Exists(UUID id);
+        static AssetState GetState(UUID id);
+
+        static Handle<Mesh> GetHandle(UUID id);
+        static Mesh* Resolve(Handle<Mesh> handle) { return GetRegistry().Resolve(handle); }
+
+        // Swaps the mesh behind an ID; handles stay valid and resolve to the new one
+        static void Replace(UUID id, const Ref<Mesh>& mesh);
+
+        // Makes a mesh evictable under the GPU budget; `reload` must bring it back through Replace()
+        static void SetReloadCallback(UUID id, std::function<void()> reload);
 
     private:
-        static std::unordered_map<UUID, Ref<Mesh>>& GetMeshes();
+        static ResourceRegistry<Mesh>& GetRegistry();
     };
+
+    using MeshHandle = Handle<Mesh>;
 }
\ No newline at end of file
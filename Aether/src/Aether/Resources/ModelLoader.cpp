@@ -1,6 +1,12 @@
 #include "aepch.h"
 #include "ModelLoader.h"
 #include "Aether/Core/AssetsRegister.h"
+#include "Aether/Core/Application.h"
+#include "Aether/Core/JobSystem.h"
+#include "Aether/Renderer/Renderer.h"
+#include "Aether/Resources/AssetWatcher.h"
+#include "Aether/Resources/KTX2Loader.h"
+#include <unordered_set>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -46,10 +52,17 @@ namespace Aether {
                 const uint8_t* bufferPtr = (const uint8_t*)view->buffer->data + view->offset;
                 size_t bufferSize = view->size;
                 
-                if (bufferPtr)
+                if (bufferPtr && KTX2Loader::IsKTX2(bufferPtr, bufferSize))
+                {
+                    // KHR_texture_basisu: transcoded on a worker at upload time
+                    texInfo.Spec.WrapMode = true;
+                    texInfo.Cook.Compression = ImageFormat::BC7;
+                    texInfo.KTX2Data = CreateRef<std::vector<uint8_t>>(bufferPtr, bufferPtr + bufferSize);
+                }
+                else if (bufferPtr)
                 {
                     int width, height, channels;
-                    stbi_set_flip_vertically_on_load(0);
+                    stbi_set_flip_vertically_on_load_thread(0);
                     stbi_uc* pixels = stbi_load_from_memory(bufferPtr, (int)bufferSize, &width, &height, &channels, 4);
                     if (pixels)
                     {
@@ -58,8 +71,9 @@ namespace Aether {
                         texInfo.Spec.Format = ImageFormat::RGBA8; 
                         texInfo.Spec.GenerateMips = true;
                         texInfo.Spec.WrapMode = true; 
-                        texInfo.RawData.assign(pixels, pixels + (width * height * 4));
-                        stbi_image_free(pixels);
+                        texInfo.Cook.Filter = MipFilter::Kaiser;
+                        texInfo.Cook.Compression = ImageFormat::BC7;
+                        texInfo.RawData = Ref<uint8_t>(pixels, stbi_image_free);
                     }
                 }
             
@@ -69,6 +83,13 @@ namespace Aether {
             modelData.Textures.push_back(std::move(texInfo));
         }
 
+        // KHR_texture_basisu puts the KTX2 image next to (or instead of) the regular one
+        auto imageIndex = [data](const cgltf_texture* tex) -> size_t
+        {
+            const cgltf_image* image = tex->has_basisu && tex->basisu_image ? tex->basisu_image : tex->image;
+            return image ? (size_t)(image - data->images) : SIZE_MAX;
+        };
+
         for (size_t i = 0; i < data->materials_count; i++)
         {
             cgltf_material* mat = &data->materials[i];
@@ -77,8 +98,12 @@ namespace Aether {
             if (mat->pbr_metallic_roughness.base_color_texture.texture)
             {
                 cgltf_texture* tex = mat->pbr_metallic_roughness.base_color_texture.texture;
-                size_t texIndex = tex->image - data->images;
-                if (texIndex < modelData.Textures.size()) matInfo.AlbedoMapIdx = texIndex;
+                size_t texIndex = imageIndex(tex);
+                if (texIndex < modelData.Textures.size())
+                {
+                    matInfo.AlbedoMapIdx = texIndex;
+                    modelData.Textures[texIndex].Cook.SRGB = true;
+                }
             }
 
             // Base color factor
@@ -94,7 +119,7 @@ namespace Aether {
             if (mat->pbr_metallic_roughness.metallic_roughness_texture.texture)
             {
                 cgltf_texture* tex = mat->pbr_metallic_roughness.metallic_roughness_texture.texture;
-                size_t texIndex = tex->image - data->images;
+                size_t texIndex = imageIndex(tex);
                 if (texIndex < modelData.Textures.size()) matInfo.MetallicRoughnessMapIdx = texIndex;
             }
 
@@ -105,8 +130,13 @@ namespace Aether {
             if (mat->normal_texture.texture)
             {
                 cgltf_texture* tex = mat->normal_texture.texture;
-                size_t texIndex = tex->image - data->images;
-                if (texIndex < modelData.Textures.size())  matInfo.NormalMapIdx = texIndex;
+                size_t texIndex = imageIndex(tex);
+                if (texIndex < modelData.Textures.size())
+                {
+                    matInfo.NormalMapIdx = texIndex;
+                    // Two channels are enough, the shader rebuilds z
+                    modelData.Textures[texIndex].Cook.Compression = ImageFormat::BC5;
+                }
             }
 
             modelData.Materials.push_back(matInfo);
@@ -267,6 +297,12 @@ namespace Aether {
             }
             AE_CORE_INFO("Parsed mesh with {0} vertices, {1} indices, {2} submeshes", 
                 totalVertices, totalIndices, meshInfo.SubMeshes.size());
+
+            std::vector<TriangleRange> ranges;
+            ranges.reserve(meshInfo.SubMeshes.size());
+            for (const auto& subInfo : meshInfo.SubMeshes)
+                ranges.push_back({subInfo.BaseVertex, subInfo.BaseIndex, subInfo.IndexCount});
+            meshInfo.BVH = CreateRef<TriangleBVH>(meshInfo.Positions.data(), totalVertices, meshInfo.Indices.data(), ranges);
             modelData.Meshes.push_back(meshInfo);
         }
 
@@ -274,18 +310,97 @@ namespace Aether {
         return modelData;
     }
 
-   std::vector<UUID> ModelLoader::UploadModel(const ModelLoadResult& modelData, UUID shaderID)
+    std::vector<UUID> ModelLoader::UploadModel(const Ref<ModelLoadResult>& modelData, UUID shaderID)
     {
+        GetUploadedModels()[AssetWatcher::NormalizePath(modelData->FilePath)] = shaderID;
+
+        // Handles exist right away; the meshes behind them are built where the GL context lives
         std::vector<UUID> meshIDs;
+        for (const auto& meshInfo : modelData->Meshes)
+        {
+            UUID meshID = AssetsRegister::Register(meshInfo.DebugName);
+            MeshLibrary::Reserve(meshID);
+            meshIDs.push_back(meshID);
+        }
+
+        Renderer::Submit([modelData, shaderID]() { Upload(*modelData, shaderID, false); });
+        return meshIDs;
+    }
+
+    void ModelLoader::OnFileChanged(const std::string& filepath)
+    {
+        auto& models = GetUploadedModels();
+        auto it = models.find(AssetWatcher::NormalizePath(filepath));
+        if (it == models.end())
+            return;
+
+        Reload(it->first, it->second);
+    }
+
+    void ModelLoader::Reload(const std::string& path, UUID shaderID)
+    {
+        // Every evicted mesh and texture of a model asks for the same re-import
+        static std::unordered_set<std::string> s_PendingReloads;
+        static std::mutex s_PendingMutex;
+        {
+            std::lock_guard<std::mutex> lock(s_PendingMutex);
+            if (!s_PendingReloads.insert(path).second)
+                return;
+        }
+
+        JobSystem::SubmitJob([path, shaderID]()
+        {
+            auto modelData = CreateRef<ModelLoadResult>(Parsing(path));
+            if (modelData->Meshes.empty())
+            {
+                AE_CORE_ERROR("ModelLoader: Failed to reload '{0}', keeping the old model", path);
+                std::lock_guard<std::mutex> lock(s_PendingMutex);
+                s_PendingReloads.erase(path);
+                return;
+            }
+
+            Application::Get().SubmitToMainThread([modelData, path, shaderID]()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(s_PendingMutex);
+                    s_PendingReloads.erase(path);
+                }
+
+                Renderer::Submit([modelData, shaderID]()
+                {
+                    Upload(*modelData, shaderID, true);
+                    AE_CORE_INFO("ModelLoader: Reloaded '{0}'", modelData->FilePath);
+                });
+            });
+        });
+    }
+
+    std::vector<UUID> ModelLoader::Upload(const ModelLoadResult& modelData, UUID shaderID, bool replace)
+    {
+        // IDs are hashed from names that are stable across re-imports, so a reload resolves to the same IDs
+        std::vector<UUID> meshIDs;
+
+        // Evicted meshes and textures come back by re-importing the whole model
+        std::string path = AssetWatcher::NormalizePath(modelData.FilePath);
+        auto reload = [path, shaderID]() { Reload(path, shaderID); };
         
         // Upload textures
         std::vector<UUID> texIDs;
         for (const auto& texInfo : modelData.Textures)
         {
             UUID texID = AssetsRegister::Register(texInfo.DebugName);
-            auto tex = Texture2DLibrary::Load(texInfo.Spec, texID);
-            tex->SetData((void*)texInfo.RawData.data(), texInfo.RawData.size());
             texIDs.push_back(texID);
+            if (!texInfo.RawData && !texInfo.KTX2Data)
+                continue;
+
+            // Mips are cooked (or transcoded) on a worker and streamed in; materials pick the texture up once it's Ready
+            if (texInfo.KTX2Data)
+                Texture2DLibrary::LoadKTX2Async(texInfo.KTX2Data, texID, texInfo.Cook.Compression, texInfo.Spec.WrapMode, replace);
+            else
+                Texture2DLibrary::LoadAsync(texInfo.Spec, texInfo.RawData, texID, texInfo.Cook, replace);
+
+            if (!replace)
+                Texture2DLibrary::SetReloadCallback(texID, reload);
         }
         
         // Upload materials
@@ -324,6 +439,10 @@ namespace Aether {
         for (const auto& meshInfo : modelData.Meshes)
         {
             UUID meshID = AssetsRegister::Register(meshInfo.DebugName);
+            meshIDs.push_back(meshID);
+            // Reserved by UploadModel; anything past Queued was uploaded by an earlier call
+            if (!replace && MeshLibrary::GetState(meshID) != AssetState::Queued)
+                continue;
             
             // Convert SubMeshCreateInfo to SubMesh
             std::vector<SubMesh> submeshes;
@@ -341,7 +460,10 @@ namespace Aether {
                 
                 // Assign material
                 if (subInfo.MaterialIdx >= 0 && subInfo.MaterialIdx < matIDs.size())
+                {
                     sm.MaterialID = matIDs[subInfo.MaterialIdx];
+                    sm.MaterialHandle = MaterialLibrary::GetHandle(sm.MaterialID);
+                }
                 
                 submeshes.push_back(sm);
             }
@@ -357,9 +479,11 @@ namespace Aether {
             spec.IndexData = meshInfo.Indices.data();
             spec.IndexCount = meshInfo.totalIndices;
             spec.Submeshes = submeshes;
+            spec.BVH = meshInfo.BVH;
             
-            MeshLibrary::Load(spec, meshID);
-            meshIDs.push_back(meshID);
+            MeshLibrary::Replace(meshID, CreateRef<Mesh>(spec));
+            if (!replace)
+                MeshLibrary::SetReloadCallback(meshID, reload);
         }
         
         AE_CORE_INFO("Uploaded model: {0} meshes, {1} materials, {2} textures", 
@@ -367,4 +491,10 @@ namespace Aether {
         
         return meshIDs;
     }
+
+    std::unordered_map<std::string, UUID>& ModelLoader::GetUploadedModels()
+    {
+        static std::unordered_map<std::string, UUID> s_UploadedModels;
+        return s_UploadedModels;
+    }
 }
\ No newline at end of file
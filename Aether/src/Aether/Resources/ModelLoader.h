@@ -2,6 +2,7 @@
 #include "Aether/Resources/Mesh.h"
 #include "Aether/Resources/Texture.h"
 #include "Aether/Resources/Material.h"
+#include "Aether/Renderer/TriangleBVH.h"
 #include "Aether/Core/UUID.h"
 #include <glm/glm.hpp>
 #include <vector>
@@ -12,7 +13,12 @@ namespace Aether {
     {
         std::string DebugName;
         TextureSpec Spec;
-        std::vector<uint8_t> RawData;
+        // Set from how the materials use the image
+        TextureCookSettings Cook;
+        // Decoded RGBA8, owned by the decoder and shared with the upload job
+        Ref<uint8_t> RawData;
+        // Undecoded KTX2 file, used instead of RawData for KHR_texture_basisu images
+        Ref<std::vector<uint8_t>> KTX2Data;
     };
 
     struct MaterialCreateInfo
@@ -54,6 +60,9 @@ namespace Aether {
 
         uint32_t totalVertices = 0;
         uint32_t totalIndices = 0;
+
+        // Built while parsing so picking structures cost nothing on the main thread
+        Ref<TriangleBVH> BVH;
     };
 
     struct ModelLoadResult
@@ -68,6 +77,19 @@ namespace Aether {
     {
     public:
         static ModelLoadResult Parsing(const std::string& path);
-        static std::vector<UUID> UploadModel(const ModelLoadResult& modelData, UUID shaderID);
+        // Main thread: reserves the mesh IDs it returns and builds everything on the render thread.
+        // Handles resolve to null until then.
+        static std::vector<UUID> UploadModel(const Ref<ModelLoadResult>& modelData, UUID shaderID);
+
+        // Re-parses an uploaded model on a worker, then swaps its meshes and textures behind the same IDs
+        static void OnFileChanged(const std::string& filepath);
+
+    private:
+        // Thread that owns the GL context
+        static std::vector<UUID> Upload(const ModelLoadResult& modelData, UUID shaderID, bool replace);
+        // Re-parses on a worker and uploads with replace; safe from any thread
+        static void Reload(const std::string& path, UUID shaderID);
+        // Model path -> shader it was uploaded with
+        static std::unordered_map<std::string, UUID>& GetUploadedModels();
     };
 }
\ No newline at end of file
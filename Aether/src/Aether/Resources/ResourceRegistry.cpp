@@ -0,0 +1,41 @@
+#include "aepch.h"
+#include "Aether/Resources/ResourceRegistry.h"
+
+namespace Aether {
+
+    std::atomic<uint32_t> ResourceRegistryBase::s_FrameIndex{ 1 };
+
+    ResourceRegistryBase::ResourceRegistryBase()
+    {
+        std::lock_guard<std::mutex> lock(GetRegistriesMutex());
+        GetRegistries().push_back(this);
+    }
+
+    ResourceRegistryBase::~ResourceRegistryBase()
+    {
+        std::lock_guard<std::mutex> lock(GetRegistriesMutex());
+        auto& registries = GetRegistries();
+        registries.erase(std::remove(registries.begin(), registries.end(), this), registries.end());
+    }
+
+    void ResourceRegistryBase::CollectAll(std::vector<Ref<void>>& retired)
+    {
+        std::lock_guard<std::mutex> lock(GetRegistriesMutex());
+        for (auto* registry : GetRegistries())
+            registry->Collect(retired);
+
+        s_FrameIndex.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::vector<ResourceRegistryBase*>& ResourceRegistryBase::GetRegistries()
+    {
+        static std::vector<ResourceRegistryBase*> s_Registries;
+        return s_Registries;
+    }
+
+    std::mutex& ResourceRegistryBase::GetRegistriesMutex()
+    {
+        static std::mutex s_Mutex;
+        return s_Mutex;
+    }
+}
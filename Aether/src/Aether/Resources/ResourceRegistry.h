@@ -0,0 +1,216 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Core/UUID.h"
+#include "Aether/Core/HandlePool.h"
+#include "Aether/Core/ConcurrentHashMap.h"
+
+namespace Aether {
+
+    class AETHER_API ResourceRegistryBase
+    {
+    public:
+        virtual ~ResourceRegistryBase();
+
+        // Moves objects retired by hot reloads, removals and evictions in every registry into
+        // `retired` and advances the frame stamp. Called once per frame by Application, before any
+        // layer runs; it releases them on the thread that owns the GL context.
+        static void CollectAll(std::vector<Ref<void>>& retired);
+
+        // Stamp written by every Resolve()/Get(); drives LRU eviction
+        static uint32_t GetFrameIndex() { return s_FrameIndex.load(std::memory_order_relaxed); }
+
+    protected:
+        ResourceRegistryBase();
+
+        struct EvictionCandidate
+        {
+            ResourceRegistryBase* Registry = nullptr;
+            uint32_t Handle = 0;
+            uint64_t Bytes = 0;
+            uint32_t LastUsed = 0;
+        };
+
+        virtual void Collect(std::vector<Ref<void>>& retired) = 0;
+
+        // Bytes of every tracked object that is currently resident
+        virtual uint64_t GetResidentBytes() const = 0;
+        // Resident, reloadable objects not used since `frame`
+        virtual void GatherEvictionCandidates(std::vector<EvictionCandidate>& candidates, uint32_t frame) = 0;
+        virtual bool Evict(uint32_t handle) = 0;
+
+    private:
+        friend class GpuMemoryBudget;
+
+        static std::atomic<uint32_t> s_FrameIndex;
+
+        static std::vector<ResourceRegistryBase*>& GetRegistries();
+        static std::mutex& GetRegistriesMutex();
+    };
+
+    // UUID -> handle index over a HandlePool. Lookups are lock-free from any thread;
+    // registration is serialized, and each ID carries a load state callers can poll.
+    // Objects with a memory size and a reloader can be evicted by GpuMemoryBudget;
+    // using an evicted handle returns null and kicks off the reload.
+    template<typename T>
+    class ResourceRegistry : public ResourceRegistryBase
+    {
+    public:
+        using Reloader = std::function<void()>;
+
+        Handle<T> Find(UUID id) const
+        {
+            Handle<T> handle;
+            m_Handles.Find(id, handle);
+            return handle;
+        }
+
+        T* Resolve(Handle<T> handle)
+        {
+            T* item = m_Pool.Resolve(handle);
+            if (item)
+                m_Pool.Touch(handle, GetFrameIndex());
+            else
+                RequestReload(handle);
+            return item;
+        }
+
+        Ref<T> Get(Handle<T> handle)
+        {
+            Ref<T> item = m_Pool.Get(handle);
+            if (item)
+                m_Pool.Touch(handle, GetFrameIndex());
+            else
+                RequestReload(handle);
+            return item;
+        }
+
+        Ref<T> Get(UUID id) { return Get(Find(id)); }
+
+        AssetState GetState(UUID id) const { return m_Pool.GetState(Find(id)); }
+        bool IsReady(UUID id) const { return GetState(id) == AssetState::Ready; }
+
+        // Claims an ID for loading. Returns false (and the existing handle) if it was already claimed.
+        bool Acquire(UUID id, Handle<T>& handle, AssetState state = AssetState::Queued)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Handles.Find(id, handle))
+                return false;
+
+            handle = m_Pool.Allocate(state);
+            m_Handles.Set(id, handle);
+            return true;
+        }
+
+        void SetState(Handle<T> handle, AssetState state) { m_Pool.SetState(handle, state); }
+        void Publish(Handle<T> handle, const Ref<T>& item) { m_Pool.Publish(handle, item); }
+
+        // Publishes under an existing ID, or registers it if it's new
+        Handle<T> Replace(UUID id, const Ref<T>& item)
+        {
+            Handle<T> handle;
+            Acquire(id, handle, AssetState::Loading);
+            m_Pool.Publish(handle, item);
+            return handle;
+        }
+
+        // Counts the object against the GPU budget; call again when it's replaced
+        void SetMemorySize(Handle<T> handle, uint64_t bytes)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Residency[handle.Value].Bytes = bytes;
+            m_Pool.Touch(handle, GetFrameIndex());
+        }
+
+        // Makes the object evictable. `reload` may run on any thread and must Publish() it again.
+        void SetReloader(Handle<T> handle, Reloader reload)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Residency[handle.Value].Reload = std::move(reload);
+        }
+
+        template<typename Func>
+        void ForEach(Func&& func) const { m_Pool.ForEach(std::forward<Func>(func)); }
+
+        // Shutdown only: not safe against concurrent lookups
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Pool.Clear();
+            m_Handles.Clear();
+            m_Residency.clear();
+        }
+
+    protected:
+        virtual void Collect(std::vector<Ref<void>>& retired) override { m_Pool.Collect(retired); }
+
+        virtual uint64_t GetResidentBytes() const override
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            uint64_t bytes = 0;
+            for (const auto& [value, residency] : m_Residency)
+            {
+                if (m_Pool.GetState(ToHandle(value)) == AssetState::Ready)
+                    bytes += residency.Bytes;
+            }
+            return bytes;
+        }
+
+        virtual void GatherEvictionCandidates(std::vector<EvictionCandidate>& candidates, uint32_t frame) override
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (const auto& [value, residency] : m_Residency)
+            {
+                Handle<T> handle = ToHandle(value);
+                if (!residency.Reload || m_Pool.GetState(handle) != AssetState::Ready)
+                    continue;
+
+                uint32_t lastUsed = m_Pool.GetLastUsed(handle);
+                if (lastUsed < frame)
+                    candidates.push_back({ this, value, residency.Bytes, lastUsed });
+            }
+        }
+
+        virtual bool Evict(uint32_t handle) override { return m_Pool.Evict(ToHandle(handle)); }
+
+    private:
+        struct Residency
+        {
+            uint64_t Bytes = 0;
+            Reloader Reload;
+        };
+
+        static Handle<T> ToHandle(uint32_t value)
+        {
+            Handle<T> handle;
+            handle.Value = value;
+            return handle;
+        }
+
+        void RequestReload(Handle<T> handle)
+        {
+            // Lock-free early out: this runs on every miss, including plain invalid handles
+            if (m_Pool.GetState(handle) != AssetState::Evicted)
+                return;
+            if (!m_Pool.TransitionState(handle, AssetState::Evicted, AssetState::Queued))
+                return;
+
+            Reloader reload;
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                auto it = m_Residency.find(handle.Value);
+                if (it != m_Residency.end())
+                    reload = it->second.Reload;
+            }
+
+            if (reload)
+                reload();
+        }
+
+        HandlePool<T> m_Pool;
+        ConcurrentHashMap<UUID, Handle<T>> m_Handles{ 128 };
+        // Handle value -> budget bookkeeping, only for objects that reported a size
+        std::unordered_map<uint32_t, Residency> m_Residency;
+        mutable std::mutex m_Mutex;
+    };
+}
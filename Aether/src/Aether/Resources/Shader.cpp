@@ -1,6 +1,9 @@
 #include "Aether/Resources/Shader.h"
 #include "Aether/Renderer/Renderer.h"
+#include "Aether/Core/Application.h"
+#include "Aether/Resources/ShaderPreprocessor.h"
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/Null/NullShader.h"
 
 namespace Aether {
     Ref<Shader> Shader::Create(const std::string& filepath)
@@ -9,46 +12,53 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(filepath);
+			case RendererAPI::API::Null:    return CreateRef<NullShader>(filepath);
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
 		return nullptr;
 	}
 
+	Handle<Shader> ShaderLibrary::s_Placeholder;
+
 	void ShaderLibrary::Init()
     {
-        GetShaders().reserve(128);
         AE_CORE_INFO("ShaderLibrary initialized");
     }
 
     void ShaderLibrary::Shutdown()
     {
-        GetShaders().clear();
+        GetRegistry().Clear();
+        GetDependents().clear();
+        ShaderPreprocessor::ClearCache();
+        s_Placeholder = {};
     }
 
     Ref<Shader> ShaderLibrary::Load(const std::string& filepath, UUID id)
     {
-        auto& shaders = GetShaders();
-        if (shaders.find(id) != shaders.end())
-            return shaders[id];
+        auto& registry = GetRegistry();
+        Handle<Shader> handle;
+        if (!registry.Acquire(id, handle, AssetState::Loading))
+            return registry.Get(handle);
 
         auto shader = Shader::Create(filepath);
         
         if (!shader) 
         {
             AE_CORE_ERROR("Shader Library: Failed to load '{0}'", filepath);
+            registry.SetState(handle, AssetState::Failed);
             return nullptr;
         }
 
-        shaders[id] = shader;
+        registry.Publish(handle, shader);
+        TrackDependencies(id, shader->GetSourceFiles());
         return shader;
     }
 
     Ref<Shader> ShaderLibrary::Get(UUID id)
     {
-        auto& shaders = GetShaders();
-        if (shaders.find(id) != shaders.end())
-            return shaders[id];
+        if (auto shader = GetRegistry().Get(id))
+            return shader;
 
         AE_CORE_WARN("Shader Library: Shader ID not found!");
         return nullptr;
@@ -56,13 +66,110 @@ namespace Aether {
 
     bool ShaderLibrary::Exists(UUID id)
     {
-        auto& shaders = GetShaders();
-        return shaders.find(id) != shaders.end();
+        return GetRegistry().IsReady(id);
+    }
+
+    AssetState ShaderLibrary::GetState(UUID id)
+    {
+        return GetRegistry().GetState(id);
+    }
+
+    Handle<Shader> ShaderLibrary::GetHandle(UUID id)
+    {
+        return GetRegistry().Find(id);
+    }
+
+    void ShaderLibrary::SetPlaceholder(UUID id)
+    {
+        AE_CORE_ASSERT(Exists(id), "Shader Library: Placeholder shader must be loaded first!");
+        s_Placeholder = GetHandle(id);
+    }
+
+    Ref<Shader> ShaderLibrary::GetReady(UUID id)
+    {
+        Ref<Shader> shader = GetRegistry().Get(id);
+        if (shader && shader->IsReady())
+            return shader;
+
+        if (Ref<Shader> placeholder = GetRegistry().Get(s_Placeholder))
+            return placeholder;
+
+        // No placeholder registered: fall back to the real shader, binding it finishes the compile.
+        return shader;
+    }
+
+    bool ShaderLibrary::IsReady(UUID id)
+    {
+        Shader* shader = Resolve(GetHandle(id));
+        return shader && shader->IsReady();
+    }
+
+    bool ShaderLibrary::AllReady()
+    {
+        bool ready = true;
+        // Poll every shader so finished ones get finalized this frame
+        GetRegistry().ForEach([&ready](const Shader& shader) { ready &= shader.IsReady(); });
+        return ready;
+    }
+
+    void ShaderLibrary::Reload(UUID id)
+    {
+        Ref<Shader> shader = GetRegistry().Get(id);
+        if (!shader)
+        {
+            AE_CORE_WARN("Shader Library: Shader ID not found!");
+            return;
+        }
+
+        // Recompiles where the GL context lives; the include graph is main-thread state
+        Renderer::Submit([id, shader]()
+        {
+            shader->Reload();
+            std::vector<std::string> files = shader->GetSourceFiles();
+            Application::Get().SubmitToMainThread([id, files]() { TrackDependencies(id, files); });
+        });
+    }
+
+    std::vector<UUID> ShaderLibrary::OnFileChanged(const std::string& filepath)
+    {
+        std::string path = ShaderPreprocessor::NormalizePath(filepath);
+        ShaderPreprocessor::Invalidate(path);
+
+        auto& dependents = GetDependents();
+        auto it = dependents.find(path);
+        if (it == dependents.end())
+            return {};
+
+        std::vector<UUID> affected(it->second.begin(), it->second.end());
+        for (UUID id : affected)
+            Reload(id);
+
+        AE_CORE_INFO("Shader Library: '{0}' changed, recompiling {1} shader(s)", path, affected.size());
+        return affected;
+    }
+
+    void ShaderLibrary::TrackDependencies(UUID id, const std::vector<std::string>& files)
+    {
+        auto& dependents = GetDependents();
+        for (auto it = dependents.begin(); it != dependents.end();)
+        {
+            it->second.erase(id);
+            it = it->second.empty() ? dependents.erase(it) : std::next(it);
+        }
+
+        for (const auto& file : files)
+            dependents[file].insert(id);
+    }
+
+    std::unordered_map<std::string, std::unordered_set<UUID>>& ShaderLibrary::GetDependents()
+    {
+        static std::unordered_map<std::string, std::unordered_set<UUID>> s_Dependents;
+        return s_Dependents;
     }
 
-	std::unordered_map<UUID, Ref<Shader>>& ShaderLibrary::GetShaders()
+    ResourceRegistry<Shader>& ShaderLibrary::GetRegistry()
     {
-        static std::unordered_map<UUID, Ref<Shader>> s_Shaders;
-        return s_Shaders;
+        static ResourceRegistry<Shader> s_Registry;
+        return s_Registry;
     }
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include "aepch.h"
 #include "Aether/Core/UUID.h"
+#include "Aether/Resources/ResourceRegistry.h"
+
+#include <unordered_set>
 
 namespace Aether {
 
@@ -10,6 +13,9 @@ namespace Aether {
         std::string VertexSource;
         std::string FragmentSource;
         std::string GeometrySource;
+
+        // Index matches the source-string number in #line directives; [0] is the .shader itself
+        std::vector<std::string> SourceFiles;
     };
 
     class AETHER_API Shader 
@@ -20,6 +26,15 @@ namespace Aether {
         virtual void Bind() const = 0;
         virtual void Unbind() const = 0;
 
+        // Non-blocking: false while the driver is still compiling/linking in the background.
+        virtual bool IsReady() const = 0;
+
+        // Recompiles from disk; the previous program stays in use until the new one links
+        virtual void Reload() = 0;
+
+        virtual const std::string& GetPath() const = 0;
+        virtual const std::vector<std::string>& GetSourceFiles() const = 0;
+
         virtual void SetInt(const std::string& name, int value) = 0;
         virtual void SetIntArray(const std::string& name,const int* values, uint32_t count) = 0; 
         virtual void SetFloat(const std::string& name, float value) = 0;
@@ -39,8 +54,31 @@ namespace Aether {
         static Ref<Shader> Load(const std::string& filepath, UUID id);
         static Ref<Shader> Get(UUID id);
         static bool Exists(UUID id);
+        static AssetState GetState(UUID id);
+
+        static Handle<Shader> GetHandle(UUID id);
+        static Shader* Resolve(Handle<Shader> handle) { return GetRegistry().Resolve(handle); }
+
+        // Shader returned by GetReady() while the requested one is still compiling
+        static void SetPlaceholder(UUID id);
+        static Ref<Shader> GetReady(UUID id);
+
+        static bool IsReady(UUID id);
+        static bool AllReady();
+
+        // Main thread: queues the recompile on the render thread
+        static void Reload(UUID id);
+        // Queues a recompile of only the shaders that include the given file; returns their IDs
+        static std::vector<UUID> OnFileChanged(const std::string& filepath);
 
     private:
-        static std::unordered_map<UUID, Ref<Shader>>& GetShaders();
+        static ResourceRegistry<Shader>& GetRegistry();
+        // Source file -> shaders that pull it in (directly or through nested includes)
+        static std::unordered_map<std::string, std::unordered_set<UUID>>& GetDependents();
+        // Main thread only, like the graph itself
+        static void TrackDependencies(UUID id, const std::vector<std::string>& files);
+        static Handle<Shader> s_Placeholder;
     };
+
+    using ShaderHandle = Handle<Shader>;
 }
\ No newline at end of file
@@ -0,0 +1,288 @@
+#include "aepch.h"
+#include "Aether/Resources/ShaderPreprocessor.h"
+
+#include <regex>
+
+namespace Aether {
+
+    std::unordered_map<std::string, Ref<ShaderPreprocessor::ParsedFile>> ShaderPreprocessor::s_Cache;
+    std::vector<std::string> ShaderPreprocessor::s_IncludeDirectories = { "assets/shaders/include" };
+    std::mutex ShaderPreprocessor::s_Mutex;
+
+    namespace Utils {
+        static std::string TrimLeft(const std::string& line)
+        {
+            size_t start = line.find_first_not_of(" \t");
+            return start == std::string::npos ? std::string() : line.substr(start);
+        }
+
+        static bool StartsWith(const std::string& str, const char* prefix)
+        {
+            return str.rfind(prefix, 0) == 0;
+        }
+
+        static bool IsBlank(const std::string& line)
+        {
+            return line.find_first_not_of(" \t\r") == std::string::npos;
+        }
+    }
+
+    ShaderProgramSource ShaderPreprocessor::Process(const std::string& filepath)
+    {
+        enum class ShaderType
+        {
+            NONE = -1, VERTEX = 0, FRAGMENT = 1, GEOMETRY = 2
+        };
+
+        ShaderProgramSource source;
+        std::string mainPath = NormalizePath(filepath);
+        source.SourceFiles.push_back(mainPath);
+
+        Ref<ParsedFile> file = GetParsedFile(mainPath);
+        if (!file->Valid)
+        {
+            AE_CORE_ERROR("ShaderPreprocessor: Could not open '{0}'", mainPath);
+            return source;
+        }
+
+        StageContext stages[3];
+        bool started[3] = { false, false, false };
+        ShaderType type = ShaderType::NONE;
+
+        for (size_t i = 0; i < file->Lines.size(); i++)
+        {
+            const std::string& line = file->Lines[i];
+            std::string trimmed = Utils::TrimLeft(line);
+
+            if (Utils::StartsWith(trimmed, "#shader"))
+            {
+                if (trimmed.find("vertex") != std::string::npos)
+                    type = ShaderType::VERTEX;
+                else if (trimmed.find("fragment") != std::string::npos)
+                    type = ShaderType::FRAGMENT;
+                else if (trimmed.find("geometry") != std::string::npos)
+                    type = ShaderType::GEOMETRY;
+                continue;
+            }
+
+            if (type == ShaderType::NONE)
+                continue;
+
+            StageContext& stage = stages[(int)type];
+            bool& stageStarted = started[(int)type];
+
+            // #version has to stay the first statement, so #line is emitted after it
+            if (!stageStarted)
+            {
+                if (Utils::IsBlank(line))
+                    continue;
+
+                stageStarted = true;
+                stage.Stack.push_back(mainPath);
+                if (Utils::StartsWith(trimmed, "#version"))
+                {
+                    stage.Output << line << '\n' << "#line " << i + 2 << " 0\n";
+                    continue;
+                }
+                stage.Output << "#line " << i + 1 << " 0\n";
+            }
+
+            auto include = file->Includes.find(i);
+            if (include != file->Includes.end())
+            {
+                AppendFile(include->second, stage, source);
+                stage.Output << "#line " << i + 2 << " 0\n";
+                continue;
+            }
+
+            stage.Output << line << '\n';
+        }
+
+        source.VertexSource = stages[0].Output.str();
+        source.FragmentSource = stages[1].Output.str();
+        source.GeometrySource = stages[2].Output.str();
+        return source;
+    }
+
+    void ShaderPreprocessor::AppendFile(const std::string& filepath, StageContext& context, ShaderProgramSource& source)
+    {
+        if (std::find(context.Stack.begin(), context.Stack.end(), filepath) != context.Stack.end())
+        {
+            AE_CORE_ERROR("ShaderPreprocessor: Recursive #include of '{0}'", filepath);
+            return;
+        }
+
+        Ref<ParsedFile> file = GetParsedFile(filepath);
+        if (!file->Valid)
+        {
+            AE_CORE_ERROR("ShaderPreprocessor: Could not open include '{0}' (from '{1}')", filepath, context.Stack.back());
+            return;
+        }
+
+        bool once = std::any_of(file->Lines.begin(), file->Lines.end(),
+            [](const std::string& line) { return Utils::StartsWith(Utils::TrimLeft(line), "#pragma once"); });
+        if (once && std::find(context.Included.begin(), context.Included.end(), filepath) != context.Included.end())
+            return;
+
+        context.Included.push_back(filepath);
+        context.Stack.push_back(filepath);
+
+        uint32_t index = GetSourceIndex(filepath, source);
+        context.Output << "#line 1 " << index << '\n';
+
+        for (size_t i = 0; i < file->Lines.size(); i++)
+        {
+            const std::string& line = file->Lines[i];
+
+            auto include = file->Includes.find(i);
+            if (include != file->Includes.end())
+            {
+                AppendFile(include->second, context, source);
+                context.Output << "#line " << i + 2 << ' ' << index << '\n';
+                continue;
+            }
+
+            // Keep line numbering intact for the lines we strip
+            if (Utils::StartsWith(Utils::TrimLeft(line), "#pragma once"))
+                context.Output << '\n';
+            else
+                context.Output << line << '\n';
+        }
+
+        context.Stack.pop_back();
+    }
+
+    uint32_t ShaderPreprocessor::GetSourceIndex(const std::string& filepath, ShaderProgramSource& source)
+    {
+        auto it = std::find(source.SourceFiles.begin(), source.SourceFiles.end(), filepath);
+        if (it != source.SourceFiles.end())
+            return (uint32_t)(it - source.SourceFiles.begin());
+
+        source.SourceFiles.push_back(filepath);
+        return (uint32_t)source.SourceFiles.size() - 1;
+    }
+
+    Ref<ShaderPreprocessor::ParsedFile> ShaderPreprocessor::GetParsedFile(const std::string& filepath)
+    {
+        std::error_code ec;
+        auto writeTime = std::filesystem::last_write_time(filepath, ec);
+
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            auto it = s_Cache.find(filepath);
+            if (it != s_Cache.end() && !ec && it->second->WriteTime == writeTime)
+                return it->second;
+        }
+
+        Ref<ParsedFile> file = ParseFile(filepath);
+        if (!ec)
+            file->WriteTime = writeTime;
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Cache[filepath] = file;
+        return file;
+    }
+
+    Ref<ShaderPreprocessor::ParsedFile> ShaderPreprocessor::ParseFile(const std::string& filepath)
+    {
+        Ref<ParsedFile> file = CreateRef<ParsedFile>();
+
+        std::ifstream stream(filepath);
+        if (!stream)
+            return file;
+
+        file->Valid = true;
+
+        std::string line;
+        while (getline(stream, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            std::string trimmed = Utils::TrimLeft(line);
+            if (Utils::StartsWith(trimmed, "#include"))
+            {
+                size_t begin = trimmed.find_first_of("\"<");
+                size_t end = begin == std::string::npos ? std::string::npos : trimmed.find_first_of("\">", begin + 1);
+                if (end == std::string::npos)
+                {
+                    AE_CORE_ERROR("ShaderPreprocessor: Malformed #include in '{0}' line {1}", filepath, file->Lines.size() + 1);
+                }
+                else
+                {
+                    std::string name = trimmed.substr(begin + 1, end - begin - 1);
+                    file->Includes[file->Lines.size()] = ResolveInclude(filepath, name);
+                }
+            }
+
+            file->Lines.push_back(line);
+        }
+
+        return file;
+    }
+
+    std::string ShaderPreprocessor::ResolveInclude(const std::string& includer, const std::string& name)
+    {
+        std::filesystem::path relative = std::filesystem::path(includer).parent_path() / name;
+        if (std::filesystem::exists(relative))
+            return NormalizePath(relative.string());
+
+        for (const auto& directory : s_IncludeDirectories)
+        {
+            std::filesystem::path candidate = std::filesystem::path(directory) / name;
+            if (std::filesystem::exists(candidate))
+                return NormalizePath(candidate.string());
+        }
+
+        // Reported when the stage is assembled
+        return NormalizePath(relative.string());
+    }
+
+    std::string ShaderPreprocessor::ResolveErrorLog(const std::string& log, const std::vector<std::string>& sourceFiles)
+    {
+        // Covers "0(12) : error" (NVIDIA), "ERROR: 0:12:" (AMD/Apple) and "0:12(5): error" (Mesa)
+        static const std::regex s_Location(R"(^(\s*(?:ERROR:|WARNING:)?\s*)(\d+)(?::(\d+)(?:\(\d+\))?|\((\d+)\)))");
+
+        std::stringstream input(log);
+        std::stringstream output;
+        std::string line;
+        while (getline(input, line))
+        {
+            std::smatch match;
+            if (std::regex_search(line, match, s_Location))
+            {
+                size_t index = std::stoul(match[2].str());
+                if (index < sourceFiles.size())
+                {
+                    std::string lineNumber = match[3].matched ? match[3].str() : match[4].str();
+                    line = match[1].str() + sourceFiles[index] + "(" + lineNumber + ")" + match.suffix().str();
+                }
+            }
+            output << line << '\n';
+        }
+        return output.str();
+    }
+
+    void ShaderPreprocessor::AddIncludeDirectory(const std::string& directory)
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_IncludeDirectories.push_back(directory);
+    }
+
+    void ShaderPreprocessor::Invalidate(const std::string& filepath)
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Cache.erase(NormalizePath(filepath));
+    }
+
+    void ShaderPreprocessor::ClearCache()
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Cache.clear();
+    }
+
+    std::string ShaderPreprocessor::NormalizePath(const std::string& filepath)
+    {
+        return std::filesystem::path(filepath).lexically_normal().generic_string();
+    }
+}
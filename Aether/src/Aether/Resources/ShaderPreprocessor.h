@@ -0,0 +1,56 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Resources/Shader.h"
+
+#include <filesystem>
+#include <mutex>
+
+namespace Aether {
+
+    // Splits .shader files into stages, resolves #include "file" and emits
+    // #line directives so compiler errors point back at the original file.
+    class AETHER_API ShaderPreprocessor
+    {
+    public:
+        static ShaderProgramSource Process(const std::string& filepath);
+
+        // Rewrites "0(12)" / "0:12" locations in a driver info log to "path(12)"
+        static std::string ResolveErrorLog(const std::string& log, const std::vector<std::string>& sourceFiles);
+
+        static void AddIncludeDirectory(const std::string& directory);
+
+        // Drops the cached parse of a file so the next Process() re-reads it
+        static void Invalidate(const std::string& filepath);
+        static void ClearCache();
+
+        static std::string NormalizePath(const std::string& filepath);
+
+    private:
+        struct ParsedFile
+        {
+            std::vector<std::string> Lines;
+            // Line index -> resolved path for every #include directive
+            std::unordered_map<size_t, std::string> Includes;
+            std::filesystem::file_time_type WriteTime;
+            bool Valid = false;
+        };
+
+        struct StageContext
+        {
+            std::stringstream Output;
+            std::vector<std::string> Included;
+            std::vector<std::string> Stack;
+        };
+
+        static Ref<ParsedFile> GetParsedFile(const std::string& filepath);
+        static Ref<ParsedFile> ParseFile(const std::string& filepath);
+        static std::string ResolveInclude(const std::string& includer, const std::string& name);
+        static void AppendFile(const std::string& filepath, StageContext& context, ShaderProgramSource& source);
+        static uint32_t GetSourceIndex(const std::string& filepath, ShaderProgramSource& source);
+
+        static std::unordered_map<std::string, Ref<ParsedFile>> s_Cache;
+        static std::vector<std::string> s_IncludeDirectories;
+        static std::mutex s_Mutex;
+    };
+}
@@ -1,15 +1,39 @@
 #include "Aether/Resources/Texture.h"
 #include "Aether/Renderer/Renderer.h"
+#include "Aether/Resources/AssetWatcher.h"
+#include "Aether/Resources/TextureStreamer.h"
+#include "Aether/Resources/KTX2Loader.h"
+#include "Aether/Core/Application.h"
+#include "Aether/Core/JobSystem.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Null/NullTexture.h"
+
+#include <stb_image.h>
+#include <filesystem>
 
 namespace Aether {
 
+	bool Texture2D::IsFormatSupported(ImageFormat format)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    return false;
+			case RendererAPI::API::OpenGL:  return OpenGLTexture2D::IsFormatSupported(format);
+			// Nothing is sampled, so take the same path as a GPU that supports everything
+			case RendererAPI::API::Null:    return true;
+		}
+
+		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return false;
+	}
+
 	Ref<Texture2D> Texture2D::Create(const TextureSpec& specification)
 	{
 		switch (Renderer::GetAPI())
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(specification);
+			case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(specification);
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -22,6 +46,7 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(path, wrapMode, flip);
+			case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(path, wrapMode, flip);
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -34,6 +59,7 @@ namespace Aether {
 		{
 			case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(data, size);
+			case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(data, size);
 		}
 
 		AE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -46,6 +72,20 @@ namespace Aether {
         {
             case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
             case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTextureCube>(path);
+            case RendererAPI::API::Null:    return CreateRef<NullTextureCube>(path);
+        }
+
+        AE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+	Ref<TextureCube> TextureCube::Create(const TextureSpec& spec)
+    {
+        switch (Renderer::GetAPI())
+        {
+            case RendererAPI::API::None:    AE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTextureCube>(spec);
+            case RendererAPI::API::Null:    return CreateRef<NullTextureCube>(spec);
         }
 
         AE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -54,79 +94,346 @@ namespace Aether {
 
 	void Texture2DLibrary::Init()
     {
-        GetTextures().reserve(128);
         AE_CORE_INFO("TextureLibrary initialized");
     }
 
     void Texture2DLibrary::Shutdown()
     {
-        GetTextures().clear();
+        GetRegistry().Clear();
+        GetSources().clear();
     }
 
     Ref<Texture2D> Texture2DLibrary::Load(const std::string& filepath, UUID id, bool wrapMode, bool flip)
     {
-        auto& textures = GetTextures();
-        if (textures.find(id) != textures.end())
-            return textures[id];
+        auto& registry = GetRegistry();
+        Handle<Texture2D> handle;
+        if (!registry.Acquire(id, handle, AssetState::Loading))
+            return registry.Get(handle);
+
+        // Containers carry their own mips, so they go through the streamer
+        if (IsKTX2Path(filepath))
+        {
+            auto chain = KTX2Loader::LoadFile(filepath, wrapMode);
+            if (!chain || !Publish(handle, chain))
+            {
+                AE_CORE_ERROR("Texture Library: Failed to load '{0}'", filepath);
+                registry.SetState(handle, AssetState::Failed);
+                return nullptr;
+            }
+
+            registry.SetReloader(handle, [id]() { Reload(id); });
+            GetSources()[id] = { AssetWatcher::NormalizePath(filepath), wrapMode, flip };
+            return registry.Get(handle);
+        }
 
         auto texture = Texture2D::Create(filepath, wrapMode, flip);
         
         if (!texture || !texture->IsLoaded())
         {
             AE_CORE_ERROR("Texture Library: Failed to load '{0}'", filepath);
+            registry.SetState(handle, AssetState::Failed);
             return nullptr;
         }
-        textures[id] = texture;
+        registry.Publish(handle, texture);
+        registry.SetMemorySize(handle, texture->GetMemorySize());
+        registry.SetReloader(handle, [id]() { Reload(id); });
+        GetSources()[id] = { AssetWatcher::NormalizePath(filepath), wrapMode, flip };
         return texture;
     }
     Ref<Texture2D> Texture2DLibrary::Load(void* data, size_t size, UUID id)
     {
-        auto& textures = GetTextures();
-        if (textures.find(id) != textures.end())
-            return textures[id];
+        auto& registry = GetRegistry();
+        Handle<Texture2D> handle;
+        if (!registry.Acquire(id, handle, AssetState::Loading))
+            return registry.Get(handle);
 
         auto texture = Texture2D::Create(data, size);
         if (!texture || !texture->IsLoaded())
         {
             AE_CORE_ERROR("Texture Library: Failed to load from raw packed data");
+            registry.SetState(handle, AssetState::Failed);
             return nullptr;
         }
-        textures[id] = texture;
+        registry.Publish(handle, texture);
+        registry.SetMemorySize(handle, texture->GetMemorySize());
         return texture;
     }
 	Ref<Texture2D> Texture2DLibrary::Load(const TextureSpec& spec, UUID id)
     {
-        auto& textures = GetTextures();
-        if (textures.find(id) != textures.end())
-            return textures[id];
+        auto& registry = GetRegistry();
+        Handle<Texture2D> handle;
+        if (!registry.Acquire(id, handle, AssetState::Loading))
+            return registry.Get(handle);
 
         auto texture = Texture2D::Create(spec);
         if (!texture)
         {
             AE_CORE_ERROR("Texture Library: Failed to create empty texture");
+            registry.SetState(handle, AssetState::Failed);
             return nullptr;
         }
-        textures[id] = texture;
+        registry.Publish(handle, texture);
+        registry.SetMemorySize(handle, texture->GetMemorySize());
         return texture;
     }
 
+    Handle<Texture2D> Texture2DLibrary::LoadAsync(const std::string& filepath, UUID id, bool wrapMode, bool flip)
+    {
+        auto& registry = GetRegistry();
+        Handle<Texture2D> handle;
+        if (!registry.Acquire(id, handle, AssetState::Queued))
+            return handle;
+
+        StreamIn(handle, id, filepath, wrapMode, flip);
+        return handle;
+    }
+
+    Handle<Texture2D> Texture2DLibrary::LoadAsync(const TextureSpec& spec, Ref<uint8_t> pixels, UUID id, const TextureCookSettings& cook, bool replace)
+    {
+        auto& registry = GetRegistry();
+        Handle<Texture2D> handle;
+        if (!registry.Acquire(id, handle, AssetState::Queued) && !replace)
+            return handle;
+
+        JobSystem::SubmitJob([handle, spec, pixels, cook]()
+        {
+            auto chain = TextureCooker::Cook(spec, pixels.get(), cook);
+            TextureStreamer::StageTail(*chain);
+            Application::Get().SubmitToMainThread([handle, chain]() { Upload(handle, chain); });
+        });
+
+        return handle;
+    }
+
+    Handle<Texture2D> Texture2DLibrary::LoadKTX2Async(Ref<std::vector<uint8_t>> data, UUID id, ImageFormat preferred, bool wrapMode, bool replace)
+    {
+        auto& registry = GetRegistry();
+        Handle<Texture2D> handle;
+        if (!registry.Acquire(id, handle, AssetState::Queued) && !replace)
+            return handle;
+
+        JobSystem::SubmitJob([handle, data, preferred, wrapMode]()
+        {
+            auto chain = KTX2Loader::Load(data->data(), data->size(), wrapMode, preferred);
+            if (!chain)
+            {
+                GetRegistry().SetState(handle, AssetState::Failed);
+                return;
+            }
+
+            TextureStreamer::StageTail(*chain);
+            Application::Get().SubmitToMainThread([handle, chain]() { Upload(handle, chain); });
+        });
+
+        return handle;
+    }
+
+    void Texture2DLibrary::StreamIn(Handle<Texture2D> handle, UUID id, const std::string& filepath, bool wrapMode, bool flip)
+    {
+        JobSystem::SubmitJob([handle, id, filepath, wrapMode, flip]()
+        {
+            GetRegistry().SetState(handle, AssetState::Loading);
+
+            auto chain = DecodeChain(filepath, wrapMode, flip);
+            if (!chain)
+            {
+                AE_CORE_ERROR("Texture Library: Failed to load '{0}'", filepath);
+                GetRegistry().SetState(handle, AssetState::Failed);
+                return;
+            }
+
+            TextureStreamer::StageTail(*chain);
+            Application::Get().SubmitToMainThread([handle, id, filepath, wrapMode, flip, chain]()
+            {
+                Upload(handle, chain, [handle, id, filepath, wrapMode, flip]()
+                {
+                    GetRegistry().SetReloader(handle, [id]() { Reload(id); });
+                    GetSources()[id] = { AssetWatcher::NormalizePath(filepath), wrapMode, flip };
+                });
+            });
+        });
+    }
+
+    void Texture2DLibrary::Upload(Handle<Texture2D> handle, const Ref<MipChain>& chain, std::function<void()> onPublished)
+    {
+        Renderer::Submit([handle, chain, onPublished]()
+        {
+            if (!Publish(handle, chain, onPublished))
+                GetRegistry().SetState(handle, AssetState::Failed);
+        });
+    }
+
+    bool Texture2DLibrary::Publish(Handle<Texture2D> handle, const Ref<MipChain>& chain, std::function<void()> onPublished)
+    {
+        auto texture = TextureStreamer::CreateTexture(chain);
+        if (!texture)
+            return false;
+
+        GetRegistry().Publish(handle, texture);
+        GetRegistry().SetMemorySize(handle, texture->GetMemorySize());
+
+        // The streamer's bookkeeping is main-thread state and only keeps the texture weakly
+        std::weak_ptr<Texture2D> weak = texture;
+        Application::Get().SubmitToMainThread([handle, weak, chain, onPublished]()
+        {
+            TextureStreamer::Track(handle, weak, chain);
+            if (onPublished)
+                onPublished();
+        });
+        return true;
+    }
+
+    void Texture2DLibrary::Reload(UUID id)
+    {
+        // Sources are main-thread state, and the reload may be requested from any thread
+        Application::Get().SubmitToMainThread([id]()
+        {
+            auto it = GetSources().find(id);
+            if (it == GetSources().end())
+                return;
+
+            StreamIn(GetRegistry().Find(id), id, it->second.Path, it->second.WrapMode, it->second.Flip);
+        });
+    }
+
     Ref<Texture2D> Texture2DLibrary::Get(UUID id)
     {
-        auto& textures = GetTextures();
-        if (textures.find(id) != textures.end())
-            return textures[id];
-        return nullptr;
+        return GetRegistry().Get(id);
     }
 
     bool Texture2DLibrary::Exists(UUID id)
     {
-        auto& textures = GetTextures();
-        return textures.find(id) != textures.end();
+        return GetRegistry().IsReady(id);
+    }
+
+    AssetState Texture2DLibrary::GetState(UUID id)
+    {
+        return GetRegistry().GetState(id);
+    }
+
+    Handle<Texture2D> Texture2DLibrary::GetHandle(UUID id)
+    {
+        return GetRegistry().Find(id);
+    }
+
+    void Texture2DLibrary::Replace(UUID id, const Ref<Texture2D>& texture)
+    {
+        AE_CORE_ASSERT(texture, "Texture Library: Cannot replace with a null texture!");
+        Handle<Texture2D> handle = GetRegistry().Replace(id, texture);
+        GetRegistry().SetMemorySize(handle, texture->GetMemorySize());
+    }
+
+    void Texture2DLibrary::SetReloadCallback(UUID id, std::function<void()> reload)
+    {
+        Handle<Texture2D> handle = GetRegistry().Find(id);
+        AE_CORE_ASSERT(handle, "Texture Library: Cannot set a reloader on an unknown texture!");
+        GetRegistry().SetReloader(handle, std::move(reload));
+    }
+
+    void Texture2DLibrary::OnFileChanged(const std::string& filepath)
+    {
+        std::string path = AssetWatcher::NormalizePath(filepath);
+
+        for (auto& [id, source] : GetSources())
+        {
+            if (source.Path != path)
+                continue;
+
+            TextureSource request = source;
+            request.Generation = ++source.Generation;
+            UUID textureID = id;
+
+            JobSystem::SubmitJob([textureID, request]()
+            {
+                // Decode off the main thread; only the upload needs the GL context
+                auto chain = DecodeChain(request.Path, request.WrapMode, request.Flip);
+                if (!chain)
+                {
+                    AE_CORE_ERROR("Texture Library: Failed to reload '{0}', keeping the old texture", request.Path);
+                    return;
+                }
+
+                TextureStreamer::StageTail(*chain);
+                Application::Get().SubmitToMainThread([textureID, request, chain]()
+                {
+                    auto& sources = GetSources();
+                    auto it = sources.find(textureID);
+                    if (it == sources.end() || it->second.Generation != request.Generation)
+                    {
+                        Renderer::Submit([chain]() { TextureStreamer::Discard(*chain); });
+                        return;
+                    }
+
+                    // A failed upload keeps the old texture
+                    Handle<Texture2D> handle = GetHandle(textureID);
+                    std::string path = request.Path;
+                    Renderer::Submit([handle, chain, path]()
+                    {
+                        Publish(handle, chain, [path]() { AE_CORE_INFO("Texture Library: Reloaded '{0}'", path); });
+                    });
+                });
+            });
+        }
+    }
+
+    Ref<Texture2DLibrary::DecodedImage> Texture2DLibrary::Decode(const std::string& filepath, bool wrapMode, bool flip)
+    {
+        auto image = CreateRef<DecodedImage>();
+        image->Spec.WrapMode = wrapMode;
+
+        // The global flip flag would race with other workers
+        stbi_set_flip_vertically_on_load_thread(flip);
+
+        int width, height, channels;
+        if (stbi_is_hdr(filepath.c_str()))
+        {
+            float* data = stbi_loadf(filepath.c_str(), &width, &height, &channels, 4);
+            if (!data)
+                return nullptr;
+
+            image->Spec.Format = ImageFormat::RGBA16F;
+            image->Pixels = Ref<uint8_t>((uint8_t*)data, stbi_image_free);
+        }
+        else
+        {
+            stbi_uc* data = stbi_load(filepath.c_str(), &width, &height, &channels, 4);
+            if (!data)
+                return nullptr;
+
+            image->Spec.Format = ImageFormat::RGBA8;
+            image->Pixels = Ref<uint8_t>(data, stbi_image_free);
+        }
+
+        image->Spec.Width = width;
+        image->Spec.Height = height;
+        return image;
+    }
+
+    Ref<MipChain> Texture2DLibrary::DecodeChain(const std::string& filepath, bool wrapMode, bool flip)
+    {
+        if (IsKTX2Path(filepath))
+            return KTX2Loader::LoadFile(filepath, wrapMode);
+
+        auto image = Decode(filepath, wrapMode, flip);
+        return image ? TextureCooker::Cook(image->Spec, image->Pixels.get()) : nullptr;
+    }
+
+    bool Texture2DLibrary::IsKTX2Path(const std::string& filepath)
+    {
+        std::string extension = std::filesystem::path(filepath).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+        return extension == ".ktx2";
+    }
+
+    std::unordered_map<UUID, Texture2DLibrary::TextureSource>& Texture2DLibrary::GetSources()
+    {
+        static std::unordered_map<UUID, TextureSource> s_Sources;
+        return s_Sources;
     }
 
-    std::unordered_map<UUID, Ref<Texture2D>>& Texture2DLibrary::GetTextures()
+    ResourceRegistry<Texture2D>& Texture2DLibrary::GetRegistry()
     {
-        static std::unordered_map<UUID, Ref<Texture2D>> s_Textures;
-        return s_Textures;
+        static ResourceRegistry<Texture2D> s_Registry;
+        return s_Registry;
     }
 }
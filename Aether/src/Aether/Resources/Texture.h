@@ -2,16 +2,43 @@
 
 #include "aepch.h"
 #include "Aether/Core/UUID.h"
+#include "Aether/Resources/ResourceRegistry.h"
 
 namespace Aether {
 
+	struct MipChain;
+	struct StagingAllocation;
+
 	enum class ImageFormat
 	{
 		None = 0,
 		RGB8,
 		RGBA8,
         RGBA16F,
-		RGBA32F
+		RGBA32F,
+
+		// Block compressed, 4x4 texels per block
+		BC1,	// RGB, 8 bytes per block
+		BC3,	// RGBA, 16 bytes per block
+		BC5,	// RG (normal maps), 16 bytes per block
+		BC7		// RGBA, 16 bytes per block
+	};
+
+	enum class MipFilter
+	{
+		Box = 0,
+		// Windowed sinc: keeps distant mips sharper than a box filter
+		Kaiser
+	};
+
+	// How TextureCooker turns decoded pixels into a GPU-ready mip chain
+	struct TextureCookSettings
+	{
+		MipFilter Filter = MipFilter::Box;
+		// Color data: mips are filtered in linear space and re-encoded
+		bool SRGB = false;
+		// BC1/BC3/BC5/BC7, or None to keep the source format. Falls back when the GPU lacks the format.
+		ImageFormat Compression = ImageFormat::None;
 	};
 
 	struct TextureSpec
@@ -22,6 +49,11 @@ namespace Aether {
 		bool GenerateMips = true;
 
         bool WrapMode = false;
+        // Storage for the whole mip chain is allocated up front and filled level by level
+        // through SetMipData(); sampling is clamped to the levels that have arrived
+        bool Streamed = false;
+        // Length of a Streamed chain; 0 means down to 1x1. Containers like KTX2 may ship fewer levels.
+        uint32_t MipLevels = 0;
 	};
 
 	class Texture
@@ -44,11 +76,75 @@ namespace Aether {
 		virtual bool IsLoaded() const = 0;
 
 		virtual bool operator==(const Texture& other) const = 0;
+
+		// GPU footprint, including the mip chain when the spec asks for one
+		uint64_t GetMemorySize() const { return CalculateMemorySize(GetSpec()); }
+
+		static uint32_t CalculateMipCount(uint32_t width, uint32_t height)
+		{
+			uint32_t levels = 1;
+			while ((width | height) >> levels)
+				levels++;
+			return levels;
+		}
+
+		static bool IsCompressed(ImageFormat format)
+		{
+			return format == ImageFormat::BC1 || format == ImageFormat::BC3 || format == ImageFormat::BC5 || format == ImageFormat::BC7;
+		}
+
+		// GPU size of one level; compressed formats round up to whole blocks
+		static uint64_t CalculateLevelSize(ImageFormat format, uint32_t width, uint32_t height)
+		{
+			uint64_t blocks = (uint64_t)((width + 3) / 4) * ((height + 3) / 4);
+			switch (format)
+			{
+				case ImageFormat::None:    return 0;
+				case ImageFormat::RGB8:    return (uint64_t)width * height * 3;
+				case ImageFormat::RGBA8:   return (uint64_t)width * height * 4;
+				case ImageFormat::RGBA16F: return (uint64_t)width * height * 8;
+				case ImageFormat::RGBA32F: return (uint64_t)width * height * 16;
+				case ImageFormat::BC1:     return blocks * 8;
+				case ImageFormat::BC3:
+				case ImageFormat::BC5:
+				case ImageFormat::BC7:     return blocks * 16;
+			}
+			return 0;
+		}
+
+		static uint64_t CalculateMemorySize(const TextureSpec& spec)
+		{
+			uint32_t width = spec.Width, height = spec.Height;
+			uint64_t bytes = CalculateLevelSize(spec.Format, width, height);
+			uint32_t levels = spec.Streamed && spec.MipLevels ? spec.MipLevels : CalculateMipCount(width, height);
+			while ((spec.GenerateMips || spec.Streamed) && --levels > 0)
+			{
+				width = std::max(width / 2, 1u);
+				height = std::max(height / 2, 1u);
+				bytes += CalculateLevelSize(spec.Format, width, height);
+			}
+			return bytes;
+		}
 	};
 
 	class AETHER_API Texture2D : public Texture
 	{
 	public:
+		virtual uint32_t GetMipLevelCount() const = 0;
+
+		// Uploads one level of a Streamed texture; `size` must cover the whole level
+		virtual void SetMipData(uint32_t level, const void* data, uint32_t size) = 0;
+		// Same, sourced from a filled staging block; the copy runs on the GPU timeline
+		virtual void SetMipData(uint32_t level, const StagingAllocation& staging) = 0;
+
+		// Restricts sampling to levels >= baseLevel. minLod (relative to baseLevel) fades a newly
+		// arrived level in over a few frames instead of popping.
+		virtual void SetLodClamp(uint32_t baseLevel, float minLod = 0.0f) = 0;
+		virtual uint32_t GetBaseLevel() const = 0;
+
+		// Safe from any thread once the renderer is initialized
+		static bool IsFormatSupported(ImageFormat format);
+
 		static Ref<Texture2D> Create(const TextureSpec& spec);
 		static Ref<Texture2D> Create(void* data, size_t size);
 		static Ref<Texture2D> Create(const std::string& path, bool wrapMode = false, bool flip = true);
@@ -57,7 +153,14 @@ namespace Aether {
     class AETHER_API TextureCube : public Texture
 	{
 	public:
+		virtual uint32_t GetMipLevelCount() const = 0;
+
+		// Faces are ordered +X, -X, +Y, -Y, +Z, -Z; `size` must cover the whole face at that level
+		virtual void SetFaceData(uint32_t face, uint32_t level, const void* data, uint32_t size) = 0;
+
 		static Ref<TextureCube> Create(const std::string& path);
+		// Empty cubemap with square faces of spec.Width; spec.MipLevels levels (0 = full chain, 1 = none)
+		static Ref<TextureCube> Create(const TextureSpec& spec);
 	};
 
 	class AETHER_API Texture2DLibrary
@@ -66,13 +169,72 @@ namespace Aether {
         static void Init();
         static void Shutdown();
 
+        // .ktx2 files keep their own orientation (flip is ignored) and stream in their finer levels
         static Ref<Texture2D> Load(const std::string& filepath, UUID id, bool wrapMode = false, bool flip = true);
 		static Ref<Texture2D> Load(void* data, size_t size, UUID id);
 		static Ref<Texture2D> Load(const TextureSpec& spec, UUID id);
         static Ref<Texture2D> Get(UUID id);
         
         static bool Exists(UUID id);
+        static AssetState GetState(UUID id);
+
+        // Safe from any thread: decodes on a JobSystem worker and uploads on the render thread.
+        // Poll GetState() or resolve the handle once it reports Ready.
+        static Handle<Texture2D> LoadAsync(const std::string& filepath, UUID id, bool wrapMode = false, bool flip = true);
+        // Streams already decoded pixels (level 0, SetData() layout), cooked on the worker as `cook`
+        // asks. The buffer is shared with the worker, not copied, and must not change afterwards.
+        // With `replace`, an ID that is already loaded is re-uploaded behind the same handle.
+        static Handle<Texture2D> LoadAsync(const TextureSpec& spec, Ref<uint8_t> pixels, UUID id, const TextureCookSettings& cook = {}, bool replace = false);
+        // Streams an in-memory KTX2 file, transcoding Basis payloads to `preferred` on a worker
+        static Handle<Texture2D> LoadKTX2Async(Ref<std::vector<uint8_t>> data, UUID id, ImageFormat preferred = ImageFormat::BC7, bool wrapMode = false, bool replace = false);
+
+        static Handle<Texture2D> GetHandle(UUID id);
+        static Texture2D* Resolve(Handle<Texture2D> handle) { return GetRegistry().Resolve(handle); }
+
+        // Swaps the texture behind an ID; handles stay valid, so materials pick it up on the next bind
+        static void Replace(UUID id, const Ref<Texture2D>& texture);
+
+        // Lets whoever owns the source (e.g. ModelLoader) make a texture evictable under the GPU budget.
+        // Textures loaded from a file get one automatically.
+        static void SetReloadCallback(UUID id, std::function<void()> reload);
+
+        // Re-decodes every texture loaded from this file on a worker and swaps it in on the render thread
+        static void OnFileChanged(const std::string& filepath);
     private:
-        static std::unordered_map<UUID, Ref<Texture2D>>& GetTextures();
+        struct TextureSource
+        {
+            std::string Path;
+            bool WrapMode = false;
+            bool Flip = true;
+            // Bumped per reload so a slow decode can't overwrite a newer one
+            uint32_t Generation = 0;
+        };
+
+        struct DecodedImage
+        {
+            TextureSpec Spec;
+            // The decoder's own buffer, freed with it
+            Ref<uint8_t> Pixels;
+        };
+
+        // CPU only, safe on worker threads
+        static Ref<DecodedImage> Decode(const std::string& filepath, bool wrapMode, bool flip);
+        // Decode() plus cooking, or a KTX2 read; CPU only
+        static Ref<MipChain> DecodeChain(const std::string& filepath, bool wrapMode, bool flip);
+        static bool IsKTX2Path(const std::string& filepath);
+        // Decodes on a worker and publishes behind `handle` on the main thread
+        static void StreamIn(Handle<Texture2D> handle, UUID id, const std::string& filepath, bool wrapMode, bool flip);
+        // Main thread: runs Publish() on the render thread and marks the handle Failed if it fails
+        static void Upload(Handle<Texture2D> handle, const Ref<MipChain>& chain, std::function<void()> onPublished = {});
+        // Thread that owns the GL context: creates the streamed texture and publishes it behind `handle`.
+        // TextureStreamer picks it up, then `onPublished` runs, both on the main thread.
+        static bool Publish(Handle<Texture2D> handle, const Ref<MipChain>& chain, std::function<void()> onPublished = {});
+        static void Reload(UUID id);
+
+        static ResourceRegistry<Texture2D>& GetRegistry();
+        // Main thread only
+        static std::unordered_map<UUID, TextureSource>& GetSources();
     };
+
+    using Texture2DHandle = Handle<Texture2D>;
 }
@@ -0,0 +1,695 @@
+#include "aepch.h"
+#include "Aether/Resources/TextureCooker.h"
+
+#include <cmath>
+#include <cfloat>
+#include <glm/gtc/constants.hpp>
+
+namespace Aether {
+
+    // Kaiser window: radius in destination texels and shape parameter
+    static constexpr float s_KaiserRadius = 3.0f;
+    static constexpr float s_KaiserAlpha = 4.0f;
+
+    namespace Utils {
+
+        static float SRGBToLinear(float c)
+        {
+            return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+
+        static float LinearToSRGB(float c)
+        {
+            return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+        }
+
+        static const std::array<float, 256>& GetDecodeTable()
+        {
+            static const std::array<float, 256> s_Table = []()
+            {
+                std::array<float, 256> table;
+                for (int i = 0; i < 256; i++)
+                    table[i] = SRGBToLinear(i / 255.0f);
+                return table;
+            }();
+            return s_Table;
+        }
+
+        // Linear -> 8-bit sRGB, fine enough that no code is more than one step off
+        static const std::array<uint8_t, 4096>& GetEncodeTable()
+        {
+            static const std::array<uint8_t, 4096> s_Table = []()
+            {
+                std::array<uint8_t, 4096> table;
+                for (int i = 0; i < 4096; i++)
+                    table[i] = (uint8_t)(LinearToSRGB(i / 4095.0f) * 255.0f + 0.5f);
+                return table;
+            }();
+            return s_Table;
+        }
+
+        static bool IsFloatFormat(ImageFormat format)
+        {
+            return format == ImageFormat::RGBA16F || format == ImageFormat::RGBA32F;
+        }
+
+        // Client-side bytes of a level: float formats are always handed over as 32-bit RGBA
+        static size_t GetLevelDataSize(ImageFormat format, uint32_t width, uint32_t height)
+        {
+            if (IsFloatFormat(format))
+                return (size_t)width * height * 4 * sizeof(float);
+            return (size_t)Texture::CalculateLevelSize(format, width, height);
+        }
+
+        // Working images are RGBA float, linear for sRGB color
+        static void Decode(ImageFormat format, const void* pixels, size_t count, bool srgb, std::vector<float>& out)
+        {
+            out.resize(count * 4);
+            if (IsFloatFormat(format))
+            {
+                memcpy(out.data(), pixels, count * 4 * sizeof(float));
+                return;
+            }
+
+            const auto& table = GetDecodeTable();
+            uint32_t channels = format == ImageFormat::RGB8 ? 3 : 4;
+            const uint8_t* src = (const uint8_t*)pixels;
+            for (size_t i = 0; i < count; i++, src += channels)
+            {
+                float* dst = &out[i * 4];
+                for (uint32_t c = 0; c < 3; c++)
+                    dst[c] = srgb ? table[src[c]] : src[c] / 255.0f;
+                dst[3] = channels == 4 ? src[3] / 255.0f : 1.0f;
+            }
+        }
+
+        static void EncodeRGBA8(const float* src, size_t count, bool srgb, uint32_t channels, uint8_t* dst)
+        {
+            const auto& table = GetEncodeTable();
+            for (size_t i = 0; i < count; i++, src += 4, dst += channels)
+            {
+                for (uint32_t c = 0; c < channels; c++)
+                {
+                    float value = std::clamp(src[c], 0.0f, 1.0f);
+                    dst[c] = srgb && c < 3 ? table[(int)(value * 4095.0f + 0.5f)] : (uint8_t)(value * 255.0f + 0.5f);
+                }
+            }
+        }
+
+        // 2x2 box filter; odd edges reuse the last row/column
+        static void DownsampleBox(const float* src, uint32_t srcWidth, uint32_t srcHeight, float* dst, uint32_t dstWidth, uint32_t dstHeight)
+        {
+            for (uint32_t y = 0; y < dstHeight; y++)
+            {
+                const float* row0 = src + (size_t)std::min(y * 2, srcHeight - 1) * srcWidth * 4;
+                const float* row1 = src + (size_t)std::min(y * 2 + 1, srcHeight - 1) * srcWidth * 4;
+                for (uint32_t x = 0; x < dstWidth; x++)
+                {
+                    uint32_t x0 = std::min(x * 2, srcWidth - 1) * 4;
+                    uint32_t x1 = std::min(x * 2 + 1, srcWidth - 1) * 4;
+                    float* out = dst + ((size_t)y * dstWidth + x) * 4;
+                    for (uint32_t c = 0; c < 4; c++)
+                        out[c] = (row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c]) * 0.25f;
+                }
+            }
+        }
+
+        static float BesselI0(float x)
+        {
+            float sum = 1.0f, term = 1.0f, q = x * x * 0.25f;
+            for (int k = 1; k < 20; k++)
+            {
+                term *= q / (float)(k * k);
+                sum += term;
+            }
+            return sum;
+        }
+
+        static float KaiserSinc(float t)
+        {
+            if (std::abs(t) >= s_KaiserRadius)
+                return 0.0f;
+
+            float x = t / s_KaiserRadius;
+            float window = BesselI0(s_KaiserAlpha * std::sqrt(1.0f - x * x)) / BesselI0(s_KaiserAlpha);
+            float sinc = t == 0.0f ? 1.0f : std::sin(glm::pi<float>() * t) / (glm::pi<float>() * t);
+            return sinc * window;
+        }
+
+        // Per-destination-texel taps along one axis; the same kernel serves every row or column
+        struct Kernel
+        {
+            std::vector<uint32_t> Begin;
+            std::vector<uint32_t> Index;
+            std::vector<float> Weight;
+        };
+
+        static Kernel BuildKernel(uint32_t srcSize, uint32_t dstSize, bool clamp)
+        {
+            Kernel kernel;
+            float scale = (float)srcSize / (float)dstSize;
+            for (uint32_t x = 0; x < dstSize; x++)
+            {
+                kernel.Begin.push_back((uint32_t)kernel.Index.size());
+
+                float center = (x + 0.5f) * scale;
+                int first = (int)std::floor(center - s_KaiserRadius * scale);
+                int last = (int)std::ceil(center + s_KaiserRadius * scale);
+
+                float total = 0.0f;
+                size_t start = kernel.Weight.size();
+                for (int i = first; i <= last; i++)
+                {
+                    float weight = KaiserSinc((i + 0.5f - center) / scale);
+                    if (weight == 0.0f)
+                        continue;
+
+                    int size = (int)srcSize;
+                    int index = clamp ? std::clamp(i, 0, size - 1) : ((i % size) + size) % size;
+                    kernel.Index.push_back((uint32_t)index);
+                    kernel.Weight.push_back(weight);
+                    total += weight;
+                }
+
+                for (size_t i = start; i < kernel.Weight.size(); i++)
+                    kernel.Weight[i] /= total;
+            }
+            kernel.Begin.push_back((uint32_t)kernel.Index.size());
+            return kernel;
+        }
+
+        // Separable: a horizontal pass, then a vertical one that accumulates whole rows so the
+        // inner loop runs over contiguous floats and vectorizes
+        static void DownsampleKaiser(const float* src, uint32_t srcWidth, uint32_t srcHeight, float* dst, uint32_t dstWidth, uint32_t dstHeight, bool clamp)
+        {
+            Kernel horizontal = BuildKernel(srcWidth, dstWidth, clamp);
+            Kernel vertical = BuildKernel(srcHeight, dstHeight, clamp);
+
+            size_t rowSize = (size_t)dstWidth * 4;
+            std::vector<float> temp(rowSize * srcHeight);
+            for (uint32_t y = 0; y < srcHeight; y++)
+            {
+                const float* in = src + (size_t)y * srcWidth * 4;
+                float* out = temp.data() + y * rowSize;
+                for (uint32_t x = 0; x < dstWidth; x++)
+                {
+                    float sum[4] = {};
+                    for (uint32_t t = horizontal.Begin[x]; t < horizontal.Begin[x + 1]; t++)
+                    {
+                        const float* p = in + horizontal.Index[t] * 4;
+                        float w = horizontal.Weight[t];
+                        for (uint32_t c = 0; c < 4; c++)
+                            sum[c] += p[c] * w;
+                    }
+                    memcpy(out + x * 4, sum, sizeof(sum));
+                }
+            }
+
+            for (uint32_t y = 0; y < dstHeight; y++)
+            {
+                float* out = dst + y * rowSize;
+                std::fill(out, out + rowSize, 0.0f);
+                for (uint32_t t = vertical.Begin[y]; t < vertical.Begin[y + 1]; t++)
+                {
+                    const float* in = temp.data() + vertical.Index[t] * rowSize;
+                    float w = vertical.Weight[t];
+                    for (size_t i = 0; i < rowSize; i++)
+                        out[i] += in[i] * w;
+                }
+            }
+        }
+
+        // Little-endian bit packer for BC block layouts
+        struct BitWriter
+        {
+            uint8_t* Data;
+            uint32_t Position = 0;
+
+            void Write(uint32_t value, uint32_t bits)
+            {
+                for (uint32_t i = 0; i < bits; i++, Position++)
+                {
+                    if ((value >> i) & 1)
+                        Data[Position >> 3] |= (uint8_t)(1 << (Position & 7));
+                }
+            }
+        };
+
+        // Principal axis of `count` points with `N` channels, through their mean
+        template<int N>
+        static void PrincipalAxis(const float (*points)[N], int count, float* mean, float* axis)
+        {
+            for (int c = 0; c < N; c++)
+            {
+                mean[c] = 0.0f;
+                for (int i = 0; i < count; i++)
+                    mean[c] += points[i][c];
+                mean[c] /= (float)count;
+            }
+
+            float covariance[N][N] = {};
+            for (int i = 0; i < count; i++)
+            {
+                for (int a = 0; a < N; a++)
+                    for (int b = 0; b < N; b++)
+                        covariance[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+            }
+
+            // Power iteration, seeded with the longest diagonal of the bounding box
+            for (int c = 0; c < N; c++)
+            {
+                float lo = points[0][c], hi = points[0][c];
+                for (int i = 1; i < count; i++)
+                {
+                    lo = std::min(lo, points[i][c]);
+                    hi = std::max(hi, points[i][c]);
+                }
+                axis[c] = hi - lo + 1e-3f;
+            }
+
+            for (int iteration = 0; iteration < 8; iteration++)
+            {
+                float next[N] = {};
+                for (int a = 0; a < N; a++)
+                    for (int b = 0; b < N; b++)
+                        next[a] += covariance[a][b] * axis[b];
+
+                float length = 0.0f;
+                for (int c = 0; c < N; c++)
+                    length = std::max(length, std::abs(next[c]));
+                if (length < 1e-6f)
+                    break;
+                for (int c = 0; c < N; c++)
+                    axis[c] = next[c] / length;
+            }
+        }
+
+        static uint16_t PackRGB565(const float* color)
+        {
+            uint32_t r = (uint32_t)std::clamp(color[0] * 31.0f / 255.0f + 0.5f, 0.0f, 31.0f);
+            uint32_t g = (uint32_t)std::clamp(color[1] * 63.0f / 255.0f + 0.5f, 0.0f, 63.0f);
+            uint32_t b = (uint32_t)std::clamp(color[2] * 31.0f / 255.0f + 0.5f, 0.0f, 31.0f);
+            return (uint16_t)((r << 11) | (g << 5) | b);
+        }
+
+        static void UnpackRGB565(uint16_t packed, float* color)
+        {
+            uint32_t r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+            color[0] = (float)((r << 3) | (r >> 2));
+            color[1] = (float)((g << 2) | (g >> 4));
+            color[2] = (float)((b << 3) | (b >> 2));
+        }
+
+        // Nearest of the four BC1 palette entries (4-colour mode) for every texel; returns the total error
+        static float FitBC1Indices(const float (*colors)[3], uint16_t c0, uint16_t c1, uint32_t* indices)
+        {
+            float palette[4][3];
+            UnpackRGB565(c0, palette[0]);
+            UnpackRGB565(c1, palette[1]);
+            for (int c = 0; c < 3; c++)
+            {
+                palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+                palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+            }
+
+            float total = 0.0f;
+            for (int i = 0; i < 16; i++)
+            {
+                float best = FLT_MAX;
+                for (uint32_t p = 0; p < 4; p++)
+                {
+                    float error = 0.0f;
+                    for (int c = 0; c < 3; c++)
+                        error += (colors[i][c] - palette[p][c]) * (colors[i][c] - palette[p][c]);
+                    if (error < best)
+                    {
+                        best = error;
+                        indices[i] = p;
+                    }
+                }
+                total += best;
+            }
+            return total;
+        }
+
+        // Colour half of BC1/BC3: PCA endpoints, then one least-squares refit against the chosen indices
+        static void EncodeColorBlock(const uint8_t (*block)[4], uint8_t* out)
+        {
+            float colors[16][3];
+            for (int i = 0; i < 16; i++)
+                for (int c = 0; c < 3; c++)
+                    colors[i][c] = block[i][c];
+
+            float mean[3], axis[3];
+            PrincipalAxis<3>(colors, 16, mean, axis);
+
+            float axisLength = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+            float tMin = 0.0f, tMax = 0.0f;
+            for (int i = 0; i < 16; i++)
+            {
+                float t = 0.0f;
+                for (int c = 0; c < 3; c++)
+                    t += (colors[i][c] - mean[c]) * axis[c];
+                t /= std::max(axisLength, 1e-6f);
+                tMin = std::min(tMin, t);
+                tMax = std::max(tMax, t);
+            }
+
+            float e0[3], e1[3];
+            for (int c = 0; c < 3; c++)
+            {
+                e0[c] = mean[c] + axis[c] * tMax;
+                e1[c] = mean[c] + axis[c] * tMin;
+            }
+
+            uint16_t c0 = PackRGB565(e0), c1 = PackRGB565(e1);
+            uint32_t indices[16];
+            float error = FitBC1Indices(colors, c0, c1, indices);
+
+            // Solve for the endpoints that best reproduce the colours with these weights
+            static constexpr float s_Weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+            float aa = 0.0f, ab = 0.0f, bb = 0.0f, ax[3] = {}, bx[3] = {};
+            for (int i = 0; i < 16; i++)
+            {
+                float a = s_Weights[indices[i]], b = 1.0f - a;
+                aa += a * a; ab += a * b; bb += b * b;
+                for (int c = 0; c < 3; c++)
+                {
+                    ax[c] += a * colors[i][c];
+                    bx[c] += b * colors[i][c];
+                }
+            }
+
+            float determinant = aa * bb - ab * ab;
+            if (std::abs(determinant) > 1e-6f)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    e0[c] = (ax[c] * bb - bx[c] * ab) / determinant;
+                    e1[c] = (bx[c] * aa - ax[c] * ab) / determinant;
+                }
+
+                uint16_t r0 = PackRGB565(e0), r1 = PackRGB565(e1);
+                uint32_t refined[16];
+                float refinedError = FitBC1Indices(colors, r0, r1, refined);
+                if (refinedError < error)
+                {
+                    c0 = r0;
+                    c1 = r1;
+                    memcpy(indices, refined, sizeof(indices));
+                }
+            }
+
+            // c0 > c1 selects the 4-colour mode; swapping the endpoints swaps index pairs
+            if (c0 < c1)
+            {
+                std::swap(c0, c1);
+                for (auto& index : indices)
+                    index ^= 1;
+            }
+            else if (c0 == c1)
+            {
+                memset(indices, 0, sizeof(indices));
+            }
+
+            uint32_t bits = 0;
+            for (int i = 0; i < 16; i++)
+                bits |= indices[i] << (i * 2);
+
+            out[0] = (uint8_t)c0; out[1] = (uint8_t)(c0 >> 8);
+            out[2] = (uint8_t)c1; out[3] = (uint8_t)(c1 >> 8);
+            memcpy(out + 4, &bits, 4);
+        }
+
+        // BC4: one channel, 8-value mode with the endpoints at the block's min and max
+        static void EncodeChannelBlock(const uint8_t (*block)[4], int channel, uint8_t* out)
+        {
+            uint8_t lo = 255, hi = 0;
+            for (int i = 0; i < 16; i++)
+            {
+                lo = std::min(lo, block[i][channel]);
+                hi = std::max(hi, block[i][channel]);
+            }
+
+            memset(out, 0, 8);
+            out[0] = hi;
+            out[1] = lo;
+            if (hi == lo)
+                return;
+
+            float palette[8] = { (float)hi, (float)lo };
+            for (int i = 1; i < 7; i++)
+                palette[i + 1] = ((7 - i) * hi + i * lo) / 7.0f;
+
+            BitWriter writer{ out + 2 };
+            for (int i = 0; i < 16; i++)
+            {
+                uint32_t index = 0;
+                float best = FLT_MAX;
+                for (uint32_t p = 0; p < 8; p++)
+                {
+                    float error = std::abs(block[i][channel] - palette[p]);
+                    if (error < best)
+                    {
+                        best = error;
+                        index = p;
+                    }
+                }
+                writer.Write(index, 3);
+            }
+        }
+
+        // BC7 mode 6: one subset, RGBA endpoints at 7 bits plus a p-bit each, 4-bit indices
+        static void EncodeBC7Block(const uint8_t (*block)[4], uint8_t* out)
+        {
+            static constexpr uint32_t s_Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+            float colors[16][4];
+            for (int i = 0; i < 16; i++)
+                for (int c = 0; c < 4; c++)
+                    colors[i][c] = block[i][c];
+
+            float mean[4], axis[4];
+            PrincipalAxis<4>(colors, 16, mean, axis);
+
+            float axisLength = 0.0f;
+            for (int c = 0; c < 4; c++)
+                axisLength += axis[c] * axis[c];
+
+            float tMin = 0.0f, tMax = 0.0f;
+            for (int i = 0; i < 16; i++)
+            {
+                float t = 0.0f;
+                for (int c = 0; c < 4; c++)
+                    t += (colors[i][c] - mean[c]) * axis[c];
+                t /= std::max(axisLength, 1e-6f);
+                tMin = std::min(tMin, t);
+                tMax = std::max(tMax, t);
+            }
+
+            // Quantize each endpoint with whichever p-bit lands closer
+            uint32_t quantized[2][4], pbits[2], endpoints[2][4];
+            for (int e = 0; e < 2; e++)
+            {
+                float t = e == 0 ? tMin : tMax;
+                float target[4];
+                for (int c = 0; c < 4; c++)
+                    target[c] = std::clamp(mean[c] + axis[c] * t, 0.0f, 255.0f);
+
+                float bestError = FLT_MAX;
+                for (uint32_t p = 0; p < 2; p++)
+                {
+                    uint32_t q[4];
+                    float error = 0.0f;
+                    for (int c = 0; c < 4; c++)
+                    {
+                        q[c] = (uint32_t)std::clamp((target[c] - p) * 0.5f + 0.5f, 0.0f, 127.0f);
+                        float value = (float)(q[c] * 2 + p);
+                        error += (value - target[c]) * (value - target[c]);
+                    }
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        pbits[e] = p;
+                        memcpy(quantized[e], q, sizeof(q));
+                    }
+                }
+
+                for (int c = 0; c < 4; c++)
+                    endpoints[e][c] = quantized[e][c] * 2 + pbits[e];
+            }
+
+            uint32_t palette[16][4];
+            for (int i = 0; i < 16; i++)
+                for (int c = 0; c < 4; c++)
+                    palette[i][c] = ((64 - s_Weights[i]) * endpoints[0][c] + s_Weights[i] * endpoints[1][c] + 32) >> 6;
+
+            uint32_t indices[16];
+            for (int i = 0; i < 16; i++)
+            {
+                uint32_t best = UINT32_MAX;
+                for (uint32_t p = 0; p < 16; p++)
+                {
+                    uint32_t error = 0;
+                    for (int c = 0; c < 4; c++)
+                    {
+                        int d = (int)block[i][c] - (int)palette[p][c];
+                        error += (uint32_t)(d * d);
+                    }
+                    if (error < best)
+                    {
+                        best = error;
+                        indices[i] = p;
+                    }
+                }
+            }
+
+            // The first index is stored with its top bit implied 0
+            if (indices[0] & 8)
+            {
+                std::swap(quantized[0], quantized[1]);
+                std::swap(pbits[0], pbits[1]);
+                for (auto& index : indices)
+                    index = 15 - index;
+            }
+
+            memset(out, 0, 16);
+            BitWriter writer{ out };
+            writer.Write(1 << 6, 7);
+            for (int c = 0; c < 4; c++)
+            {
+                writer.Write(quantized[0][c], 7);
+                writer.Write(quantized[1][c], 7);
+            }
+            writer.Write(pbits[0], 1);
+            writer.Write(pbits[1], 1);
+            for (int i = 0; i < 16; i++)
+                writer.Write(indices[i], i == 0 ? 3 : 4);
+        }
+    }
+
+    Ref<MipChain> TextureCooker::Cook(const TextureSpec& spec, const void* pixels, const TextureCookSettings& settings)
+    {
+        bool isFloat = Utils::IsFloatFormat(spec.Format);
+        // There's no HDR block format yet, so float textures keep their format
+        ImageFormat compression = isFloat ? ImageFormat::None : SelectCompression(settings.Compression);
+        ImageFormat format = compression != ImageFormat::None ? compression : spec.Format;
+        bool srgb = settings.SRGB && !isFloat;
+
+        auto chain = CreateRef<MipChain>();
+        chain->Spec = spec;
+        chain->Spec.Format = format;
+        chain->Spec.Streamed = true;
+        chain->Spec.GenerateMips = false;
+
+        // Streaming needs the whole chain whatever the spec asks for
+        uint32_t levelCount = Texture::CalculateMipCount(spec.Width, spec.Height);
+        size_t totalSize = 0;
+        for (uint32_t level = 0; level < levelCount; level++)
+        {
+            uint32_t width = std::max(spec.Width >> level, 1u);
+            uint32_t height = std::max(spec.Height >> level, 1u);
+            size_t size = Utils::GetLevelDataSize(format, width, height);
+            chain->Levels.push_back({ width, height, totalSize, size });
+            totalSize += size;
+        }
+        chain->Data.resize(totalSize);
+
+        std::vector<float> current, next;
+        std::vector<uint8_t> rgba;
+        Utils::Decode(spec.Format, pixels, (size_t)spec.Width * spec.Height, srgb, current);
+
+        for (uint32_t level = 0; level < levelCount; level++)
+        {
+            const auto& mip = chain->Levels[level];
+            if (level > 0)
+            {
+                const auto& src = chain->Levels[level - 1];
+                next.resize((size_t)mip.Width * mip.Height * 4);
+                if (settings.Filter == MipFilter::Kaiser)
+                    Utils::DownsampleKaiser(current.data(), src.Width, src.Height, next.data(), mip.Width, mip.Height, spec.WrapMode);
+                else
+                    Utils::DownsampleBox(current.data(), src.Width, src.Height, next.data(), mip.Width, mip.Height);
+                current.swap(next);
+            }
+
+            uint8_t* dst = chain->Data.data() + mip.Offset;
+            size_t count = (size_t)mip.Width * mip.Height;
+            if (isFloat)
+            {
+                // Kaiser lobes can undershoot; negative radiance isn't meaningful
+                for (size_t i = 0; i < count * 4; i++)
+                    ((float*)dst)[i] = std::max(current[i], 0.0f);
+            }
+            else if (compression != ImageFormat::None)
+            {
+                rgba.resize(count * 4);
+                Utils::EncodeRGBA8(current.data(), count, srgb, 4, rgba.data());
+                auto blocks = Compress(compression, rgba.data(), mip.Width, mip.Height);
+                memcpy(dst, blocks.data(), blocks.size());
+            }
+            else
+            {
+                Utils::EncodeRGBA8(current.data(), count, srgb, format == ImageFormat::RGB8 ? 3 : 4, dst);
+            }
+        }
+
+        return chain;
+    }
+
+    std::vector<uint8_t> TextureCooker::Compress(ImageFormat format, const uint8_t* rgba, uint32_t width, uint32_t height)
+    {
+        AE_CORE_ASSERT(Texture::IsCompressed(format), "TextureCooker: Not a block compressed format!");
+
+        uint32_t blocksX = (width + 3) / 4, blocksY = (height + 3) / 4;
+        size_t blockSize = format == ImageFormat::BC1 ? 8 : 16;
+        std::vector<uint8_t> out((size_t)blocksX * blocksY * blockSize);
+
+        uint8_t block[16][4];
+        uint8_t* dst = out.data();
+        for (uint32_t by = 0; by < blocksY; by++)
+        {
+            for (uint32_t bx = 0; bx < blocksX; bx++, dst += blockSize)
+            {
+                for (uint32_t i = 0; i < 16; i++)
+                {
+                    uint32_t x = std::min(bx * 4 + (i & 3), width - 1);
+                    uint32_t y = std::min(by * 4 + (i >> 2), height - 1);
+                    memcpy(block[i], rgba + ((size_t)y * width + x) * 4, 4);
+                }
+
+                switch (format)
+                {
+                    case ImageFormat::BC1:
+                        Utils::EncodeColorBlock(block, dst);
+                        break;
+                    case ImageFormat::BC3:
+                        Utils::EncodeChannelBlock(block, 3, dst);
+                        Utils::EncodeColorBlock(block, dst + 8);
+                        break;
+                    case ImageFormat::BC5:
+                        Utils::EncodeChannelBlock(block, 0, dst);
+                        Utils::EncodeChannelBlock(block, 1, dst + 8);
+                        break;
+                    case ImageFormat::BC7:
+                        Utils::EncodeBC7Block(block, dst);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        return out;
+    }
+
+    ImageFormat TextureCooker::SelectCompression(ImageFormat requested)
+    {
+        while (requested != ImageFormat::None && !Texture2D::IsFormatSupported(requested))
+        {
+            // BC3 is the closest RGBA format almost every desktop GPU has
+            requested = requested == ImageFormat::BC7 ? ImageFormat::BC3 : ImageFormat::None;
+        }
+        return requested;
+    }
+}
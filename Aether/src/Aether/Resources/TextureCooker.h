@@ -0,0 +1,46 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Resources/Texture.h"
+#include "Aether/Renderer/StagingBuffer.h"
+
+namespace Aether {
+
+    // CPU copy of a full mip chain, kept until every level is on the GPU
+    struct MipChain
+    {
+        struct Level
+        {
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            size_t Offset = 0;
+            size_t Size = 0;
+        };
+
+        TextureSpec Spec;
+        std::vector<Level> Levels;
+        std::vector<uint8_t> Data;
+        // Tail levels already copied to staging memory by TextureStreamer::StageTail(); handed
+        // back by TextureStreamer::CreateTexture() or Discard()
+        StagingAllocation Staging;
+        size_t StagingOffset = 0;
+
+        const void* GetLevelData(uint32_t level) const { return Data.data() + Levels[level].Offset; }
+    };
+
+    // Turns decoded pixels into a GPU-ready mip chain: builds every level on the CPU (in linear
+    // space for sRGB color) and optionally block-compresses them. CPU only, safe on worker threads.
+    class AETHER_API TextureCooker
+    {
+    public:
+        // `pixels` is level 0 in the layout SetData() expects
+        static Ref<MipChain> Cook(const TextureSpec& spec, const void* pixels, const TextureCookSettings& settings = {});
+
+        // Encodes one RGBA8 image to BC1/BC3/BC5/BC7. Edge blocks of sizes that aren't a
+        // multiple of 4 repeat the last row/column.
+        static std::vector<uint8_t> Compress(ImageFormat format, const uint8_t* rgba, uint32_t width, uint32_t height);
+
+        // The format Cook() will actually produce for `requested` on this GPU
+        static ImageFormat SelectCompression(ImageFormat requested);
+    };
+}
@@ -0,0 +1,304 @@
+#include "aepch.h"
+#include "Aether/Resources/TextureStreamer.h"
+#include "Aether/Core/JobSystem.h"
+#include "Aether/Renderer/Renderer.h"
+
+namespace Aether {
+
+    // Levels up to this size are uploaded with the texture so it is usable right away
+    static constexpr uint32_t s_TailSize = 64;
+    // MIN_LOD step per frame when a finer level arrives (fades in over ~4 frames)
+    static constexpr float s_FadeStep = 0.25f;
+
+    static uint64_t s_UploadBudget = 16 * 1024 * 1024;
+
+    Ref<StagingBuffer> TextureStreamer::s_Staging;
+    std::vector<TextureStreamer::StagedUpload> TextureStreamer::s_StagedUploads;
+    std::mutex TextureStreamer::s_StagedMutex;
+    std::unordered_map<uint32_t, float> TextureStreamer::s_Requests;
+    std::mutex TextureStreamer::s_RequestMutex;
+
+    void TextureStreamer::Init(uint64_t stagingSize)
+    {
+        std::atomic_store(&s_Staging, StagingBuffer::Create(stagingSize));
+        if (!s_Staging)
+            AE_CORE_INFO("TextureStreamer: Persistent mapping unavailable, uploading from client memory");
+    }
+
+    void TextureStreamer::Shutdown()
+    {
+        GetEntries().clear();
+        {
+            std::lock_guard<std::mutex> lock(s_StagedMutex);
+            s_StagedUploads.clear();
+        }
+        {
+            std::lock_guard<std::mutex> lock(s_RequestMutex);
+            s_Requests.clear();
+        }
+        std::atomic_store(&s_Staging, Ref<StagingBuffer>());
+    }
+
+    Ref<Texture2D> TextureStreamer::CreateTexture(const Ref<MipChain>& chain)
+    {
+        auto texture = Texture2D::Create(chain->Spec);
+        if (!texture)
+        {
+            Discard(*chain);
+            return nullptr;
+        }
+
+        uint32_t tail = GetTailLevel(*chain);
+        for (uint32_t level = (uint32_t)chain->Levels.size(); level-- > tail;)
+        {
+            const auto& mip = chain->Levels[level];
+            if (chain->Staging)
+                texture->SetMipData(level, chain->Staging.Slice(mip.Offset - chain->StagingOffset, mip.Size));
+            else
+                texture->SetMipData(level, chain->GetLevelData(level), (uint32_t)mip.Size);
+        }
+
+        // The copies are queued, so the block can go behind its fence
+        Discard(*chain);
+        texture->SetLodClamp(tail);
+        return texture;
+    }
+
+    void TextureStreamer::StageTail(MipChain& chain)
+    {
+        auto staging = std::atomic_load(&s_Staging);
+        if (!staging || chain.Staging || chain.Levels.empty())
+            return;
+
+        // Levels are stored finest first, so the tail is one contiguous suffix of Data
+        size_t offset = chain.Levels[GetTailLevel(chain)].Offset;
+        size_t size = chain.Data.size() - offset;
+
+        chain.Staging = staging->Allocate(size);
+        if (!chain.Staging)
+            return;
+
+        memcpy(chain.Staging.Data, chain.Data.data() + offset, size);
+        chain.StagingOffset = offset;
+    }
+
+    void TextureStreamer::Discard(MipChain& chain)
+    {
+        if (chain.Staging && s_Staging)
+            s_Staging->Release(chain.Staging);
+        chain.Staging = {};
+    }
+
+    void TextureStreamer::Track(Handle<Texture2D> handle, const std::weak_ptr<Texture2D>& texture, const Ref<MipChain>& chain)
+    {
+        // CreateTexture() left the tail resident
+        uint32_t uploaded = GetTailLevel(*chain);
+        if (uploaded == 0)
+        {
+            GetEntries().erase(handle.Value);
+            return;
+        }
+
+        Entry& entry = GetEntries()[handle.Value];
+        entry = Entry();
+        entry.Texture = texture;
+        entry.Chain = chain;
+        entry.Width = chain->Spec.Width;
+        entry.Height = chain->Spec.Height;
+        entry.LevelCount = (uint32_t)chain->Levels.size();
+        entry.UploadedLevel = uploaded;
+        entry.BaseLevel = uploaded;
+    }
+
+    void TextureStreamer::Request(Handle<Texture2D> handle, float screenPixels)
+    {
+        std::lock_guard<std::mutex> lock(s_RequestMutex);
+        float& pixels = s_Requests[handle.Value];
+        pixels = std::max(pixels, screenPixels);
+    }
+
+    void TextureStreamer::Update()
+    {
+        uint64_t uploaded = 0;
+
+        auto& entries = GetEntries();
+        std::vector<LevelUpload> uploads;
+        std::vector<LodClamp> clamps;
+        std::vector<StagingAllocation> released;
+
+        {
+            std::lock_guard<std::mutex> lock(s_RequestMutex);
+            for (const auto& [handle, pixels] : s_Requests)
+            {
+                auto it = entries.find(handle);
+                if (it != entries.end())
+                    it->second.RequestedPixels = std::max(it->second.RequestedPixels, pixels);
+            }
+            s_Requests.clear();
+        }
+
+        // Issue the copies for levels the workers have staged since last frame
+        std::vector<StagedUpload> staged;
+        {
+            std::lock_guard<std::mutex> lock(s_StagedMutex);
+            staged.swap(s_StagedUploads);
+        }
+
+        for (auto& upload : staged)
+        {
+            auto it = entries.find(upload.Handle);
+            // Skip results for a texture that has since been replaced or dropped
+            bool current = it != entries.end()
+                && !it->second.Texture.owner_before(upload.Texture) && !upload.Texture.owner_before(it->second.Texture);
+            Ref<Texture2D> texture = current ? upload.Texture.lock() : nullptr;
+            if (texture)
+            {
+                Entry& entry = it->second;
+                entry.UploadedLevel = upload.Level;
+                entry.UploadPending = false;
+                if (upload.Level == 0)
+                    entry.Chain.reset();
+                uploads.push_back({ std::move(texture), upload.Chain, upload.Level, upload.Staging });
+            }
+
+            if (upload.Staging)
+                released.push_back(upload.Staging);
+        }
+
+        for (auto it = entries.begin(); it != entries.end();)
+        {
+            Entry& entry = it->second;
+            // Replaced, evicted or shut down
+            if (entry.Texture.expired())
+            {
+                it = entries.erase(it);
+                continue;
+            }
+            uint32_t handle = it->first;
+            ++it;
+
+            // Without a request this frame the texture keeps its last target
+            if (entry.RequestedPixels > 0.0f)
+                entry.DesiredLevel = SelectLevel(entry);
+            entry.RequestedPixels = 0.0f;
+
+            // One level per texture per frame; the first upload always goes through so a
+            // level larger than the budget can't stall the feeder
+            if (entry.Chain && !entry.UploadPending && entry.DesiredLevel < entry.UploadedLevel && (uploaded == 0 || uploaded < s_UploadBudget))
+            {
+                uint32_t level = entry.UploadedLevel - 1;
+                uploaded += entry.Chain->Levels[level].Size;
+
+                if (s_Staging)
+                {
+                    // The worker's copy lands in a later frame; the upload happens then
+                    Stage(handle, entry.Texture, entry.Chain, level);
+                    entry.UploadPending = true;
+                }
+                else
+                {
+                    uploads.push_back({ entry.Texture.lock(), entry.Chain, level, {} });
+                    entry.UploadedLevel = level;
+
+                    // Fully resident: the CPU copy has done its job
+                    if (level == 0)
+                        entry.Chain.reset();
+                }
+            }
+
+            uint32_t baseLevel = std::max(entry.DesiredLevel, entry.UploadedLevel);
+            // Keep the effective clamp where it was and let it slide down to the new base
+            float minLod = std::max(entry.MinLod - s_FadeStep, 0.0f);
+            if (baseLevel < entry.BaseLevel)
+                minLod = (float)(entry.BaseLevel - baseLevel) + entry.MinLod;
+
+            if (baseLevel != entry.BaseLevel || minLod != entry.MinLod)
+            {
+                clamps.push_back({ entry.Texture.lock(), baseLevel, minLod });
+                entry.BaseLevel = baseLevel;
+                entry.MinLod = minLod;
+            }
+        }
+
+        // The textures die on the render thread if these were the last references
+        Renderer::Submit([uploads = std::move(uploads), clamps = std::move(clamps), released = std::move(released)]()
+        {
+            for (const auto& upload : uploads)
+            {
+                if (!upload.Texture)
+                    continue;
+                if (upload.Staging)
+                    upload.Texture->SetMipData(upload.Level, upload.Staging);
+                else
+                    upload.Texture->SetMipData(upload.Level, upload.Chain->GetLevelData(upload.Level), (uint32_t)upload.Chain->Levels[upload.Level].Size);
+            }
+
+            for (const auto& clamp : clamps)
+            {
+                if (clamp.Texture)
+                    clamp.Texture->SetLodClamp(clamp.BaseLevel, clamp.MinLod);
+            }
+
+            if (s_Staging)
+            {
+                for (const auto& staging : released)
+                    s_Staging->Release(staging);
+                s_Staging->Reclaim();
+            }
+        });
+    }
+
+    void TextureStreamer::SetUploadBudget(uint64_t bytesPerFrame)
+    {
+        s_UploadBudget = bytesPerFrame;
+    }
+
+    uint64_t TextureStreamer::GetUploadBudget()
+    {
+        return s_UploadBudget;
+    }
+
+    uint32_t TextureStreamer::SelectLevel(const Entry& entry)
+    {
+        float size = (float)std::max(entry.Width, entry.Height);
+        float level = std::floor(std::log2(std::max(size / entry.RequestedPixels, 1.0f)));
+        return std::min((uint32_t)level, entry.LevelCount - 1);
+    }
+
+    uint32_t TextureStreamer::GetTailLevel(const MipChain& chain)
+    {
+        uint32_t level = (uint32_t)chain.Levels.size() - 1;
+        while (level > 0 && std::max(chain.Levels[level - 1].Width, chain.Levels[level - 1].Height) <= s_TailSize)
+            level--;
+        return level;
+    }
+
+    void TextureStreamer::Stage(uint32_t handle, const std::weak_ptr<Texture2D>& texture, const Ref<MipChain>& chain, uint32_t level)
+    {
+        StagedUpload upload;
+        upload.Handle = handle;
+        upload.Texture = texture;
+        upload.Chain = chain;
+        upload.Level = level;
+
+        JobSystem::SubmitJob([upload]() mutable
+        {
+            const auto& mip = upload.Chain->Levels[upload.Level];
+            if (auto staging = std::atomic_load(&s_Staging))
+            {
+                upload.Staging = staging->Allocate(mip.Size);
+                if (upload.Staging)
+                    memcpy(upload.Staging.Data, upload.Chain->GetLevelData(upload.Level), mip.Size);
+            }
+
+            std::lock_guard<std::mutex> lock(s_StagedMutex);
+            s_StagedUploads.push_back(std::move(upload));
+        });
+    }
+
+    std::unordered_map<uint32_t, TextureStreamer::Entry>& TextureStreamer::GetEntries()
+    {
+        static std::unordered_map<uint32_t, Entry> s_Entries;
+        return s_Entries;
+    }
+}
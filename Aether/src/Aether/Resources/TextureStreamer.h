@@ -0,0 +1,107 @@
+#pragma once
+
+#include "aepch.h"
+#include "Aether/Resources/TextureCooker.h"
+
+#include <mutex>
+
+namespace Aether {
+
+    // Progressive texture residency. Streamed textures are created with storage for the whole
+    // chain and only the small tail mips uploaded; Update() then feeds finer levels each frame,
+    // as far down as the screen-space size reported through Request() calls for, and clamps
+    // GL_TEXTURE_BASE_LEVEL to what has arrived. Textures nobody requests stream to full size.
+    // When the backend supports it, workers copy level data into a persistently mapped staging
+    // ring and the render thread only issues the buffer-to-texture copies. The bookkeeping runs
+    // on the main thread and only holds textures weakly; the GL work goes through Renderer::Submit.
+    class AETHER_API TextureStreamer
+    {
+    public:
+        static void Init(uint64_t stagingSize = 64 * 1024 * 1024);
+        static void Shutdown();
+
+        // Worker side: copies the levels CreateTexture() uploads into the staging ring.
+        // Optional; without it (or when the ring is full) they upload from client memory.
+        static void StageTail(MipChain& chain);
+
+        // Render thread: returns a chain's staging memory when it won't reach CreateTexture()
+        static void Discard(MipChain& chain);
+
+        // Render thread: creates a Streamed texture with its tail mips resident
+        static Ref<Texture2D> CreateTexture(const Ref<MipChain>& chain);
+
+        // Main thread: hands the rest of a chain CreateTexture() consumed to the feeder
+        static void Track(Handle<Texture2D> handle, const std::weak_ptr<Texture2D>& texture, const Ref<MipChain>& chain);
+
+        // Any thread: reports that the texture covers roughly `screenPixels` pixels this frame
+        // (largest request wins)
+        static void Request(Handle<Texture2D> handle, float screenPixels);
+
+        // Called once per frame by Application, on the main thread
+        static void Update();
+
+        static void SetUploadBudget(uint64_t bytesPerFrame);
+        static uint64_t GetUploadBudget();
+
+    private:
+        struct Entry
+        {
+            std::weak_ptr<Texture2D> Texture;
+            Ref<MipChain> Chain;
+            // Of level 0, and the chain's length; the texture itself is only touched on the render thread
+            uint32_t Width = 0, Height = 0, LevelCount = 0;
+            // Finest level that has been uploaded
+            uint32_t UploadedLevel = 0;
+            // GL_TEXTURE_BASE_LEVEL as last submitted
+            uint32_t BaseLevel = 0;
+            // Finest level the feeder is aiming for
+            uint32_t DesiredLevel = 0;
+            float RequestedPixels = 0.0f;
+            float MinLod = 0.0f;
+            // A worker is copying UploadedLevel - 1 into staging memory
+            bool UploadPending = false;
+        };
+
+        // A level copied by a worker, waiting for the main thread to issue its upload
+        struct StagedUpload
+        {
+            uint32_t Handle = 0;
+            std::weak_ptr<Texture2D> Texture;
+            Ref<MipChain> Chain;
+            uint32_t Level = 0;
+            // Empty when the ring was full; the level then uploads from Chain
+            StagingAllocation Staging;
+        };
+
+        // GL side of Update(), gathered on the main thread and issued on the render thread
+        struct LevelUpload
+        {
+            Ref<Texture2D> Texture;
+            Ref<MipChain> Chain;
+            uint32_t Level = 0;
+            // Empty to upload from Chain
+            StagingAllocation Staging;
+        };
+
+        struct LodClamp
+        {
+            Ref<Texture2D> Texture;
+            uint32_t BaseLevel = 0;
+            float MinLod = 0.0f;
+        };
+
+        static uint32_t SelectLevel(const Entry& entry);
+        static uint32_t GetTailLevel(const MipChain& chain);
+        static void Stage(uint32_t handle, const std::weak_ptr<Texture2D>& texture, const Ref<MipChain>& chain, uint32_t level);
+
+        // Handle value -> entry, main thread only
+        static std::unordered_map<uint32_t, Entry>& GetEntries();
+
+        static Ref<StagingBuffer> s_Staging;
+        static std::vector<StagedUpload> s_StagedUploads;
+        static std::mutex s_StagedMutex;
+        // Handle value -> largest request since the last Update()
+        static std::unordered_map<uint32_t, float> s_Requests;
+        static std::mutex s_RequestMutex;
+    };
+}
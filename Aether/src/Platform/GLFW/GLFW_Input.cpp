@@ -9,6 +9,8 @@ namespace Aether {
 	bool Input::IsKeyPressed(const KeyCode key)
 	{
 		auto* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetWindow());
+		if (!window)
+			return false;
 		auto state = glfwGetKey(window, static_cast<int32_t>(key));
 		return state == GLFW_PRESS;
 	}
@@ -16,6 +18,8 @@ namespace Aether {
 	void Input::SetCursorMode(CursorMode mode)
     {
         auto* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetWindow());
+        if (!window)
+            return;
         switch (mode)
         {
             case CursorMode::Normal:
@@ -33,6 +37,8 @@ namespace Aether {
 	bool Input::IsMouseButtonPressed(const MouseCode button)
 	{
 		auto* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetWindow());
+		if (!window)
+			return false;
 		auto state = glfwGetMouseButton(window, static_cast<int32_t>(button));
 		return state == GLFW_PRESS;
 	}
@@ -40,6 +46,8 @@ namespace Aether {
 	glm::vec2 Input::GetMousePosition()
 	{
 		auto* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetWindow());
+		if (!window)
+			return { 0.0f, 0.0f };
 		double xpos, ypos;
 		glfwGetCursorPos(window, &xpos, &ypos);
 
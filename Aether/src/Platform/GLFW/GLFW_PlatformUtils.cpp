@@ -1,13 +1,22 @@
 #include "aepch.h"
 #include "Aether/Utils/PlatformUtils.h"
 #include "Aether/Core/Application.h"
+#include "Aether/Renderer/RendererAPI.h"
 
 #include <GLFW/glfw3.h>
+#include <chrono>
 
 namespace Aether {
 
 	float Time::GetTime()
 	{
+		// GLFW is never initialized without a window
+		if (RendererAPI::GetAPI() == RendererAPI::API::Null)
+		{
+			static const auto s_Start = std::chrono::steady_clock::now();
+			return std::chrono::duration<float>(std::chrono::steady_clock::now() - s_Start).count();
+		}
+
 		return glfwGetTime();
 	}
 
@@ -2,6 +2,7 @@
 #include "Platform/GLFW/GLFW_Window.h"
 
 #include "Aether/Core/Input.h"
+#include "Aether/Renderer/Renderer.h"
 
 #include "Aether/Events/ApplicationEvent.h"
 #include "Aether/Events/MouseEvent.h"
@@ -70,7 +71,7 @@ namespace Aether {
 			data.FramebufferWidth = fbWidth;
 			data.FramebufferHeight = fbHeight;
 
-			glViewport(0, 0, fbWidth, fbHeight);
+			Renderer::OnWindowResize(fbWidth, fbHeight);
 
 			WindowResizeEvent event(width, height);
 			data.EventCallback(event);
@@ -167,7 +168,8 @@ namespace Aether {
 	void GLFW_Window::Update()
 	{
 		glfwPollEvents();
-		m_Context->SwapBuffers();
+		// Presents once this frame's recorded commands have replayed
+		Renderer::Submit([context = m_Context.get()]() { context->SwapBuffers(); });
 	}
 
 	void GLFW_Window::SetVSync(bool enabled)
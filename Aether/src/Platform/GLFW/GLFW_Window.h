@@ -27,6 +27,7 @@ namespace Aether {
 		bool IsVSync() const override;
 
 		virtual void* GetWindow() const override { return m_Window; }
+		virtual GraphicsContext* GetContext() const override { return m_Context.get(); }
 	private:
 		virtual void Init(const WinProps& props);
 		virtual void Shutdown();
@@ -0,0 +1,100 @@
+#include "aepch.h"
+#include "Platform/Null/NullBuffer.h"
+#include "Platform/Null/NullRendererAPI.h"
+#include "Aether/Renderer/Renderer.h"
+
+namespace Aether {
+
+    NullVertexBuffer::NullVertexBuffer(uint32_t size)
+        : m_RendererID(NullRendererAPI::CreateRendererID()), m_Size(size)
+    {
+    }
+
+    NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size)
+        : m_RendererID(NullRendererAPI::CreateRendererID()), m_Size(size)
+    {
+        NullRendererAPI::GetStats().BytesUploaded += size;
+    }
+
+    void NullVertexBuffer::Bind() const
+    {
+        NullRendererAPI::GetStats().StateChanges++;
+    }
+
+    void NullVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+    {
+        AE_CORE_ASSERT(offset + size <= m_Size, "Vertex buffer upload out of range!");
+        NullRendererAPI::GetStats().BytesUploaded += size;
+    }
+
+    void NullVertexBuffer::Resize(uint32_t size)
+    {
+        m_Size = size;
+    }
+
+    NullIndexBuffer::NullIndexBuffer(uint32_t* indices, uint32_t count)
+        : m_RendererID(NullRendererAPI::CreateRendererID()), m_Count(count)
+    {
+        NullRendererAPI::GetStats().BytesUploaded += (uint64_t)count * sizeof(uint32_t);
+    }
+
+    void NullIndexBuffer::Bind() const
+    {
+        NullRendererAPI::GetStats().StateChanges++;
+    }
+
+    NullUniformBuffer::NullUniformBuffer(uint32_t size, uint32_t binding)
+        : m_RendererID(NullRendererAPI::CreateRendererID()), m_Size(size)
+    {
+    }
+
+    void NullUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+    {
+        AE_CORE_ASSERT(offset + size <= m_Size, "Uniform buffer upload out of range!");
+        NullRendererAPI::GetStats().BytesUploaded += size;
+    }
+
+    NullRingBuffer::NullRingBuffer(uint64_t frameSize)
+        : m_RendererID(NullRendererAPI::CreateRendererID()), m_FrameSize((frameSize + 255) & ~255ull),
+          m_Storage(m_FrameSize * Renderer::FramesInFlight)
+    {
+    }
+
+    RingAllocation NullRingBuffer::Allocate(uint64_t size, uint64_t alignment)
+    {
+        AE_CORE_ASSERT(alignment && (alignment & (alignment - 1)) == 0, "Ring buffer alignment must be a power of two!");
+
+        uint64_t frame = RenderThread::GetReplayFrameIndex();
+        if (frame != m_Frame)
+        {
+            m_Frame = frame;
+            m_Head = 0;
+        }
+
+        uint64_t offset = (m_Head + alignment - 1) & ~(alignment - 1);
+        if (size == 0 || offset + size > m_FrameSize)
+            return {};
+        m_Head = offset + size;
+
+        offset += (frame % Renderer::FramesInFlight) * m_FrameSize;
+
+        RingAllocation allocation;
+        allocation.Data = m_Storage.data() + offset;
+        allocation.BufferID = m_RendererID;
+        allocation.Offset = offset;
+        allocation.Size = size;
+        return allocation;
+    }
+
+    void NullRingBuffer::Commit(const RingAllocation& allocation)
+    {
+        // Counted as if streamed, so headless runs compare with the SetData path
+        NullRendererAPI::GetStats().BytesUploaded += allocation.Size;
+    }
+
+    void NullRingBuffer::BindUniform(uint32_t binding, const RingAllocation& allocation)
+    {
+        AE_CORE_ASSERT(allocation.Offset % GetUniformAlignment() == 0, "Uniform range is not aligned!");
+        NullRendererAPI::GetStats().StateChanges++;
+    }
+}
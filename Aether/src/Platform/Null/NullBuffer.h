@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Aether/Renderer/Buffer.h"
+#include "Aether/Renderer/UniformBuffer.h"
+#include "Aether/Renderer/RingBuffer.h"
+
+namespace Aether {
+
+    class NullVertexBuffer : public VertexBuffer
+    {
+    public:
+        NullVertexBuffer(uint32_t size);
+        NullVertexBuffer(float* vertices, uint32_t size);
+
+        virtual void Bind() const override;
+        virtual void Unbind() const override {}
+
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset) override;
+
+        virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+        virtual uint32_t GetSize() const override { return m_Size; }
+        virtual void Resize(uint32_t size) override;
+        virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+    private:
+        uint32_t m_RendererID;
+        uint32_t m_Size;
+        BufferLayout m_Layout;
+    };
+
+    class NullIndexBuffer : public IndexBuffer
+    {
+    public:
+        NullIndexBuffer(uint32_t* indices, uint32_t count);
+
+        virtual void Bind() const override;
+        virtual void Unbind() const override {}
+
+        virtual uint32_t GetCount() const override { return m_Count; }
+    private:
+        uint32_t m_RendererID;
+        uint32_t m_Count;
+    };
+
+    class NullUniformBuffer : public UniformBuffer
+    {
+    public:
+        NullUniformBuffer(uint32_t size, uint32_t binding);
+
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+    private:
+        uint32_t m_RendererID;
+        uint32_t m_Size;
+    };
+
+    // Client memory with the same per-frame regions, so overflows and bad alignment still show up
+    class NullRingBuffer : public RingBuffer
+    {
+    public:
+        NullRingBuffer(uint64_t frameSize);
+
+        virtual RingAllocation Allocate(uint64_t size, uint64_t alignment) override;
+        virtual void Commit(const RingAllocation& allocation) override;
+        virtual void BindUniform(uint32_t binding, const RingAllocation& allocation) override;
+
+        virtual uint64_t GetFrameCapacity() const override { return m_FrameSize; }
+        virtual uint64_t GetUniformAlignment() const override { return 256; }
+    private:
+        uint32_t m_RendererID;
+        uint64_t m_FrameSize;
+        std::vector<uint8_t> m_Storage;
+
+        uint64_t m_Frame = ~0ull;
+        uint64_t m_Head = 0;
+    };
+}
@@ -0,0 +1,86 @@
+#include "aepch.h"
+#include "Platform/Null/NullFrameBuffer.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+namespace Aether {
+
+	NullFrameBuffer::NullFrameBuffer(const FramebufferSpecification& spec)
+		: m_Specification(spec)
+	{
+		Invalidate();
+	}
+
+	void NullFrameBuffer::Invalidate()
+	{
+		m_RendererID = NullRendererAPI::CreateRendererID();
+		m_ColorAttachments.clear();
+		m_DepthAttachment = 0;
+
+		for (const auto& attachment : m_Specification.Attachments.Attachments)
+		{
+			if (attachment.TextureFormat == FramebufferTextureFormat::DEPTH24STENCIL8)
+				m_DepthAttachment = NullRendererAPI::CreateRendererID();
+			else if (attachment.TextureFormat != FramebufferTextureFormat::None)
+				m_ColorAttachments.push_back(NullRendererAPI::CreateRendererID());
+		}
+		m_ClearValues.assign(m_ColorAttachments.size(), 0);
+	}
+
+	void NullFrameBuffer::Bind()
+	{
+		// Binding also sets the viewport, as in the GL backend
+		NullRendererAPI::GetStats().StateChanges += 2;
+	}
+
+	void NullFrameBuffer::Unbind()
+	{
+		NullRendererAPI::GetStats().StateChanges++;
+	}
+
+	void NullFrameBuffer::Resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0)
+		{
+			AE_CORE_WARN("Attempted to rezize framebuffer to {0}, {1}", width, height);
+			return;
+		}
+		if (width == m_Specification.Width && height == m_Specification.Height)
+			return;
+
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+
+		Invalidate();
+	}
+
+	int NullFrameBuffer::ReadPixel(uint32_t attachmentIndex, int x, int y)
+	{
+		AE_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "attachmentIndex out of range!");
+		return m_ClearValues[attachmentIndex];
+	}
+
+	void NullFrameBuffer::ClearAttachment(uint32_t attachmentIndex, int value)
+	{
+		AE_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "attachmentIndex out of range!");
+		m_ClearValues[attachmentIndex] = value;
+		NullRendererAPI::GetStats().Clears++;
+	}
+
+	void NullFrameBuffer::SetDepthLayer(uint32_t layer)
+	{
+		AE_CORE_ASSERT(layer < m_Specification.Layers, "Depth layer out of range!");
+		NullRendererAPI::GetStats().StateChanges++;
+	}
+
+	void NullFrameBuffer::BindDepthTexture(uint32_t slot) const
+	{
+		NullRendererAPI::GetStats().StateChanges++;
+	}
+
+	void NullFrameBuffer::BindColorTexture(uint32_t slot, uint32_t index) const
+	{
+		AE_CORE_ASSERT(index < m_ColorAttachments.size(), "Color attachment index out of range!");
+		NullRendererAPI::GetStats().StateChanges++;
+	}
+
+}
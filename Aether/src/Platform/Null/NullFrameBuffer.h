@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Aether/Renderer/FrameBuffer.h"
+
+namespace Aether {
+
+	class NullFrameBuffer : public FrameBuffer
+	{
+	public:
+		NullFrameBuffer(const FramebufferSpecification& spec);
+
+		virtual void Invalidate() override;
+
+		virtual void Bind() override;
+		virtual void Unbind() override;
+
+		virtual void Resize(uint32_t width, uint32_t height) override;
+		// Nothing is rasterized, so a read returns what the attachment was last cleared to
+		virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) override;
+
+		virtual void ClearAttachment(uint32_t attachmentIndex, int value) override;
+		virtual void SetDepthLayer(uint32_t layer) override;
+
+		virtual void BindDepthTexture(uint32_t slot = 0) const override;
+		virtual void BindColorTexture(uint32_t slot = 0, uint32_t index = 0) const override;
+
+		virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const override { AE_CORE_ASSERT(index < m_ColorAttachments.size(), "Color attachment index out of range!"); return m_ColorAttachments[index]; }
+		virtual uint32_t GetDepthAttachmentRendererID() const override { return m_DepthAttachment; }
+
+		virtual const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+	private:
+		uint32_t m_RendererID = 0;
+		FramebufferSpecification m_Specification;
+
+		std::vector<uint32_t> m_ColorAttachments;
+		std::vector<int> m_ClearValues;
+		uint32_t m_DepthAttachment = 0;
+	};
+
+}
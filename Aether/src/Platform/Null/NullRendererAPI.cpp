@@ -0,0 +1,91 @@
+#include "aepch.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+namespace Aether {
+
+	void NullRendererAPI::Init()
+	{
+		ResetStats();
+		AE_CORE_INFO("Null renderer initialized; draws are recorded, not rendered");
+	}
+
+	void NullRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		GetStats().StateChanges++;
+	}
+
+	void NullRendererAPI::SetDepthFuncEqual(bool state)
+	{
+		GetStats().StateChanges++;
+	}
+
+	void NullRendererAPI::SetClearColor(const glm::vec4& color)
+	{
+		GetStats().StateChanges++;
+	}
+
+	void NullRendererAPI::Clear()
+	{
+		GetStats().Clears++;
+	}
+
+	void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
+	{
+		auto& stats = GetStats();
+		stats.DrawCalls++;
+		stats.Instances++;
+		stats.Indices += indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+	}
+
+	void NullRendererAPI::DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount)
+	{
+		auto& stats = GetStats();
+		stats.DrawCalls++;
+		stats.Instances += instanceCount;
+		stats.Indices += (uint64_t)vertexArray->GetIndexBuffer()->GetCount() * instanceCount;
+	}
+
+	void NullRendererAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount)
+	{
+		auto& stats = GetStats();
+		stats.DrawCalls++;
+		stats.Instances++;
+		stats.Indices += vertexCount;
+	}
+
+	void NullRendererAPI::DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, void* indices, int32_t baseVertex)
+	{
+		auto& stats = GetStats();
+		stats.DrawCalls++;
+		stats.Instances++;
+		stats.Indices += indexCount;
+	}
+
+	void NullRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseIndex, int32_t baseVertex, uint32_t instanceCount, uint32_t baseInstance)
+	{
+		AE_CORE_ASSERT(baseIndex + indexCount <= vertexArray->GetIndexBuffer()->GetCount(), "Instanced draw reads past the index buffer!");
+
+		auto& stats = GetStats();
+		stats.DrawCalls++;
+		stats.Instances += instanceCount;
+		stats.Indices += (uint64_t)indexCount * instanceCount;
+	}
+
+	void NullRendererAPI::SetLineWidth(float width)
+	{
+		GetStats().StateChanges++;
+	}
+
+	NullRenderStats& NullRendererAPI::GetStats()
+	{
+		static NullRenderStats s_Stats;
+		return s_Stats;
+	}
+
+	uint32_t NullRendererAPI::CreateRendererID()
+	{
+		static uint32_t s_NextID = 0;
+		GetStats().ResourcesCreated++;
+		return ++s_NextID;
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Aether/Renderer/RendererAPI.h"
+
+namespace Aether {
+
+	// What the Null backend was asked to do. Every call is counted, redundant or not, since
+	// the point is to measure what the engine submits rather than what a driver would keep.
+	struct NullRenderStats
+	{
+		uint64_t Frames = 0;
+		uint64_t DrawCalls = 0;
+		uint64_t Instances = 0;
+		uint64_t Indices = 0;
+		// Binds of shaders, vertex arrays, buffers, textures and framebuffers, plus fixed-function state
+		uint64_t StateChanges = 0;
+		uint64_t UniformUpdates = 0;
+		uint64_t Clears = 0;
+		uint64_t BytesUploaded = 0;
+		uint64_t ResourcesCreated = 0;
+	};
+
+	// Records instead of rendering, so the frame loop and asset upload paths run on machines
+	// without a GPU. Main thread only, like the GL backend it stands in for.
+	class NullRendererAPI : public RendererAPI
+	{
+	public:
+		virtual void Init() override;
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+		virtual void SetDepthFuncEqual(bool state) override;
+
+		virtual void SetClearColor(const glm::vec4& color) override;
+		virtual void Clear() override;
+
+		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+		virtual void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount) override;
+		virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) override;
+		virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, void* indices, int32_t baseVertex) override;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseIndex, int32_t baseVertex, uint32_t instanceCount, uint32_t baseInstance) override;
+		virtual bool SupportsBaseInstance() const override { return true; }
+
+		virtual void SetLineWidth(float width) override;
+
+		virtual uint64_t InsertFence() override { return 0; }
+		virtual void WaitFence(uint64_t fence) override {}
+
+		static NullRenderStats& GetStats();
+		static void ResetStats() { GetStats() = {}; }
+
+		// Stand-in for GL object names, so Texture::operator== and ID-based lookups keep working
+		static uint32_t CreateRendererID();
+	};
+}
@@ -0,0 +1,66 @@
+#include "aepch.h"
+#include "Platform/Null/NullShader.h"
+#include "Platform/Null/NullRendererAPI.h"
+#include "Aether/Resources/ShaderPreprocessor.h"
+
+namespace Aether {
+
+    NullShader::NullShader(const std::string& filepath)
+        : m_FilePath(filepath)
+    {
+        NullRendererAPI::CreateRendererID();
+        Preprocess();
+    }
+
+    void NullShader::Preprocess()
+    {
+        ShaderProgramSource source = ShaderPreprocessor::Process(m_FilePath);
+        m_SourceFiles = std::move(source.SourceFiles);
+
+        // A failed reload keeps the previous program, as the GL backend does
+        bool valid = !source.VertexSource.empty() && !source.FragmentSource.empty();
+        if (!valid)
+            AE_CORE_ERROR("NullShader: '{0}' has no vertex or fragment stage", m_FilePath);
+        m_Ready |= valid;
+    }
+
+    void NullShader::Reload()
+    {
+        Preprocess();
+    }
+
+    void NullShader::Bind() const
+    {
+        NullRendererAPI::GetStats().StateChanges++;
+    }
+
+    void NullShader::SetInt(const std::string& name, int value)
+    {
+        NullRendererAPI::GetStats().UniformUpdates++;
+    }
+
+    void NullShader::SetIntArray(const std::string& name, const int* values, uint32_t count)
+    {
+        NullRendererAPI::GetStats().UniformUpdates++;
+    }
+
+    void NullShader::SetFloat(const std::string& name, float value)
+    {
+        NullRendererAPI::GetStats().UniformUpdates++;
+    }
+
+    void NullShader::SetFloat3(const std::string& name, const glm::vec3& value)
+    {
+        NullRendererAPI::GetStats().UniformUpdates++;
+    }
+
+    void NullShader::SetFloat4(const std::string& name, const glm::vec4& value)
+    {
+        NullRendererAPI::GetStats().UniformUpdates++;
+    }
+
+    void NullShader::SetMat4(const std::string& name, const glm::mat4& value)
+    {
+        NullRendererAPI::GetStats().UniformUpdates++;
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Aether/Resources/Shader.h"
+
+namespace Aether {
+
+    // Runs the preprocessor so include errors and hot-reload dependencies behave as with GL;
+    // nothing is compiled
+    class NullShader : public Shader
+    {
+    public:
+        NullShader(const std::string& filepath);
+
+        virtual void Bind() const override;
+        virtual void Unbind() const override {}
+
+        virtual bool IsReady() const override { return m_Ready; }
+        virtual void Reload() override;
+
+        virtual const std::string& GetPath() const override { return m_FilePath; }
+        virtual const std::vector<std::string>& GetSourceFiles() const override { return m_SourceFiles; }
+
+        virtual void SetInt(const std::string& name, int value) override;
+        virtual void SetIntArray(const std::string& name, const int* values, uint32_t count) override;
+        virtual void SetFloat(const std::string& name, float value) override;
+        virtual void SetFloat3(const std::string& name, const glm::vec3& value) override;
+        virtual void SetFloat4(const std::string& name, const glm::vec4& value) override;
+        virtual void SetMat4(const std::string& name, const glm::mat4& value) override;
+    private:
+        void Preprocess();
+
+        std::string m_FilePath;
+        std::vector<std::string> m_SourceFiles;
+        bool m_Ready = false;
+    };
+}
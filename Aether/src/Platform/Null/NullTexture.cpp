@@ -0,0 +1,192 @@
+#include "aepch.h"
+#include "Platform/Null/NullTexture.h"
+#include "Platform/Null/NullRendererAPI.h"
+#include "Aether/Renderer/StagingBuffer.h"
+
+#include <stb_image.h>
+
+namespace Aether {
+
+    namespace Utils {
+
+        // Client-side bytes per pixel the GL backend expects; float formats take 32-bit RGBA
+        static uint32_t GetClientPixelSize(ImageFormat format)
+        {
+            switch (format)
+            {
+                case ImageFormat::RGB8:    return 3;
+                case ImageFormat::RGBA8:   return 4;
+                case ImageFormat::RGBA16F:
+                case ImageFormat::RGBA32F: return 16;
+                default:                   return 0;
+            }
+        }
+
+        static uint64_t GetClientLevelSize(ImageFormat format, uint32_t width, uint32_t height)
+        {
+            if (Texture::IsCompressed(format))
+                return Texture::CalculateLevelSize(format, width, height);
+            return (uint64_t)width * height * GetClientPixelSize(format);
+        }
+    }
+
+    NullTexture2D::NullTexture2D(const TextureSpec& spec)
+        : m_Spec(spec), m_RendererID(NullRendererAPI::CreateRendererID())
+    {
+        if (m_Spec.Streamed)
+        {
+            uint32_t fullChain = CalculateMipCount(m_Spec.Width, m_Spec.Height);
+            m_MipLevels = m_Spec.MipLevels ? std::min(m_Spec.MipLevels, fullChain) : fullChain;
+            // Nothing is resident yet
+            SetLodClamp(m_MipLevels - 1);
+        }
+        else if (IsCompressed(m_Spec.Format))
+        {
+            m_Spec.GenerateMips = false;
+        }
+        else if (m_Spec.GenerateMips)
+        {
+            m_MipLevels = CalculateMipCount(m_Spec.Width, m_Spec.Height);
+        }
+    }
+
+    NullTexture2D::NullTexture2D(void* data, size_t size)
+        : m_RendererID(NullRendererAPI::CreateRendererID())
+    {
+        int width, height, channels;
+        stbi_set_flip_vertically_on_load(0);
+
+        bool isHDR = stbi_is_hdr_from_memory((const stbi_uc*)data, (int)size);
+        void* pixels = isHDR
+            ? (void*)stbi_loadf_from_memory((const stbi_uc*)data, (int)size, &width, &height, &channels, 4)
+            : (void*)stbi_load_from_memory((const stbi_uc*)data, (int)size, &width, &height, &channels, 4);
+
+        if (!pixels)
+        {
+            AE_CORE_ERROR("Failed to load texture from memory!");
+            return;
+        }
+
+        m_IsLoaded = true;
+        m_Spec.Width = width;
+        m_Spec.Height = height;
+        m_Spec.Format = isHDR ? ImageFormat::RGBA16F : ImageFormat::RGBA8;
+        m_MipLevels = CalculateMipCount(width, height);
+        NullRendererAPI::GetStats().BytesUploaded += Utils::GetClientLevelSize(m_Spec.Format, width, height);
+
+        stbi_image_free(pixels);
+    }
+
+    NullTexture2D::NullTexture2D(const std::string& path, bool wrapMode, bool flip)
+        : m_Path(path), m_RendererID(NullRendererAPI::CreateRendererID())
+    {
+        int width, height, channels;
+        stbi_set_flip_vertically_on_load(flip);
+
+        bool isHDR = stbi_is_hdr(path.c_str());
+        void* pixels = isHDR
+            ? (void*)stbi_loadf(path.c_str(), &width, &height, &channels, 0)
+            : (void*)stbi_load(path.c_str(), &width, &height, &channels, 0);
+
+        if (!pixels)
+            return;
+
+        m_IsLoaded = true;
+        m_Spec.Width = width;
+        m_Spec.Height = height;
+        m_Spec.Format = isHDR ? ImageFormat::RGBA16F : (channels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8);
+        m_Spec.GenerateMips = false;
+        m_Spec.WrapMode = wrapMode;
+        // The decoder's own buffer is what the GL backend uploads
+        NullRendererAPI::GetStats().BytesUploaded += (uint64_t)width * height * channels * (isHDR ? sizeof(float) : 1);
+
+        stbi_image_free(pixels);
+    }
+
+    void NullTexture2D::SetData(const void* data, uint32_t size)
+    {
+        if (IsCompressed(m_Spec.Format))
+        {
+            SetMipData(0, data, size);
+            return;
+        }
+
+        AE_CORE_ASSERT(size == Utils::GetClientLevelSize(m_Spec.Format, m_Spec.Width, m_Spec.Height), "Data must be entire texture!");
+        NullRendererAPI::GetStats().BytesUploaded += size;
+    }
+
+    void NullTexture2D::SetMipData(uint32_t level, const void* data, uint32_t size)
+    {
+        AE_CORE_ASSERT(level < m_MipLevels, "Mip level out of range!");
+
+        uint32_t width = std::max(m_Spec.Width >> level, 1u);
+        uint32_t height = std::max(m_Spec.Height >> level, 1u);
+        AE_CORE_ASSERT(size == Utils::GetClientLevelSize(m_Spec.Format, width, height), "Data must be the entire mip level!");
+
+        NullRendererAPI::GetStats().BytesUploaded += size;
+    }
+
+    void NullTexture2D::SetMipData(uint32_t level, const StagingAllocation& staging)
+    {
+        SetMipData(level, staging.Data, (uint32_t)staging.Size);
+    }
+
+    void NullTexture2D::SetLodClamp(uint32_t baseLevel, float minLod)
+    {
+        m_BaseLevel = std::min(baseLevel, m_MipLevels - 1);
+        NullRendererAPI::GetStats().StateChanges++;
+    }
+
+    void NullTexture2D::Bind(uint32_t slot) const
+    {
+        NullRendererAPI::GetStats().StateChanges++;
+    }
+
+    NullTextureCube::NullTextureCube(const std::string& path)
+        : m_Path(path), m_RendererID(NullRendererAPI::CreateRendererID())
+    {
+        int width, height, channels;
+        stbi_set_flip_vertically_on_load(false);
+        unsigned char* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+
+        if (!data)
+        {
+            AE_CORE_ERROR("Cubemap load failed: {0}", path);
+            return;
+        }
+
+        uint32_t faceSize = width / 4;
+        m_Spec.Width = m_Spec.Height = faceSize;
+        m_Spec.Format = channels == 4 ? ImageFormat::RGBA8 : ImageFormat::RGB8;
+        m_Spec.GenerateMips = false;
+        m_IsLoaded = true;
+        NullRendererAPI::GetStats().BytesUploaded += (uint64_t)faceSize * faceSize * channels * 6;
+
+        stbi_image_free(data);
+    }
+
+    NullTextureCube::NullTextureCube(const TextureSpec& spec)
+        : m_Spec(spec), m_RendererID(NullRendererAPI::CreateRendererID())
+    {
+        AE_CORE_ASSERT(!IsCompressed(spec.Format), "Compressed cubemaps are not supported!");
+        m_Spec.Height = m_Spec.Width;
+        uint32_t fullChain = CalculateMipCount(m_Spec.Width, m_Spec.Width);
+        m_MipLevels = m_Spec.MipLevels ? std::min(m_Spec.MipLevels, fullChain) : fullChain;
+        m_IsLoaded = true;
+    }
+
+    void NullTextureCube::SetFaceData(uint32_t face, uint32_t level, const void* data, uint32_t size)
+    {
+        AE_CORE_ASSERT(face < 6 && level < m_MipLevels, "Cubemap face or level out of range!");
+
+        uint32_t faceSize = std::max(m_Spec.Width >> level, 1u);
+        AE_CORE_ASSERT(size == Utils::GetClientLevelSize(m_Spec.Format, faceSize, faceSize), "Data must be entire cubemap face!");
+
+        NullRendererAPI::GetStats().BytesUploaded += size;
+    }
+
+    void NullTextureCube::Bind(uint32_t slot) const
+    {
+        NullRendererAPI::GetStats().StateChanges++;
+    }
+}
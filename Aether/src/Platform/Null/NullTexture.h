@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Aether/Resources/Texture.h"
+
+namespace Aether {
+
+    // Images are still decoded, so load paths cost what they do with GL minus the upload itself
+    class NullTexture2D : public Texture2D
+    {
+    public:
+        NullTexture2D(const TextureSpec& spec);
+        NullTexture2D(void* data, size_t size);
+        NullTexture2D(const std::string& path, bool wrapMode = false, bool flip = true);
+
+        virtual const TextureSpec& GetSpec() const override { return m_Spec; }
+
+        virtual uint32_t GetWidth() const override { return m_Spec.Width; }
+        virtual uint32_t GetHeight() const override { return m_Spec.Height; }
+        virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+        virtual const std::string& GetPath() const override { return m_Path; }
+        virtual bool IsLoaded() const override { return m_IsLoaded; }
+
+        virtual void SetData(const void* data, uint32_t size) override;
+        virtual void Bind(uint32_t slot = 0) const override;
+
+        virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+        virtual void SetMipData(uint32_t level, const void* data, uint32_t size) override;
+        virtual void SetMipData(uint32_t level, const StagingAllocation& staging) override;
+        virtual void SetLodClamp(uint32_t baseLevel, float minLod = 0.0f) override;
+        virtual uint32_t GetBaseLevel() const override { return m_BaseLevel; }
+
+        virtual bool operator==(const Texture& other) const override
+        {
+            return m_RendererID == other.GetRendererID();
+        }
+    private:
+        TextureSpec m_Spec;
+        std::string m_Path;
+        bool m_IsLoaded = false;
+        uint32_t m_RendererID;
+        uint32_t m_MipLevels = 1;
+        uint32_t m_BaseLevel = 0;
+    };
+
+    class NullTextureCube : public TextureCube
+    {
+    public:
+        NullTextureCube(const std::string& path);
+        NullTextureCube(const TextureSpec& spec);
+
+        virtual uint32_t GetWidth() const override { return m_Spec.Width; }
+        virtual uint32_t GetHeight() const override { return m_Spec.Height; }
+        virtual uint32_t GetRendererID() const override { return m_RendererID; }
+        virtual const std::string& GetPath() const override { return m_Path; }
+
+        virtual void SetData(const void* data, uint32_t size) override { AE_CORE_ASSERT(false, "Not implemented for Cubemap!"); }
+
+        virtual void Bind(uint32_t slot = 0) const override;
+
+        virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+        virtual void SetFaceData(uint32_t face, uint32_t level, const void* data, uint32_t size) override;
+
+        virtual bool IsLoaded() const override { return m_IsLoaded; }
+
+        virtual const TextureSpec& GetSpec() const override { return m_Spec; }
+
+        virtual bool operator==(const Texture& other) const override
+        {
+            return m_RendererID == other.GetRendererID();
+        }
+    private:
+        TextureSpec m_Spec;
+        std::string m_Path;
+        bool m_IsLoaded = false;
+        uint32_t m_RendererID;
+        uint32_t m_MipLevels = 1;
+    };
+}
@@ -0,0 +1,75 @@
+#include "aepch.h"
+#include "Platform/Null/NullVertexArray.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+namespace Aether {
+
+    NullVertexArray::NullVertexArray()
+        : m_RendererID(NullRendererAPI::CreateRendererID())
+    {
+    }
+
+    void NullVertexArray::Bind() const
+    {
+        NullRendererAPI::GetStats().StateChanges++;
+    }
+
+    void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+    {
+        AddVertexBuffer(vertexBuffer, m_VertexBufferIndex);
+    }
+
+    void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t startLocation)
+    {
+        AE_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout");
+        AE_CORE_ASSERT(startLocation >= m_VertexBufferIndex, "Vertex buffer location {0} conflicts with existing location {1}", startLocation, m_VertexBufferIndex);
+
+        uint32_t index = startLocation;
+        for (const auto& element : vertexBuffer->GetLayout())
+        {
+            // Matrices take one location per column
+            if (element.Type == ShaderDataType::Mat3 || element.Type == ShaderDataType::Mat4)
+                index += element.GetComponentCount();
+            else if (element.Type != ShaderDataType::None)
+                index++;
+        }
+
+        m_VertexBufferIndex = std::max(m_VertexBufferIndex, index);
+        m_VertexBuffers.push_back(vertexBuffer);
+    }
+
+    void NullVertexArray::AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer)
+    {
+        AddInstanceBuffer(vertexBuffer, m_VertexBufferIndex);
+    }
+
+    void NullVertexArray::AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t startLocation)
+    {
+        AddVertexBuffer(vertexBuffer, startLocation);
+    }
+
+    void NullVertexArray::SetInstanceBuffer(const RingAllocation& allocation, const BufferLayout& layout, uint32_t startLocation)
+    {
+        AE_CORE_ASSERT(layout.GetElements().size(), "Instance layout is empty");
+        AE_CORE_ASSERT(startLocation == m_StreamLocation || startLocation >= m_VertexBufferIndex, "Vertex buffer location {0} conflicts with existing location {1}", startLocation, m_VertexBufferIndex);
+        AE_CORE_ASSERT(allocation, "Instance data has no ring allocation!");
+
+        uint32_t index = startLocation;
+        for (const auto& element : layout)
+        {
+            if (element.Type == ShaderDataType::Mat3 || element.Type == ShaderDataType::Mat4)
+                index += element.GetComponentCount();
+            else if (element.Type != ShaderDataType::None)
+                index++;
+        }
+
+        m_StreamLocation = startLocation;
+        m_VertexBufferIndex = std::max(m_VertexBufferIndex, index);
+        NullRendererAPI::GetStats().StateChanges++;
+    }
+
+    void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
+    {
+        m_IndexBuffer = indexBuffer;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Aether/Renderer/VertexArray.h"
+
+namespace Aether {
+
+    // Tracks attribute locations like the GL vertex array, so layout conflicts still assert
+    class NullVertexArray : public VertexArray
+    {
+    public:
+        NullVertexArray();
+
+        virtual void Bind() const override;
+        virtual void Unbind() const override {}
+
+        virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t startLocation) override;
+        virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+
+        virtual void AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t startLocation) override;
+        virtual void AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+        virtual void SetInstanceBuffer(const RingAllocation& allocation, const BufferLayout& layout, uint32_t startLocation) override;
+        virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
+
+        virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; };
+        virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; };
+    private:
+        uint32_t m_RendererID;
+        uint32_t m_VertexBufferIndex = 0;
+        uint32_t m_StreamLocation = ~0u;
+        std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+        Ref<IndexBuffer> m_IndexBuffer;
+    };
+}
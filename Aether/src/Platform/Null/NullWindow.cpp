@@ -0,0 +1,22 @@
+#include "aepch.h"
+#include "Platform/Null/NullWindow.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+namespace Aether {
+
+	NullWindow::NullWindow(const WinProps& props)
+	{
+		m_Data.Title = props.Title;
+		m_Data.Width = props.Width;
+		m_Data.Height = props.Height;
+
+		AE_CORE_INFO("Creating headless window {0} ({1}, {2})", props.Title, props.Width, props.Height);
+	}
+
+	void NullWindow::Update()
+	{
+		// Stands in for the buffer swap
+		NullRendererAPI::GetStats().Frames++;
+	}
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Aether/Core/Window.h"
+
+namespace Aether {
+
+	// Headless stand-in for GLFW_Window: a fixed-size framebuffer that never produces input events
+	class NullWindow : public Window
+	{
+	public:
+		NullWindow(const WinProps& props);
+
+		void Update() override;
+
+		unsigned int GetWidth() const override { return m_Data.Width; }
+		unsigned int GetHeight() const override { return m_Data.Height; }
+
+		unsigned int GetFramebufferWidth() const override { return m_Data.Width; }
+		unsigned int GetFramebufferHeight() const override { return m_Data.Height; }
+
+		void SetEventCallback(const EventCallbackFn& callback) override { m_Data.EventCallback = callback; }
+		void SetVSync(bool enabled) override { m_Data.VSync = enabled; }
+		bool IsVSync() const override { return m_Data.VSync; }
+
+		// No native window; platform code checks for null
+		virtual void* GetWindow() const override { return nullptr; }
+	private:
+		struct WindowData
+		{
+			std::string Title;
+			unsigned int Width, Height;
+			bool VSync = false;
+
+			EventCallbackFn EventCallback;
+		};
+
+		WindowData m_Data;
+	};
+
+}
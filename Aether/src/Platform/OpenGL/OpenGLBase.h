@@ -1,6 +1,7 @@
 #pragma once
 
 #include "aepch.h"
+#include "Aether/Renderer/RenderThread.h"
 #include <glad/glad.h>
 #include <iostream>
 
@@ -11,7 +12,9 @@
 #endif
 
 #define ASSERT(x) if (!(x)) DEBUG_BREAK();
-#define GLCall(x) GLClearError(); x; ASSERT(GLLogCall(#x, __FILE__, __LINE__));
+// The context is only current on the render thread; see RenderThread
+#define AE_GL_THREAD_ASSERT() AE_CORE_ASSERT(::Aether::RenderThread::IsRenderThread(), "OpenGL called off the render thread!")
+#define GLCall(x) AE_GL_THREAD_ASSERT(); GLClearError(); x; ASSERT(GLLogCall(#x, __FILE__, __LINE__));
 
 namespace Aether {
     
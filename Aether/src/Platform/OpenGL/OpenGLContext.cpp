@@ -1,5 +1,6 @@
 #include "aepch.h"
 #include "Platform/OpenGL/OpenGLContext.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
 
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
@@ -24,6 +25,8 @@ namespace Aether {
 		AE_CORE_INFO("  Renderer: {0}", (const char*)glGetString(GL_RENDERER));
 		AE_CORE_INFO("  Version: {0}", (const char*)glGetString(GL_VERSION));
 
+		OpenGLExtensions::Init();
+
 		AE_CORE_ASSERT((GLVersion.major == 4 && GLVersion.minor == 1), "Aether requires OpenGL version 4.1!");
 	}
 
@@ -33,4 +36,9 @@ namespace Aether {
 		glfwSwapBuffers(m_WindowHandle);
 	}
 
+	void OpenGLContext::MakeCurrent(bool current)
+	{
+		glfwMakeContextCurrent(current ? m_WindowHandle : nullptr);
+	}
+
 }
@@ -0,0 +1,69 @@
+#include "Platform/OpenGL/OpenGLExtensions.h"
+
+#include <GLFW/glfw3.h>
+
+namespace Aether {
+
+    bool OpenGLExtensions::ParallelShaderCompile = false;
+    PFNGLMAXSHADERCOMPILERTHREADSKHRPROC OpenGLExtensions::MaxShaderCompilerThreads = nullptr;
+    bool OpenGLExtensions::TextureStorage = false;
+    PFNGLTEXSTORAGE2DPROC OpenGLExtensions::TexStorage2D = nullptr;
+    bool OpenGLExtensions::PersistentMapping = false;
+    PFNGLBUFFERSTORAGEPROC OpenGLExtensions::BufferStorage = nullptr;
+    bool OpenGLExtensions::BaseInstance = false;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC OpenGLExtensions::DrawElementsInstancedBaseVertexBaseInstance = nullptr;
+    bool OpenGLExtensions::TextureCompressionS3TC = false;
+    bool OpenGLExtensions::TextureCompressionBPTC = false;
+
+    std::vector<std::string> OpenGLExtensions::s_Extensions;
+
+    void OpenGLExtensions::Init()
+    {
+        s_Extensions.clear();
+
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        s_Extensions.reserve(count);
+        for (GLint i = 0; i < count; i++)
+            s_Extensions.emplace_back((const char*)glGetStringi(GL_EXTENSIONS, i));
+
+        if (IsSupported("GL_KHR_parallel_shader_compile"))
+            MaxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+        else if (IsSupported("GL_ARB_parallel_shader_compile"))
+            MaxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glfwGetProcAddress("glMaxShaderCompilerThreadsARB");
+
+        ParallelShaderCompile = MaxShaderCompilerThreads != nullptr;
+        if (ParallelShaderCompile)
+        {
+            // 0xFFFFFFFF lets the driver pick its own thread count
+            MaxShaderCompilerThreads(0xFFFFFFFF);
+        }
+
+        GLint major = 0, minor = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        if (major > 4 || (major == 4 && minor >= 2) || IsSupported("GL_ARB_texture_storage"))
+            TexStorage2D = (PFNGLTEXSTORAGE2DPROC)glfwGetProcAddress("glTexStorage2D");
+        TextureStorage = TexStorage2D != nullptr;
+
+        if (major > 4 || (major == 4 && minor >= 4) || IsSupported("GL_ARB_buffer_storage"))
+            BufferStorage = (PFNGLBUFFERSTORAGEPROC)glfwGetProcAddress("glBufferStorage");
+        PersistentMapping = BufferStorage != nullptr;
+
+        if (major > 4 || (major == 4 && minor >= 2) || IsSupported("GL_ARB_base_instance"))
+            DrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glfwGetProcAddress("glDrawElementsInstancedBaseVertexBaseInstance");
+        BaseInstance = DrawElementsInstancedBaseVertexBaseInstance != nullptr;
+
+        TextureCompressionS3TC = IsSupported("GL_EXT_texture_compression_s3tc");
+        TextureCompressionBPTC = major > 4 || (major == 4 && minor >= 2) || IsSupported("GL_ARB_texture_compression_bptc");
+
+        AE_CORE_INFO("  Extensions: {0}, parallel shader compile: {1}, texture storage: {2}, buffer storage: {3}, base instance: {4}", count,
+            ParallelShaderCompile ? "yes" : "no", TextureStorage ? "yes" : "no", PersistentMapping ? "yes" : "no", BaseInstance ? "yes" : "no");
+        AE_CORE_INFO("  Texture compression: S3TC {0}, BPTC {1}", TextureCompressionS3TC ? "yes" : "no", TextureCompressionBPTC ? "yes" : "no");
+    }
+
+    bool OpenGLExtensions::IsSupported(const std::string& name)
+    {
+        return std::find(s_Extensions.begin(), s_Extensions.end(), name) != s_Extensions.end();
+    }
+}
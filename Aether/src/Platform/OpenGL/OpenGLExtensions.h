@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Platform/OpenGL/OpenGLBase.h"
+
+// glad is generated for the 4.1 core profile, so tokens from newer versions
+// and optional extensions are declared here and loaded at context creation.
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+    #define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+    #define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+    #define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+    #define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+    #define GL_MAP_COHERENT_BIT 0x0080
+#endif
+
+namespace Aether {
+
+    typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+    typedef void (APIENTRYP PFNGLTEXSTORAGE2DPROC)(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+    typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+    typedef void (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance);
+
+    class OpenGLExtensions
+    {
+    public:
+        static void Init();
+        static bool IsSupported(const std::string& name);
+
+        // GL_KHR_parallel_shader_compile / GL_ARB_parallel_shader_compile
+        static bool ParallelShaderCompile;
+        static PFNGLMAXSHADERCOMPILERTHREADSKHRPROC MaxShaderCompilerThreads;
+
+        // GL 4.2 / GL_ARB_texture_storage: immutable mip chains
+        static bool TextureStorage;
+        static PFNGLTEXSTORAGE2DPROC TexStorage2D;
+
+        // GL 4.4 / GL_ARB_buffer_storage: persistently mapped buffers
+        static bool PersistentMapping;
+        static PFNGLBUFFERSTORAGEPROC BufferStorage;
+
+        // GL 4.2 / GL_ARB_base_instance: instanced attributes start at an offset per draw
+        static bool BaseInstance;
+        static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC DrawElementsInstancedBaseVertexBaseInstance;
+
+        // GL_EXT_texture_compression_s3tc (BC1/BC3) and GL 4.2 / GL_ARB_texture_compression_bptc (BC7).
+        // BC5 (RGTC) is core since 3.0.
+        static bool TextureCompressionS3TC;
+        static bool TextureCompressionBPTC;
+
+    private:
+        static std::vector<std::string> s_Extensions;
+    };
+}
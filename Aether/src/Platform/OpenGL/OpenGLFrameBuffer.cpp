@@ -67,6 +67,18 @@ namespace Aether {
 			glFramebufferTexture2D(GL_FRAMEBUFFER, attachmentType, TextureTarget(multisampled), id, 0);
 		}
 
+		static void AttachDepthTextureArray(uint32_t id, GLenum format, GLenum attachmentType, uint32_t width, uint32_t height, uint32_t layers)
+		{
+			glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, format, width, height, layers, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr);
+
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+			glFramebufferTextureLayer(GL_FRAMEBUFFER, attachmentType, id, 0, 0);
+		}
+
 		static bool IsDepthFormat(FramebufferTextureFormat format)
 		{
 			switch (format)
@@ -108,6 +120,7 @@ namespace Aether {
 
 	OpenGLFrameBuffer::~OpenGLFrameBuffer()
 	{
+		AE_GL_THREAD_ASSERT();
 		glDeleteFramebuffers(1, &m_RendererID);
 		glDeleteTextures(m_ColorAttachments.size(), m_ColorAttachments.data());
 		glDeleteTextures(1, &m_DepthAttachment);
@@ -116,7 +129,7 @@ namespace Aether {
     void OpenGLFrameBuffer::BindDepthTexture(uint32_t slot) const
     {
         glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, m_DepthAttachment);
+        glBindTexture(m_Specification.Layers > 0 ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D, m_DepthAttachment);
     }
 
 	void OpenGLFrameBuffer::BindColorTexture(uint32_t slot, uint32_t index) const
@@ -128,6 +141,7 @@ namespace Aether {
 
 	void OpenGLFrameBuffer::Invalidate()
 	{
+		AE_GL_THREAD_ASSERT();
 		if (m_RendererID)
 		{
 			glDeleteFramebuffers(1, &m_RendererID);
@@ -172,12 +186,21 @@ namespace Aether {
 
 		if (m_DepthAttachmentSpecification.TextureFormat != FramebufferTextureFormat::None)
 		{
+			bool layered = m_Specification.Layers > 0;
+			AE_CORE_ASSERT(!layered || !multisample, "Layered depth can't be multisampled!");
+
 			Utils::CreateTextures(multisample, &m_DepthAttachment, 1);
-			Utils::BindTexture(multisample, m_DepthAttachment);
+			if (layered)
+				glBindTexture(GL_TEXTURE_2D_ARRAY, m_DepthAttachment);
+			else
+				Utils::BindTexture(multisample, m_DepthAttachment);
 			switch (m_DepthAttachmentSpecification.TextureFormat)
 			{
 				case FramebufferTextureFormat::DEPTH24STENCIL8:
-					Utils::AttachDepthTexture(m_DepthAttachment, m_Specification.Samples, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL_ATTACHMENT, m_Specification.Width, m_Specification.Height);
+					if (layered)
+						Utils::AttachDepthTextureArray(m_DepthAttachment, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL_ATTACHMENT, m_Specification.Width, m_Specification.Height, m_Specification.Layers);
+					else
+						Utils::AttachDepthTexture(m_DepthAttachment, m_Specification.Samples, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL_ATTACHMENT, m_Specification.Width, m_Specification.Height);
 					break;
                 case FramebufferTextureFormat::RGBA8:
 				case FramebufferTextureFormat::RGBA16F:
@@ -206,6 +229,7 @@ namespace Aether {
 
 	void OpenGLFrameBuffer::Bind()
 	{
+		AE_GL_THREAD_ASSERT();
 		glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
 		glViewport(0, 0, m_Specification.Width, m_Specification.Height);
 	}
@@ -222,6 +246,9 @@ namespace Aether {
 			AE_CORE_WARN("Attempted to rezize framebuffer to {0}, {1}", width, height);
 			return;
 		}
+		if (width == m_Specification.Width && height == m_Specification.Height)
+			return;
+
 		m_Specification.Width = width;
 		m_Specification.Height = height;
 		
@@ -245,6 +272,19 @@ namespace Aether {
 		return pixelData;
 	}
 
+	void OpenGLFrameBuffer::SetDepthLayer(uint32_t layer)
+	{
+		AE_CORE_ASSERT(layer < m_Specification.Layers, "Depth layer out of range!");
+
+		GLint lastDrawFramebuffer;
+		glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &lastDrawFramebuffer);
+
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_RendererID);
+		glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, m_DepthAttachment, 0, layer);
+
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, lastDrawFramebuffer);
+	}
+
 	void OpenGLFrameBuffer::ClearAttachment(uint32_t attachmentIndex, int value)
 	{
 		AE_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "attachmentIndex out of range!");
@@ -20,6 +20,7 @@ namespace Aether {
 		virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) override;
 
 		virtual void ClearAttachment(uint32_t attachmentIndex, int value) override;
+		virtual void SetDepthLayer(uint32_t layer) override;
 
         virtual void BindDepthTexture(uint32_t slot = 0) const override;
 		virtual void BindColorTexture(uint32_t slot = 0, uint32_t index = 0) const override;
@@ -1,6 +1,7 @@
 #include "aepch.h"
 #include "OpenGLRendererAPI.h"
-#include <glad/glad.h>
+#include "Platform/OpenGL/OpenGLBase.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
 
 namespace Aether 
 {
@@ -12,10 +13,13 @@ namespace Aether
 
 		glEnable(GL_DEPTH_TEST);
 		glEnable(GL_LINE_SMOOTH);
+		// Filter across cubemap face edges; prefiltered environment mips need it
+		glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 	}
 
 	void OpenGLRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 	{
+		AE_GL_THREAD_ASSERT();
 		glViewport(x, y, width, height);
 	}
 
@@ -26,21 +30,25 @@ namespace Aether
     }
 
     void OpenGLRendererAPI::SetClearColor(const glm::vec4& color) {
+        AE_GL_THREAD_ASSERT();
         glClearColor(color.r, color.g, color.b, color.a);
     }
 
 	void OpenGLRendererAPI::DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, void* indices, int32_t baseVertex)
 	{
+		AE_GL_THREAD_ASSERT();
 		vertexArray->Bind();
 		glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, indices, baseVertex);
 	}
 
     void OpenGLRendererAPI::Clear() {
+        AE_GL_THREAD_ASSERT();
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
 
 	void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
 	{
+		AE_GL_THREAD_ASSERT();
 		vertexArray->Bind();
 		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
 		glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
@@ -48,19 +56,63 @@ namespace Aether
 
 	void OpenGLRendererAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount)
 	{
+		AE_GL_THREAD_ASSERT();
 		vertexArray->Bind();
 		glDrawArrays(GL_LINES, 0, vertexCount);
 	}
 
 	void OpenGLRendererAPI::DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount)
     {
+        AE_GL_THREAD_ASSERT();
         vertexArray->Bind();
 		uint32_t count = vertexArray->GetIndexBuffer()->GetCount();
         glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount);
     }
 
+	void OpenGLRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseIndex, int32_t baseVertex, uint32_t instanceCount, uint32_t baseInstance)
+	{
+		AE_GL_THREAD_ASSERT();
+		vertexArray->Bind();
+		const void* indices = (const void*)((uintptr_t)baseIndex * sizeof(uint32_t));
+		if (baseInstance)
+		{
+			AE_CORE_ASSERT(OpenGLExtensions::BaseInstance, "Base instance drawing is not supported!");
+			OpenGLExtensions::DrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, indices, instanceCount, baseVertex, baseInstance);
+		}
+		else
+		{
+			glDrawElementsInstancedBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, indices, instanceCount, baseVertex);
+		}
+	}
+
+	bool OpenGLRendererAPI::SupportsBaseInstance() const
+	{
+		return OpenGLExtensions::BaseInstance;
+	}
+
 	void OpenGLRendererAPI::SetLineWidth(float width)
 	{
 		glLineWidth(width);
 	}
+
+	uint64_t OpenGLRendererAPI::InsertFence()
+	{
+		AE_GL_THREAD_ASSERT();
+		return (uint64_t)(uintptr_t)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	void OpenGLRendererAPI::WaitFence(uint64_t fence)
+	{
+		AE_GL_THREAD_ASSERT();
+		if (!fence)
+			return;
+
+		GLsync sync = (GLsync)(uintptr_t)fence;
+		GLenum result;
+		do
+		{
+			result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+		} while (result == GL_TIMEOUT_EXPIRED);
+		glDeleteSync(sync);
+	}
 }
\ No newline at end of file
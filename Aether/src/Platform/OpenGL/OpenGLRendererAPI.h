@@ -18,7 +18,12 @@ namespace Aether {
 		virtual void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount) override;
 		virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) override;
 		void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, void* indices, int32_t baseVertex) override;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseIndex, int32_t baseVertex, uint32_t instanceCount, uint32_t baseInstance) override;
+		virtual bool SupportsBaseInstance() const override;
 
 		virtual void SetLineWidth(float width) override;
+
+		virtual uint64_t InsertFence() override;
+		virtual void WaitFence(uint64_t fence) override;
 	};
 }
@@ -0,0 +1,91 @@
+#include "aepch.h"
+#include "Platform/OpenGL/OpenGLRingBuffer.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
+#include "Aether/Renderer/Renderer.h"
+
+namespace Aether {
+
+	// Keeps every frame region aligned for any uniform or vertex offset
+	static constexpr uint64_t s_RegionAlignment = 256;
+
+	OpenGLRingBuffer::OpenGLRingBuffer(uint64_t frameSize)
+		: m_FrameSize((frameSize + s_RegionAlignment - 1) & ~(s_RegionAlignment - 1))
+	{
+		GLint uniformAlignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+		if (uniformAlignment > 0)
+			m_UniformAlignment = (uint64_t)uniformAlignment;
+
+		uint64_t size = m_FrameSize * Renderer::FramesInFlight;
+
+		// The copy-write target leaves vertex array and uniform bindings alone
+		GLCall(glGenBuffers(1, &m_RendererID));
+		GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID));
+		if (OpenGLExtensions::PersistentMapping)
+		{
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			GLCall(OpenGLExtensions::BufferStorage(GL_COPY_WRITE_BUFFER, (GLsizeiptr)size, nullptr, flags));
+			m_Mapped = (uint8_t*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, (GLsizeiptr)size, flags);
+			AE_CORE_ASSERT(m_Mapped, "Failed to map the ring buffer!");
+		}
+		else
+		{
+			GLCall(glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)size, nullptr, GL_STREAM_DRAW));
+			m_Shadow.resize(size);
+		}
+		GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
+	}
+
+	OpenGLRingBuffer::~OpenGLRingBuffer()
+	{
+		if (m_Mapped)
+		{
+			GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID));
+			glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+			GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
+		}
+		GLCall(glDeleteBuffers(1, &m_RendererID));
+	}
+
+	RingAllocation OpenGLRingBuffer::Allocate(uint64_t size, uint64_t alignment)
+	{
+		AE_CORE_ASSERT(alignment && (alignment & (alignment - 1)) == 0, "Ring buffer alignment must be a power of two!");
+
+		uint64_t frame = RenderThread::GetReplayFrameIndex();
+		if (frame != m_Frame)
+		{
+			m_Frame = frame;
+			m_Head = 0;
+		}
+
+		uint64_t offset = (m_Head + alignment - 1) & ~(alignment - 1);
+		if (size == 0 || offset + size > m_FrameSize)
+			return {};
+		m_Head = offset + size;
+
+		offset += (frame % Renderer::FramesInFlight) * m_FrameSize;
+
+		RingAllocation allocation;
+		allocation.Data = (m_Mapped ? m_Mapped : m_Shadow.data()) + offset;
+		allocation.BufferID = m_RendererID;
+		allocation.Offset = offset;
+		allocation.Size = size;
+		return allocation;
+	}
+
+	void OpenGLRingBuffer::Commit(const RingAllocation& allocation)
+	{
+		if (m_Mapped || !allocation)
+			return;
+
+		GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID));
+		GLCall(glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)allocation.Offset, (GLsizeiptr)allocation.Size, allocation.Data));
+		GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
+	}
+
+	void OpenGLRingBuffer::BindUniform(uint32_t binding, const RingAllocation& allocation)
+	{
+		AE_CORE_ASSERT(allocation.Offset % m_UniformAlignment == 0, "Uniform range is not aligned to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT!");
+		GLCall(glBindBufferRange(GL_UNIFORM_BUFFER, binding, m_RendererID, (GLintptr)allocation.Offset, (GLsizeiptr)allocation.Size));
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Aether/Renderer/RingBuffer.h"
+#include "OpenGLBase.h"
+
+namespace Aether {
+
+	// Persistent, coherent mapping when GL_ARB_buffer_storage is there. Otherwise writes land in
+	// a client-side copy and Commit() uploads each range with glBufferSubData.
+	class OpenGLRingBuffer : public RingBuffer
+	{
+	public:
+		OpenGLRingBuffer(uint64_t frameSize);
+		virtual ~OpenGLRingBuffer();
+
+		virtual RingAllocation Allocate(uint64_t size, uint64_t alignment) override;
+		virtual void Commit(const RingAllocation& allocation) override;
+		virtual void BindUniform(uint32_t binding, const RingAllocation& allocation) override;
+
+		virtual uint64_t GetFrameCapacity() const override { return m_FrameSize; }
+		virtual uint64_t GetUniformAlignment() const override { return m_UniformAlignment; }
+	private:
+		uint32_t m_RendererID = 0;
+		uint8_t* m_Mapped = nullptr;
+		std::vector<uint8_t> m_Shadow;
+		uint64_t m_FrameSize = 0;
+		uint64_t m_UniformAlignment = 256;
+
+		uint64_t m_Frame = ~0ull;
+		uint64_t m_Head = 0;
+	};
+}
@@ -1,4 +1,6 @@
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
+#include "Aether/Resources/ShaderPreprocessor.h"
 #include <glm/gtc/type_ptr.hpp>
 
 namespace Aether {
@@ -6,21 +8,87 @@ namespace Aether {
     OpenGLShader::OpenGLShader(const std::string& filepath)
         : m_FilePath(filepath), m_RendererID(0)
     {
-        ShaderProgramSource source = ParseShader(filepath);
-        m_RendererID = CreateShader(source.VertexSource, source.FragmentSource, source.GeometrySource);
+        Compile();
     }
 
     OpenGLShader::~OpenGLShader()
     {
+        for (const auto& stage : m_PendingStages)
+        {
+            GLCall(glDeleteShader(stage.ID));
+        }
+        if (m_PendingProgram)
+        {
+            GLCall(glDeleteProgram(m_PendingProgram));
+        }
         GLCall(glDeleteProgram(m_RendererID));
     }
 
+    void OpenGLShader::Compile()
+    {
+        ShaderProgramSource source = ShaderPreprocessor::Process(m_FilePath);
+        m_PendingSourceFiles = std::move(source.SourceFiles);
+        if (m_SourceFiles.empty())
+            m_SourceFiles = m_PendingSourceFiles;
+
+        m_PendingProgram = CreateShader(source.VertexSource, source.FragmentSource, source.GeometrySource);
+    }
+
+    void OpenGLShader::Reload()
+    {
+        // A reload superseding one still in flight: drop the stale one
+        if (m_PendingProgram)
+        {
+            for (const auto& stage : m_PendingStages)
+            {
+                GLCall(glDeleteShader(stage.ID));
+            }
+            m_PendingStages.clear();
+            GLCall(glDeleteProgram(m_PendingProgram));
+            m_PendingProgram = 0;
+        }
+
+        Compile();
+    }
+
 
     void OpenGLShader::Bind() const
     {
+        // With nothing to fall back on we have to wait for the first compile
+        if (m_PendingProgram)
+        {
+            if (m_RendererID == 0)
+                FinalizeProgram();
+            else
+                PollPending();
+        }
+
         GLCall(glUseProgram(m_RendererID));
     }
 
+    bool OpenGLShader::IsReady() const
+    {
+        if (m_PendingProgram)
+            PollPending();
+
+        return m_RendererID != 0;
+    }
+
+    bool OpenGLShader::PollPending() const
+    {
+        if (OpenGLExtensions::ParallelShaderCompile)
+        {
+            int completed = GL_FALSE;
+            GLCall(glGetProgramiv(m_PendingProgram, GL_COMPLETION_STATUS_KHR, &completed));
+            if (completed == GL_FALSE)
+                return false;
+        }
+
+        // Without the extension there is no way to poll, so finish the compile here
+        FinalizeProgram();
+        return true;
+    }
+
     void OpenGLShader::Unbind() const
     {
         GLCall(glUseProgram(0));
@@ -70,40 +138,6 @@ namespace Aether {
         return location;
     }
 
-    ShaderProgramSource OpenGLShader::ParseShader(const std::string& filepath)
-    {
-        std::ifstream stream(filepath);
-
-        enum class ShaderType
-        {
-            NONE = -1, VERTEX = 0, FRAGMENT = 1, GEOMETRY = 2
-        };
-
-        std::string line;
-        std::stringstream ss[3]; 
-        ShaderType type = ShaderType::NONE;
-
-        while (getline(stream, line))
-        {
-            if (line.find("#shader") != std::string::npos)
-            {
-                if (line.find("vertex") != std::string::npos)
-                    type = ShaderType::VERTEX;
-                else if (line.find("fragment") != std::string::npos)
-                    type = ShaderType::FRAGMENT;
-                else if (line.find("geometry") != std::string::npos)
-                    type = ShaderType::GEOMETRY;
-            }
-            else
-            {
-                if (type != ShaderType::NONE)
-                    ss[(int)type] << line << '\n';
-            }
-        }
-
-        return { ss[0].str(), ss[1].str(), ss[2].str() };
-    }
-
     unsigned int OpenGLShader::CompileShader(unsigned int type, const std::string& source)
     {
         unsigned int id;
@@ -112,28 +146,8 @@ namespace Aether {
         GLCall(glShaderSource(id, 1, &src, nullptr));
         GLCall(glCompileShader(id));
 
-        int result;
-        GLCall(glGetShaderiv(id, GL_COMPILE_STATUS, &result));
-        if (result == GL_FALSE)
-        {
-            int length;
-            GLCall(glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length));
-            
-            std::vector<char> message(length);
-            GLCall(glGetShaderInfoLog(id, length, &length, message.data()));
-            
-            std::string shaderType;
-            if (type == GL_VERTEX_SHADER) shaderType = "Vertex";
-            else if (type == GL_FRAGMENT_SHADER) shaderType = "Fragment";
-            else if (type == GL_GEOMETRY_SHADER) shaderType = "Geometry";
-
-            AE_CORE_ERROR("Failed to compile {0} shader!", shaderType);
-            AE_CORE_ERROR("{0}", message.data());
-            
-            GLCall(glDeleteShader(id));
-            return 0;
-        }
-
+        // Status is not queried here: doing so would block until the driver finishes
+        m_PendingStages.push_back({ type, id });
         return id;
     }
 
@@ -152,17 +166,74 @@ namespace Aether {
 
         GLCall(glAttachShader(program, vs));
         GLCall(glAttachShader(program, fs));
-        if (hasGeometry && gs != 0) {GLCall(glAttachShader(program, gs));}
+        if (hasGeometry) {GLCall(glAttachShader(program, gs));}
 
+        // Linking is queued behind the compiles; results are collected in FinalizeProgram
         GLCall(glLinkProgram(program));
-        GLCall(glValidateProgram(program));
-
-        GLCall(glDeleteShader(vs));
-        GLCall(glDeleteShader(fs));
-        if (hasGeometry && gs != 0) 
-            GLCall(glDeleteShader(gs));
 
         return program;
     }
 
+    void OpenGLShader::FinalizeProgram() const
+    {
+        bool compiled = true;
+        for (const auto& stage : m_PendingStages)
+        {
+            int result;
+            GLCall(glGetShaderiv(stage.ID, GL_COMPILE_STATUS, &result));
+            if (result == GL_FALSE)
+            {
+                int length;
+                GLCall(glGetShaderiv(stage.ID, GL_INFO_LOG_LENGTH, &length));
+                
+                std::vector<char> message(length + 1, '\0');
+                GLCall(glGetShaderInfoLog(stage.ID, length, &length, message.data()));
+                
+                std::string shaderType;
+                if (stage.Type == GL_VERTEX_SHADER) shaderType = "Vertex";
+                else if (stage.Type == GL_FRAGMENT_SHADER) shaderType = "Fragment";
+                else if (stage.Type == GL_GEOMETRY_SHADER) shaderType = "Geometry";
+
+                AE_CORE_ERROR("Failed to compile {0} shader! ({1})", shaderType, m_FilePath);
+                AE_CORE_ERROR("{0}", ShaderPreprocessor::ResolveErrorLog(message.data(), m_PendingSourceFiles));
+                compiled = false;
+            }
+        }
+
+        int linked = GL_FALSE;
+        GLCall(glGetProgramiv(m_PendingProgram, GL_LINK_STATUS, &linked));
+        if (compiled && linked == GL_FALSE)
+        {
+            int length;
+            GLCall(glGetProgramiv(m_PendingProgram, GL_INFO_LOG_LENGTH, &length));
+
+            std::vector<char> message(length + 1, '\0');
+            GLCall(glGetProgramInfoLog(m_PendingProgram, length, &length, message.data()));
+
+            AE_CORE_ERROR("Failed to link shader program! ({0})", m_FilePath);
+            AE_CORE_ERROR("{0}", ShaderPreprocessor::ResolveErrorLog(message.data(), m_PendingSourceFiles));
+        }
+
+        for (const auto& stage : m_PendingStages)
+        {
+            GLCall(glDetachShader(m_PendingProgram, stage.ID));
+            GLCall(glDeleteShader(stage.ID));
+        }
+        m_PendingStages.clear();
+
+        if (compiled && linked == GL_TRUE)
+        {
+            GLCall(glDeleteProgram(m_RendererID));
+            m_RendererID = m_PendingProgram;
+            m_UniformLocationCache.clear();
+            m_SourceFiles = m_PendingSourceFiles;
+        }
+        else
+        {
+            // A broken edit keeps the last working program bound
+            GLCall(glDeleteProgram(m_PendingProgram));
+        }
+        m_PendingProgram = 0;
+    }
+
 }
\ No newline at end of file
@@ -12,6 +12,12 @@ namespace Aether {
         virtual void Bind() const override;
         virtual void Unbind() const override;
 
+        virtual bool IsReady() const override;
+        virtual void Reload() override;
+
+        virtual const std::string& GetPath() const override { return m_FilePath; }
+        virtual const std::vector<std::string>& GetSourceFiles() const override { return m_SourceFiles; }
+
         virtual void SetInt(const std::string& name, int value) override;
         virtual void SetIntArray(const std::string& name,const int* values, uint32_t count) override; 
         virtual void SetFloat(const std::string& name, float value) override;
@@ -20,13 +26,29 @@ namespace Aether {
         virtual void SetMat4(const std::string& name, const glm::mat4& value) override;
 
     private:
+        struct PendingStage
+        {
+            unsigned int Type;
+            unsigned int ID;
+        };
+
         std::string m_FilePath;
-        unsigned int m_RendererID;  
-        std::unordered_map<std::string, int> m_UniformLocationCache;
+
+        // The active program keeps serving draws until a reload has linked successfully
+        mutable unsigned int m_RendererID;
+        mutable std::vector<std::string> m_SourceFiles;
+        mutable std::unordered_map<std::string, int> m_UniformLocationCache;
+
+        // Compile/link results are only queried once the driver reports completion
+        mutable unsigned int m_PendingProgram = 0;
+        mutable std::vector<PendingStage> m_PendingStages;
+        mutable std::vector<std::string> m_PendingSourceFiles;
 
         int GetUniformLocation(const std::string& name);
+        void Compile();
         unsigned int CompileShader(unsigned int type, const std::string& source);
         unsigned int CreateShader(const std::string& vertexShader, const std::string& fragmentShader, const std::string& geometryShader);
-        ShaderProgramSource ParseShader(const std::string& filepath);
+        bool PollPending() const;
+        void FinalizeProgram() const;
     };
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "aepch.h"
+#include "Platform/OpenGL/OpenGLStagingBuffer.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
+
+namespace Aether {
+
+	// Keeps every block usable as a pixel-unpack offset for any format
+	static constexpr uint64_t s_Alignment = 256;
+
+	OpenGLStagingBuffer::OpenGLStagingBuffer(uint64_t size)
+		: m_Capacity(size)
+	{
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		GLCall(glGenBuffers(1, &m_RendererID));
+		GLCall(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_RendererID));
+		GLCall(OpenGLExtensions::BufferStorage(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)size, nullptr, flags));
+		m_Mapped = (uint8_t*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)size, flags);
+		GLCall(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+
+		AE_CORE_ASSERT(m_Mapped, "Failed to map the staging buffer!");
+	}
+
+	OpenGLStagingBuffer::~OpenGLStagingBuffer()
+	{
+		for (auto& block : m_Blocks)
+		{
+			if (block.Fence)
+				glDeleteSync(block.Fence);
+		}
+
+		GLCall(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_RendererID));
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		GLCall(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+		GLCall(glDeleteBuffers(1, &m_RendererID));
+	}
+
+	StagingAllocation OpenGLStagingBuffer::Allocate(uint64_t requested)
+	{
+		uint64_t size = (requested + s_Alignment - 1) & ~(s_Alignment - 1);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (!m_Mapped || size == 0 || size >= m_Capacity)
+			return {};
+
+		uint64_t offset;
+		if (m_Blocks.empty())
+		{
+			offset = 0;
+		}
+		else
+		{
+			// Head never catches up with the tail exactly, so head == tail always means empty
+			uint64_t tail = m_Blocks.front().Offset;
+			if (m_Head >= tail)
+			{
+				if (m_Head + size <= m_Capacity)
+					offset = m_Head;
+				else if (size < tail)
+					offset = 0;
+				else
+					return {};
+			}
+			else
+			{
+				if (m_Head + size < tail)
+					offset = m_Head;
+				else
+					return {};
+			}
+		}
+
+		m_Blocks.push_back({ offset, size, nullptr });
+		m_Head = offset + size;
+
+		StagingAllocation allocation;
+		allocation.Data = m_Mapped + offset;
+		allocation.BufferID = m_RendererID;
+		allocation.Offset = offset;
+		allocation.Size = requested;
+		allocation.Block = offset;
+		return allocation;
+	}
+
+	void OpenGLStagingBuffer::Release(const StagingAllocation& allocation)
+	{
+		if (!allocation)
+			return;
+
+		GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		for (auto& block : m_Blocks)
+		{
+			if (block.Offset == allocation.Block && !block.Fence)
+			{
+				block.Fence = fence;
+				return;
+			}
+		}
+
+		AE_CORE_ASSERT(false, "Releasing an unknown staging block!");
+		glDeleteSync(fence);
+	}
+
+	void OpenGLStagingBuffer::Reclaim()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		while (!m_Blocks.empty() && m_Blocks.front().Fence)
+		{
+			GLenum status = glClientWaitSync(m_Blocks.front().Fence, 0, 0);
+			if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+				break;
+
+			glDeleteSync(m_Blocks.front().Fence);
+			m_Blocks.pop_front();
+		}
+
+		if (m_Blocks.empty())
+			m_Head = 0;
+	}
+}
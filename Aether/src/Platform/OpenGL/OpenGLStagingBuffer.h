@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Aether/Renderer/StagingBuffer.h"
+#include "OpenGLBase.h"
+
+#include <deque>
+#include <mutex>
+
+namespace Aether {
+
+	class OpenGLStagingBuffer : public StagingBuffer
+	{
+	public:
+		OpenGLStagingBuffer(uint64_t size);
+		virtual ~OpenGLStagingBuffer();
+
+		virtual StagingAllocation Allocate(uint64_t size) override;
+		virtual void Release(const StagingAllocation& allocation) override;
+		virtual void Reclaim() override;
+
+		virtual uint64_t GetCapacity() const override { return m_Capacity; }
+	private:
+		struct Block
+		{
+			uint64_t Offset = 0;
+			uint64_t Size = 0;
+			GLsync Fence = nullptr;
+		};
+
+		uint32_t m_RendererID = 0;
+		uint8_t* m_Mapped = nullptr;
+		uint64_t m_Capacity = 0;
+
+		// Live blocks in allocation order; the front one is the oldest
+		std::deque<Block> m_Blocks;
+		uint64_t m_Head = 0;
+		std::mutex m_Mutex;
+	};
+}
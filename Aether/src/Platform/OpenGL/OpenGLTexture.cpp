@@ -1,4 +1,6 @@
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
+#include "Aether/Renderer/StagingBuffer.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
@@ -13,6 +15,11 @@ namespace Aether {
 				case ImageFormat::RGBA8: return GL_RGBA;
                 case ImageFormat::RGBA16F: return GL_RGBA;
                 case ImageFormat::RGBA32F: return GL_RGBA;
+                // Compressed uploads take the internal format only
+                case ImageFormat::BC1:
+                case ImageFormat::BC3:
+                case ImageFormat::BC5:
+                case ImageFormat::BC7:     return GL_RGBA;
 			}
 
 			AE_CORE_ASSERT(false, "Unknown ImageFormat GL type!");
@@ -28,11 +35,27 @@ namespace Aether {
                 case ImageFormat::RGBA8: return GL_RGBA8;
                 case ImageFormat::RGBA16F: return GL_RGBA16F;
                 case ImageFormat::RGBA32F: return GL_RGBA32F;
+                case ImageFormat::BC1:     return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+                case ImageFormat::BC3:     return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+                case ImageFormat::BC5:     return GL_COMPRESSED_RG_RGTC2;
+                case ImageFormat::BC7:     return GL_COMPRESSED_RGBA_BPTC_UNORM;
 			}
 
 			AE_CORE_ASSERT(false, "Unknown ImageFormat GL internal type!");
 			return 0;
 		}
+
+        // Client-side layout: float formats are uploaded as 32-bit floats whatever the internal precision
+        static void GetUploadFormat(GLenum dataFormat, GLenum internalFormat, GLenum& type, uint32_t& bpp)
+        {
+            type = GL_UNSIGNED_BYTE;
+            bpp = dataFormat == GL_RGBA ? 4 : dataFormat == GL_RGB ? 3 : 0;
+            if (internalFormat == GL_RGBA16F || internalFormat == GL_RGBA32F)
+            {
+                type = GL_FLOAT;
+                bpp *= sizeof(float);
+            }
+        }
     }
 
     //texture
@@ -48,9 +71,57 @@ namespace Aether {
 
         GLCall(glGenTextures(1, &m_RendererID));
         GLCall(glBindTexture(GL_TEXTURE_2D, m_RendererID));
-        glTexImage2D(GL_TEXTURE_2D, 0, m_InternalFormat, m_Width, m_Height, 0, m_DataFormat, dataType, nullptr);
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        bool compressed = IsCompressed(m_Spec.Format);
+        AE_CORE_ASSERT(!compressed || IsFormatSupported(m_Spec.Format), "Compressed format not supported by this GPU!");
+
+        if (m_Spec.Streamed)
+        {
+            m_MipLevels = m_Spec.MipLevels ? std::min(m_Spec.MipLevels, CalculateMipCount(m_Width, m_Height)) : CalculateMipCount(m_Width, m_Height);
+            if (OpenGLExtensions::TextureStorage)
+            {
+                GLCall(OpenGLExtensions::TexStorage2D(GL_TEXTURE_2D, m_MipLevels, m_InternalFormat, m_Width, m_Height));
+            }
+            else
+            {
+                for (uint32_t level = 0; level < m_MipLevels; level++)
+                {
+                    uint32_t width = std::max(m_Width >> level, 1u);
+                    uint32_t height = std::max(m_Height >> level, 1u);
+                    if (compressed)
+                        glCompressedTexImage2D(GL_TEXTURE_2D, level, m_InternalFormat, width, height, 0, (GLsizei)CalculateLevelSize(m_Spec.Format, width, height), nullptr);
+                    else
+                        glTexImage2D(GL_TEXTURE_2D, level, m_InternalFormat, width, height, 0, m_DataFormat, dataType, nullptr);
+                }
+            }
+
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, m_MipLevels - 1);
+            // Nothing is resident yet
+            SetLodClamp(m_MipLevels - 1);
+        }
+        else if (compressed)
+        {
+            // No GPU mip generation for block formats; cook the chain with TextureCooker instead
+            m_Spec.GenerateMips = false;
+            glCompressedTexImage2D(GL_TEXTURE_2D, 0, m_InternalFormat, m_Width, m_Height, 0, (GLsizei)CalculateLevelSize(m_Spec.Format, m_Width, m_Height), nullptr);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        }
+        else
+        {
+            glTexImage2D(GL_TEXTURE_2D, 0, m_InternalFormat, m_Width, m_Height, 0, m_DataFormat, dataType, nullptr);
+            if (m_Spec.GenerateMips)
+            {
+                // Allocates the chain now so the texture is complete; SetData() regenerates it
+                m_MipLevels = CalculateMipCount(m_Width, m_Height);
+                GLCall(glGenerateMipmap(GL_TEXTURE_2D));
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            }
+            else
+            {
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            }
+        }
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, glWrapMode);
@@ -112,6 +183,7 @@ namespace Aether {
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
             glGenerateMipmap(GL_TEXTURE_2D);
+            m_MipLevels = CalculateMipCount(m_Width, m_Height);
 
            
             stbi_image_free(pixelData);
@@ -163,6 +235,12 @@ namespace Aether {
             m_Width = width;
             m_Height = height;
 
+            m_Spec.Width = m_Width;
+            m_Spec.Height = m_Height;
+            m_Spec.Format = isHDR ? ImageFormat::RGBA16F : (m_InternalFormat == GL_RGB8 ? ImageFormat::RGB8 : ImageFormat::RGBA8);
+            m_Spec.GenerateMips = false;
+            m_Spec.WrapMode = wrapMode;
+
             GLCall(glGenTextures(1, &m_RendererID));
             GLCall(glBindTexture(GL_TEXTURE_2D, m_RendererID));
 
@@ -186,22 +264,82 @@ namespace Aether {
 
 	void OpenGLTexture2D::SetData(const void* data, uint32_t size)
     {
-        GLenum type = GL_UNSIGNED_BYTE;
-        uint32_t bpp = 0;
-        
-        if (m_DataFormat == GL_RGBA) bpp = 4;
-        else if (m_DataFormat == GL_RGB) bpp = 3;
-
-        if (m_InternalFormat == GL_RGBA16F || m_InternalFormat == GL_RGBA32F)
+        if (IsCompressed(m_Spec.Format))
         {
-            type = GL_FLOAT;
-            bpp *= sizeof(float); 
+            SetMipData(0, data, size);
+            return;
         }
 
+        GLenum type;
+        uint32_t bpp;
+        Utils::GetUploadFormat(m_DataFormat, m_InternalFormat, type, bpp);
+
         AE_CORE_ASSERT(size == m_Width * m_Height * bpp, "Data must be entire texture!");
         
         glBindTexture(GL_TEXTURE_2D, m_RendererID);
         glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_Width, m_Height, m_DataFormat, type, data);
+
+        if (m_Spec.GenerateMips && !m_Spec.Streamed)
+        {
+            GLCall(glGenerateMipmap(GL_TEXTURE_2D));
+        }
+    }
+
+    void OpenGLTexture2D::SetMipData(uint32_t level, const void* data, uint32_t size)
+    {
+        AE_CORE_ASSERT(level < m_MipLevels, "Mip level out of range!");
+
+        uint32_t width = std::max(m_Width >> level, 1u);
+        uint32_t height = std::max(m_Height >> level, 1u);
+
+        if (IsCompressed(m_Spec.Format))
+        {
+            AE_CORE_ASSERT(size == CalculateLevelSize(m_Spec.Format, width, height), "Data must be the entire mip level!");
+            glBindTexture(GL_TEXTURE_2D, m_RendererID);
+            GLCall(glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, m_InternalFormat, size, data));
+            return;
+        }
+
+        GLenum type;
+        uint32_t bpp;
+        Utils::GetUploadFormat(m_DataFormat, m_InternalFormat, type, bpp);
+
+        AE_CORE_ASSERT(size == width * height * bpp, "Data must be the entire mip level!");
+
+        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+        // Small levels of RGB8 rows aren't 4-byte aligned
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        GLCall(glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, m_DataFormat, type, data));
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    void OpenGLTexture2D::SetMipData(uint32_t level, const StagingAllocation& staging)
+    {
+        // With a pixel-unpack buffer bound, the data pointer is an offset into it
+        GLCall(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging.BufferID));
+        SetMipData(level, (const void*)(uintptr_t)staging.Offset, (uint32_t)staging.Size);
+        GLCall(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+    }
+
+    bool OpenGLTexture2D::IsFormatSupported(ImageFormat format)
+    {
+        switch (format)
+        {
+            case ImageFormat::BC1:
+            case ImageFormat::BC3: return OpenGLExtensions::TextureCompressionS3TC;
+            case ImageFormat::BC7: return OpenGLExtensions::TextureCompressionBPTC;
+            case ImageFormat::None: return false;
+            default:               return true;
+        }
+    }
+
+    void OpenGLTexture2D::SetLodClamp(uint32_t baseLevel, float minLod)
+    {
+        m_BaseLevel = std::min(baseLevel, m_MipLevels - 1);
+
+        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, m_BaseLevel);
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_LOD, minLod);
     }
 
 	void OpenGLTexture2D::Bind(uint32_t slot) const
@@ -247,39 +385,25 @@ namespace Aether {
             { GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, 3, 1 }   
         };
 
-        std::vector<unsigned char> faceData(faceSize * faceSize * channels);
+        // Faces are read in place from the cross: the row length is the whole image and the skip
+        // offsets select the face, so nothing is copied on the CPU
+        GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        GLCall(glPixelStorei(GL_UNPACK_ROW_LENGTH, width));
 
         for (int i = 0; i < 6; i++)
         {
             const auto& f = faces[i];
-            
-            for (int y = 0; y < faceSize; y++)
-            {
-                for (int x = 0; x < faceSize; x++)
-                {
-                    int srcX = f.gridX * faceSize + x;
-                    int srcY = f.gridY * faceSize + y;
-                    
-                    int srcIdx = (srcY * width + srcX) * channels;
-                    int dstIdx = (y * faceSize + x) * channels;
-                    
-                    memcpy(&faceData[dstIdx], &data[srcIdx], channels);
-                }
-            }
 
-            glTexImage2D(
-                f.target,
-                0,
-                format,
-                faceSize,
-                faceSize,
-                0,
-                format,
-                GL_UNSIGNED_BYTE,
-                faceData.data()
-            );
+            GLCall(glPixelStorei(GL_UNPACK_SKIP_PIXELS, f.gridX * faceSize));
+            GLCall(glPixelStorei(GL_UNPACK_SKIP_ROWS, f.gridY * faceSize));
+            GLCall(glTexImage2D(f.target, 0, format, faceSize, faceSize, 0, format, GL_UNSIGNED_BYTE, data));
         }
 
+        GLCall(glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0));
+        GLCall(glPixelStorei(GL_UNPACK_SKIP_ROWS, 0));
+        GLCall(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+        GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
         stbi_image_free(data);
 
         glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -295,11 +419,61 @@ namespace Aether {
         AE_CORE_INFO("Cubemap loaded successfully!");
     }
 
+    OpenGLTextureCube::OpenGLTextureCube(const TextureSpec& spec)
+        : m_Width(spec.Width), m_Height(spec.Width), m_Spec(spec)
+    {
+        AE_CORE_ASSERT(!IsCompressed(spec.Format), "Compressed cubemaps are not supported!");
+        m_Spec.Height = m_Spec.Width;
+        m_InternalFormat = Utils::ImageFormatToGLInternalFormat(m_Spec.Format);
+        m_DataFormat = Utils::ImageFormatToGLDataFormat(m_Spec.Format);
+        m_MipLevels = m_Spec.MipLevels ? std::min(m_Spec.MipLevels, CalculateMipCount(m_Width, m_Width)) : CalculateMipCount(m_Width, m_Width);
+
+        GLenum type;
+        uint32_t bpp;
+        Utils::GetUploadFormat(m_DataFormat, m_InternalFormat, type, bpp);
+
+        GLCall(glGenTextures(1, &m_RendererID));
+        GLCall(glBindTexture(GL_TEXTURE_CUBE_MAP, m_RendererID));
+
+        for (uint32_t level = 0; level < m_MipLevels; level++)
+        {
+            uint32_t size = std::max(m_Width >> level, 1u);
+            for (uint32_t face = 0; face < 6; face++)
+                glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, m_InternalFormat, size, size, 0, m_DataFormat, type, nullptr);
+        }
+
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, m_MipLevels - 1);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, m_MipLevels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+
+        m_IsLoaded = true;
+    }
+
     OpenGLTextureCube::~OpenGLTextureCube()
     {
         GLCall(glDeleteTextures(1, &m_RendererID));
     }
 
+    void OpenGLTextureCube::SetFaceData(uint32_t face, uint32_t level, const void* data, uint32_t size)
+    {
+        AE_CORE_ASSERT(face < 6 && level < m_MipLevels, "Cubemap face or level out of range!");
+
+        GLenum type;
+        uint32_t bpp;
+        Utils::GetUploadFormat(m_DataFormat, m_InternalFormat, type, bpp);
+
+        uint32_t faceSize = std::max(m_Width >> level, 1u);
+        AE_CORE_ASSERT(size == faceSize * faceSize * bpp, "Data must be entire cubemap face!");
+
+        GLCall(glBindTexture(GL_TEXTURE_CUBE_MAP, m_RendererID));
+        GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        GLCall(glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, 0, 0, faceSize, faceSize, m_DataFormat, type, data));
+        GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+    }
+
     void OpenGLTextureCube::Bind(uint32_t slot) const
     {
         GLCall(glActiveTexture(GL_TEXTURE0 + slot));
@@ -24,6 +24,14 @@ namespace Aether {
         virtual void SetData(const void* data, uint32_t size) override;
         virtual void Bind(uint32_t slot = 0) const override;
 
+        virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+        virtual void SetMipData(uint32_t level, const void* data, uint32_t size) override;
+        virtual void SetMipData(uint32_t level, const StagingAllocation& staging) override;
+        virtual void SetLodClamp(uint32_t baseLevel, float minLod = 0.0f) override;
+        virtual uint32_t GetBaseLevel() const override { return m_BaseLevel; }
+
+        static bool IsFormatSupported(ImageFormat format);
+
         virtual bool operator==(const Texture& other) const override
 		{
 			return m_RendererID == other.GetRendererID();
@@ -35,6 +43,8 @@ namespace Aether {
 		uint32_t m_Width, m_Height;
 		uint32_t m_RendererID;
 		GLenum m_InternalFormat, m_DataFormat;
+		uint32_t m_MipLevels = 1;
+		uint32_t m_BaseLevel = 0;
     };
 
     // Thêm vào OpenGLTexture.h
@@ -43,6 +53,7 @@ namespace Aether {
     {
     public:
         OpenGLTextureCube(const std::string& path);
+        OpenGLTextureCube(const TextureSpec& spec);
         virtual ~OpenGLTextureCube();
 
         // Triển khai các hàm từ class cha Texture
@@ -56,6 +67,9 @@ namespace Aether {
 
         virtual void Bind(uint32_t slot = 0) const override;
 
+        virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+        virtual void SetFaceData(uint32_t face, uint32_t level, const void* data, uint32_t size) override;
+
         virtual bool IsLoaded() const override { return m_IsLoaded; }
 
         virtual const TextureSpec& GetSpec() const override { return m_Spec; } // Trả về spec dummy hoặc lưu spec nếu cần
@@ -71,5 +85,7 @@ namespace Aether {
         uint32_t m_Width, m_Height; // Kích thước của 1 mặt (Face)
         bool m_IsLoaded = false;
         TextureSpec m_Spec; // Để thỏa mãn interface
+        GLenum m_InternalFormat = GL_RGB8, m_DataFormat = GL_RGB;
+        uint32_t m_MipLevels = 1;
     };
 }
\ No newline at end of file
@@ -4,6 +4,7 @@ namespace Aether {
 
 	OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t size, uint32_t binding)
 	{
+		AE_GL_THREAD_ASSERT();
 		glGenBuffers(1, &m_RendererID);
 		glBindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
         glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
@@ -13,11 +14,13 @@ namespace Aether {
 
 	OpenGLUniformBuffer::~OpenGLUniformBuffer()
 	{
+		AE_GL_THREAD_ASSERT();
 		glDeleteBuffers(1, &m_RendererID);
 	}
 
 	void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
 	{
+		AE_GL_THREAD_ASSERT();
 		glBindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
         glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
         glBindBuffer(GL_UNIFORM_BUFFER, 0);
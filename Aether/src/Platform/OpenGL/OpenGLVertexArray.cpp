@@ -23,50 +23,19 @@ namespace Aether {
 		return 0;
 	}
 
-    OpenGLVertexArray::OpenGLVertexArray()
-    {
-        GLCall(glGenVertexArrays(1, &m_RendererID));
-    }
-
-    OpenGLVertexArray::~OpenGLVertexArray()
-    {
-        GLCall(glDeleteBuffers(1, &m_RendererID));
-    }
-
-    void OpenGLVertexArray::Bind() const 
-    {
-        GLCall(glBindVertexArray(m_RendererID));
-    }
-
-    void OpenGLVertexArray::Unbind() const
-    {
-        GLCall(glBindVertexArray(0));
-    }
-
-    void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
-    {
-        AddVertexBuffer(vertexBuffer, m_VertexBufferIndex);
-    }
-
-    void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t startLocation)
+    // Points the layout's attributes at `offset` bytes into the buffer bound to GL_ARRAY_BUFFER.
+    // Returns the location after the last one used.
+    static uint32_t SetAttributePointers(const BufferLayout& layout, uint32_t startLocation, uint32_t divisor, uint64_t offset)
     {
-        AE_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout");
-        AE_CORE_ASSERT(startLocation >= m_VertexBufferIndex, "Vertex buffer location {0} conflicts with existing location {1}", startLocation, m_VertexBufferIndex);
-
-        GLCall(glBindVertexArray(m_RendererID));
-        vertexBuffer->Bind();
-
         uint32_t index = startLocation;
-
-        const auto& layout = vertexBuffer->GetLayout();
-        for(const auto& element : layout)
+        for (const auto& element : layout)
         {
-            switch(element.Type)
+            switch (element.Type)
             {
-                case ShaderDataType::Float:  
-                case ShaderDataType::Float2: 
-                case ShaderDataType::Float3: 
-                case ShaderDataType::Float4: 
+                case ShaderDataType::Float:
+                case ShaderDataType::Float2:
+                case ShaderDataType::Float3:
+                case ShaderDataType::Float4:
                 {
                     GLCall(glEnableVertexAttribArray(index));
                     GLCall(glVertexAttribPointer(
@@ -75,16 +44,17 @@ namespace Aether {
                         ShaderDataTypeToOpenGLBaseType(element.Type),
                         element.Normalized ? GL_TRUE : GL_FALSE,
                         layout.GetStride(),
-                        (const void*)element.Offset
+                        (const void*)(offset + element.Offset)
                     ));
+                    GLCall(glVertexAttribDivisor(index, divisor));
                     index++;
                     break;
                 }
-                case ShaderDataType::Int:    
-                case ShaderDataType::Int2:   
-                case ShaderDataType::Int3:  
-                case ShaderDataType::Int4:  
-                case ShaderDataType::Bool:  
+                case ShaderDataType::Int:
+                case ShaderDataType::Int2:
+                case ShaderDataType::Int3:
+                case ShaderDataType::Int4:
+                case ShaderDataType::Bool:
                 {
                     GLCall(glEnableVertexAttribArray(index));
                     GLCall(glVertexAttribIPointer(
@@ -92,33 +62,72 @@ namespace Aether {
                         element.GetComponentCount(),
                         ShaderDataTypeToOpenGLBaseType(element.Type),
                         layout.GetStride(),
-                        (const void*)element.Offset
+                        (const void*)(offset + element.Offset)
                     ));
+                    GLCall(glVertexAttribDivisor(index, divisor));
                     index++;
                     break;
                 }
-                case ShaderDataType::Mat3:  
+                case ShaderDataType::Mat3:
                 case ShaderDataType::Mat4:
                 {
                     uint32_t count = element.GetComponentCount();
                     for (uint32_t i = 0; i < count; i++)
                     {
                         GLCall(glEnableVertexAttribArray(index));
-                        GLCall(glVertexAttribPointer(index,
+                        GLCall(glVertexAttribPointer(
+                            index,
                             count,
                             ShaderDataTypeToOpenGLBaseType(element.Type),
                             element.Normalized ? GL_TRUE : GL_FALSE,
                             layout.GetStride(),
-                            (const void*)(element.Offset + sizeof(float) * count * i)
+                            (const void*)(offset + element.Offset + sizeof(float) * count * i)
                         ));
-                        glVertexAttribDivisor(index, 0);
+                        GLCall(glVertexAttribDivisor(index, divisor));
                         index++;
                     }
                     break;
-                } 
+                }
                 case ShaderDataType::None: break;
             }
         }
+        return index;
+    }
+
+    OpenGLVertexArray::OpenGLVertexArray()
+    {
+        GLCall(glGenVertexArrays(1, &m_RendererID));
+    }
+
+    OpenGLVertexArray::~OpenGLVertexArray()
+    {
+        GLCall(glDeleteBuffers(1, &m_RendererID));
+    }
+
+    void OpenGLVertexArray::Bind() const 
+    {
+        GLCall(glBindVertexArray(m_RendererID));
+    }
+
+    void OpenGLVertexArray::Unbind() const
+    {
+        GLCall(glBindVertexArray(0));
+    }
+
+    void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+    {
+        AddVertexBuffer(vertexBuffer, m_VertexBufferIndex);
+    }
+
+    void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t startLocation)
+    {
+        AE_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout");
+        AE_CORE_ASSERT(startLocation >= m_VertexBufferIndex, "Vertex buffer location {0} conflicts with existing location {1}", startLocation, m_VertexBufferIndex);
+
+        GLCall(glBindVertexArray(m_RendererID));
+        vertexBuffer->Bind();
+
+        uint32_t index = SetAttributePointers(vertexBuffer->GetLayout(), startLocation, 0, 0);
         m_VertexBufferIndex = std::max(m_VertexBufferIndex, index);
         m_VertexBuffers.push_back(vertexBuffer);
     }
@@ -136,76 +145,24 @@ namespace Aether {
         GLCall(glBindVertexArray(m_RendererID));
         vertexBuffer->Bind();
 
-        const auto& layout = vertexBuffer->GetLayout();
-        uint32_t index = startLocation;
-
-        for (const auto& element : layout)
-        {
-            switch (element.Type)
-            {
-                case ShaderDataType::Float:
-                case ShaderDataType::Float2:
-                case ShaderDataType::Float3:
-                case ShaderDataType::Float4:
-                {
-                    GLCall(glEnableVertexAttribArray(index));
-                    GLCall(glVertexAttribPointer(
-                        index,
-                        element.GetComponentCount(),
-                        ShaderDataTypeToOpenGLBaseType(element.Type),
-                        element.Normalized ? GL_TRUE : GL_FALSE,
-                        layout.GetStride(),
-                        (const void*)element.Offset
-                    ));
-                    GLCall(glVertexAttribDivisor(index, 1)); 
-                    index++;
-                    break;
-                }
-                case ShaderDataType::Int:
-                case ShaderDataType::Int2:
-                case ShaderDataType::Int3:
-                case ShaderDataType::Int4:
-                case ShaderDataType::Bool:
-                {
-                    GLCall(glEnableVertexAttribArray(index));
-                    GLCall(glVertexAttribIPointer(
-                        index,
-                        element.GetComponentCount(),
-                        ShaderDataTypeToOpenGLBaseType(element.Type),
-                        layout.GetStride(),
-                        (const void*)element.Offset
-                    ));
-                    GLCall(glVertexAttribDivisor(index, 1));
-                    index++;
-                    break;
-                }
-                case ShaderDataType::Mat3:
-                case ShaderDataType::Mat4:
-                {
-                    uint32_t count = element.GetComponentCount();
-                    for (uint32_t i = 0; i < count; i++)
-                    {
-                        GLCall(glEnableVertexAttribArray(index));
-                        GLCall(glVertexAttribPointer(
-                            index,
-                            count,
-                            ShaderDataTypeToOpenGLBaseType(element.Type),
-                            element.Normalized ? GL_TRUE : GL_FALSE,
-                            layout.GetStride(),
-                            (const void*)(element.Offset + sizeof(float) * count * i)
-                        ));
-                        GLCall(glVertexAttribDivisor(index, 1));
-                        index++;
-                    }
-                    break;
-                }
-                case ShaderDataType::None: break;
-            }
-        }
+        uint32_t index = SetAttributePointers(vertexBuffer->GetLayout(), startLocation, 1, 0);
         m_VertexBufferIndex = std::max(m_VertexBufferIndex, index);
         m_VertexBuffers.push_back(vertexBuffer);
     }
 
+    void OpenGLVertexArray::SetInstanceBuffer(const RingAllocation& allocation, const BufferLayout& layout, uint32_t startLocation)
+    {
+        AE_CORE_ASSERT(layout.GetElements().size(), "Instance layout is empty");
+        AE_CORE_ASSERT(startLocation == m_StreamLocation || startLocation >= m_VertexBufferIndex, "Vertex buffer location {0} conflicts with existing location {1}", startLocation, m_VertexBufferIndex);
+
+        GLCall(glBindVertexArray(m_RendererID));
+        GLCall(glBindBuffer(GL_ARRAY_BUFFER, allocation.BufferID));
+
+        uint32_t index = SetAttributePointers(layout, startLocation, 1, allocation.Offset);
+        m_StreamLocation = startLocation;
+        m_VertexBufferIndex = std::max(m_VertexBufferIndex, index);
+    }
+
     void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
     {
         GLCall(glBindVertexArray(m_RendererID));
@@ -18,6 +18,7 @@ namespace Aether {
 
         virtual void AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer, uint32_t startLocation) override;
         virtual void AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+        virtual void SetInstanceBuffer(const RingAllocation& allocation, const BufferLayout& layout, uint32_t startLocation) override;
         virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
 
         virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; };
@@ -27,6 +28,7 @@ namespace Aether {
     private:
 		uint32_t m_RendererID;
 		uint32_t m_VertexBufferIndex = 0;
+		uint32_t m_StreamLocation = ~0u;
 		std::vector<Ref<VertexBuffer>> m_VertexBuffers;
 		Ref<IndexBuffer> m_IndexBuffer;
     };
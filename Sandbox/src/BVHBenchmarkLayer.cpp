@@ -0,0 +1,255 @@
+#include "BVHBenchmarkLayer.h"
+#include "Aether/Core/JobSystem.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <chrono>
+#include <random>
+
+namespace {
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double MillisecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // Brute force gets fewer queries at large sizes so a run stays within seconds; results are per query
+    uint32_t BruteQueryCount(uint32_t objectCount)
+    {
+        return std::max(10u, std::min(1000u, 100000000u / objectCount));
+    }
+}
+
+BVHBenchmarkLayer::BVHBenchmarkLayer()
+    : Layer("BVH Benchmark")
+{
+    // CPU only
+    m_RenderThreadSafe = true;
+}
+
+void BVHBenchmarkLayer::Attach()
+{
+    ImGuiContext* ctx = Aether::ImGuiLayer::GetContext();
+    if (ctx) ImGui::SetCurrentContext(ctx);
+
+    Run();
+}
+
+void BVHBenchmarkLayer::Run()
+{
+    if (m_Running.exchange(true))
+        return;
+
+    Aether::JobSystem::SubmitJob([this]()
+    {
+        for (uint32_t count : { 10000u, 100000u, 1000000u })
+        {
+            Result result = RunSize(count);
+            AE_INFO("BVH {0} objects: build {1:.2f} ms (brute {2:.2f}), refit {3:.2f} ms (brute {4:.2f}), height {5}, area ratio {6:.1f}",
+                count, result.TreeBuild, result.BruteBuild, result.TreeRefit, result.BruteRefit, result.Height, result.AreaRatio);
+            AE_INFO("BVH {0} objects, us/query: frustum {1:.1f} (brute {2:.1f}), ray {3:.2f} (brute {4:.1f}), box {5:.2f} (brute {6:.1f}), sphere {7:.2f} (brute {8:.1f})",
+                count, result.TreeFrustum, result.BruteFrustum, result.TreeRay, result.BruteRay,
+                result.TreeOverlap, result.BruteOverlap, result.TreeSphere, result.BruteSphere);
+
+            std::lock_guard<std::mutex> lock(m_ResultMutex);
+            m_Results.push_back(result);
+        }
+        m_Running = false;
+    });
+}
+
+BVHBenchmarkLayer::Result BVHBenchmarkLayer::RunSize(uint32_t objectCount)
+{
+    Result result = {};
+    result.ObjectCount = objectCount;
+
+    // A city-like spread: wide and shallow, with mostly small objects
+    std::mt19937 rng(objectCount);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    float worldSize = 5.0f * std::sqrt((float)objectCount);
+
+    std::vector<Aether::AABB> boxes(objectCount);
+    for (auto& box : boxes)
+    {
+        glm::vec3 center(unit(rng) * worldSize, unit(rng) * 20.0f, unit(rng) * worldSize);
+        glm::vec3 extent = glm::vec3(1.0f + unit(rng) * 0.5f, 1.0f + unit(rng) * 0.9f, 1.0f + unit(rng) * 0.5f);
+        box = { center - extent, center + extent };
+    }
+
+    // Build
+    Aether::AABBTree tree;
+    std::vector<int32_t> proxies;
+    auto start = Clock::now();
+    tree.Build(boxes, proxies);
+    result.TreeBuild = MillisecondsSince(start);
+
+    Aether::FrustumCuller brute;
+    start = Clock::now();
+    brute.Reserve(objectCount);
+    for (const auto& box : boxes)
+        brute.Add(box.Min, box.Max);
+    result.BruteBuild = MillisecondsSince(start);
+
+    // Refit after every object moved a little
+    for (auto& box : boxes)
+    {
+        glm::vec3 offset(unit(rng), unit(rng) * 0.2f, unit(rng));
+        box.Min += offset;
+        box.Max += offset;
+    }
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < objectCount; i++)
+        tree.SetProxyBounds(proxies[i], boxes[i]);
+    tree.Refit();
+    result.TreeRefit = MillisecondsSince(start);
+
+    start = Clock::now();
+    for (uint32_t i = 0; i < objectCount; i++)
+        brute.Set(i, boxes[i].Min, boxes[i].Max);
+    result.BruteRefit = MillisecondsSince(start);
+
+    result.Height = tree.GetHeight();
+    result.AreaRatio = tree.GetAreaRatio();
+
+    // Queries from random points inside the world
+    constexpr uint32_t treeQueries = 1000;
+    uint32_t bruteQueries = BruteQueryCount(objectCount);
+    auto randomPoint = [&]() { return glm::vec3(unit(rng) * worldSize, 10.0f, unit(rng) * worldSize); };
+
+    std::vector<Aether::Frustum> frustums(20);
+    glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 300.0f);
+    for (auto& frustum : frustums)
+    {
+        glm::vec3 eye = randomPoint();
+        frustum = Aether::Frustum::FromViewProjection(projection * glm::lookAt(eye, eye + glm::vec3(unit(rng), -0.2f, unit(rng)), glm::vec3(0.0f, 1.0f, 0.0f)));
+    }
+
+    uint64_t treeVisible = 0, bruteVisible = 0;
+    start = Clock::now();
+    for (const auto& frustum : frustums)
+        tree.QueryFrustum(frustum, [&](uint32_t) { treeVisible++; });
+    result.TreeFrustum = MillisecondsSince(start) * 1000.0 / frustums.size();
+
+    std::vector<uint32_t> visible;
+    start = Clock::now();
+    for (const auto& frustum : frustums)
+    {
+        brute.Cull(frustum, visible);
+        bruteVisible += visible.size();
+    }
+    result.BruteFrustum = MillisecondsSince(start) * 1000.0 / frustums.size();
+
+    if (treeVisible != bruteVisible)
+        AE_WARN("BVH benchmark: frustum results differ ({0} vs {1})", treeVisible, bruteVisible);
+
+    std::vector<Aether::Ray> rays(treeQueries);
+    for (auto& ray : rays)
+        ray = { randomPoint(), glm::normalize(glm::vec3(unit(rng), unit(rng) * 0.3f, unit(rng))) };
+
+    Aether::RayHit hit;
+    start = Clock::now();
+    for (const auto& ray : rays)
+        tree.RayCast(ray, 1000.0f, hit);
+    result.TreeRay = MillisecondsSince(start) * 1000.0 / treeQueries;
+
+    start = Clock::now();
+    for (uint32_t q = 0; q < bruteQueries; q++)
+    {
+        glm::vec3 invDirection = 1.0f / rays[q].Direction;
+        float closest = 1000.0f;
+        for (const auto& box : boxes)
+        {
+            float distance;
+            if (Aether::Ray::Intersects(box, rays[q].Origin, invDirection, closest, distance))
+                closest = distance;
+        }
+    }
+    result.BruteRay = MillisecondsSince(start) * 1000.0 / bruteQueries;
+
+    std::vector<Aether::AABB> regions(treeQueries);
+    for (auto& region : regions)
+    {
+        glm::vec3 center = randomPoint();
+        region = { center - glm::vec3(10.0f), center + glm::vec3(10.0f) };
+    }
+
+    uint64_t overlaps = 0;
+    start = Clock::now();
+    for (const auto& region : regions)
+        tree.QueryOverlap(region, [&](uint32_t) { overlaps++; });
+    result.TreeOverlap = MillisecondsSince(start) * 1000.0 / treeQueries;
+
+    start = Clock::now();
+    for (uint32_t q = 0; q < bruteQueries; q++)
+    {
+        for (const auto& box : boxes)
+            overlaps += box.Overlaps(regions[q]) ? 1 : 0;
+    }
+    result.BruteOverlap = MillisecondsSince(start) * 1000.0 / bruteQueries;
+
+    start = Clock::now();
+    for (const auto& region : regions)
+        tree.QuerySphere((region.Min + region.Max) * 0.5f, 10.0f, [&](uint32_t) { overlaps++; });
+    result.TreeSphere = MillisecondsSince(start) * 1000.0 / treeQueries;
+
+    start = Clock::now();
+    for (uint32_t q = 0; q < bruteQueries; q++)
+    {
+        glm::vec3 center = (regions[q].Min + regions[q].Max) * 0.5f;
+        for (const auto& box : boxes)
+            overlaps += box.OverlapsSphere(center, 10.0f) ? 1 : 0;
+    }
+    result.BruteSphere = MillisecondsSince(start) * 1000.0 / bruteQueries;
+
+    // Keeps the brute force loops from being optimized away
+    AE_TRACE("BVH benchmark: {0} overlaps", overlaps);
+    return result;
+}
+
+void BVHBenchmarkLayer::OnImGuiRender()
+{
+    ImGui::Begin("BVH Benchmark");
+
+    if (m_Running)
+        ImGui::Text("Running...");
+    else if (ImGui::Button("Run Again"))
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_ResultMutex);
+            m_Results.clear();
+        }
+        Run();
+    }
+
+    std::lock_guard<std::mutex> lock(m_ResultMutex);
+    if (ImGui::BeginTable("Results", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Objects");
+        ImGui::TableSetupColumn("Operation");
+        ImGui::TableSetupColumn("Tree");
+        ImGui::TableSetupColumn("Brute Force");
+        ImGui::TableHeadersRow();
+
+        for (const auto& result : m_Results)
+        {
+            auto row = [&](const char* name, double tree, double brute, const char* unit)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%u", result.ObjectCount);
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(name);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f %s", tree, unit);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f %s", brute, unit);
+            };
+            row("Build", result.TreeBuild, result.BruteBuild, "ms");
+            row("Refit", result.TreeRefit, result.BruteRefit, "ms");
+            row("Frustum", result.TreeFrustum, result.BruteFrustum, "us");
+            row("Ray", result.TreeRay, result.BruteRay, "us");
+            row("Box", result.TreeOverlap, result.BruteOverlap, "us");
+            row("Sphere", result.TreeSphere, result.BruteSphere, "us");
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
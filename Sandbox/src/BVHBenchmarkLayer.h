@@ -0,0 +1,40 @@
+#pragma once
+#include <Aether.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Times AABBTree build, refit and queries against brute force over the same random boxes.
+// Runs on a worker so the window stays responsive; results are logged and shown in a table.
+class BVHBenchmarkLayer : public Aether::Layer
+{
+public:
+    BVHBenchmarkLayer();
+    virtual ~BVHBenchmarkLayer() = default;
+
+    virtual void Attach() override;
+    virtual void OnImGuiRender() override;
+
+private:
+    struct Result
+    {
+        uint32_t ObjectCount;
+        // Milliseconds for build / refit, microseconds per query
+        double TreeBuild, BruteBuild;
+        double TreeRefit, BruteRefit;
+        double TreeFrustum, BruteFrustum;
+        double TreeRay, BruteRay;
+        double TreeOverlap, BruteOverlap;
+        double TreeSphere, BruteSphere;
+        int32_t Height;
+        float AreaRatio;
+    };
+
+    void Run();
+    static Result RunSize(uint32_t objectCount);
+
+private:
+    std::vector<Result> m_Results;
+    std::mutex m_ResultMutex;
+    std::atomic<bool> m_Running = false;
+};
@@ -3,25 +3,29 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <cstdlib>
 
-Aether::UUID id_ShaderLighting = Aether::AssetsRegister::Register("Shader_Lighting");
-Aether::UUID id_ShaderShadow = Aether::AssetsRegister::Register("Shader_Shadow");
-Aether::UUID id_ShaderLUT = Aether::AssetsRegister::Register("Shader_LUT");
-Aether::UUID id_ShaderSkybox = Aether::AssetsRegister::Register("Shader_Skybox");
+static constexpr Aether::UUID id_ShaderLighting = Aether::AssetsRegister::Get("Shader_Lighting");
+static constexpr Aether::UUID id_ShaderShadow = Aether::AssetsRegister::Get("Shader_Shadow");
+static constexpr Aether::UUID id_ShaderLUT = Aether::AssetsRegister::Get("Shader_LUT");
+static constexpr Aether::UUID id_ShaderSkybox = Aether::AssetsRegister::Get("Shader_Skybox");
 
-Aether::UUID id_TexWood = Aether::AssetsRegister::Register("Tex_Wood");
-Aether::UUID id_TexLUT = Aether::AssetsRegister::Register("Tex_LUT");
+static constexpr Aether::UUID id_TexWood = Aether::AssetsRegister::Get("Tex_Wood");
+static constexpr Aether::UUID id_TexLUT = Aether::AssetsRegister::Get("Tex_LUT");
 
-Aether::UUID id_ShadowMaterial = Aether::AssetsRegister::Register("Material_Shadow");
-Aether::UUID id_LightingMaterial = Aether::AssetsRegister::Register("Material_Lighting");   
-Aether::UUID id_LUTMaterial = Aether::AssetsRegister::Register("Material_LUT");
+static constexpr Aether::UUID id_ShadowMaterial = Aether::AssetsRegister::Get("Material_Shadow");
+static constexpr Aether::UUID id_LightingMaterial = Aether::AssetsRegister::Get("Material_Lighting");
+static constexpr Aether::UUID id_LUTMaterial = Aether::AssetsRegister::Get("Material_LUT");
 
-Aether::UUID id_CubeMesh = Aether::AssetsRegister::Register("Mesh_Cube");
-Aether::UUID id_ScreenQuadMesh = Aether::AssetsRegister::Register("Mesh_ScreenQuad");
-Aether::UUID id_SkyboxMesh = Aether::AssetsRegister::Register("Mesh_Skybox");
+static constexpr Aether::UUID id_CubeMesh = Aether::AssetsRegister::Get("Mesh_Cube");
+static constexpr Aether::UUID id_ScreenQuadMesh = Aether::AssetsRegister::Get("Mesh_ScreenQuad");
+static constexpr Aether::UUID id_SkyboxMesh = Aether::AssetsRegister::Get("Mesh_Skybox");
+
+// Depth bias for cascades, in shadow texels; enough for the 3x3 PCF on surfaces sloped away from the light
+static constexpr float s_CascadeBiasTexels = 8.0f;
 
 DemoLayer::DemoLayer()
     : Layer("Spotlight Shadow Demo")
 {
+    m_RenderThreadSafe = true;
     m_EditorCamera = Aether::EditorCamera(45.0f, 1.778f, 0.1f, 1000.0f);
 }
 
@@ -89,43 +93,30 @@ void DemoLayer::Attach()
 
     Aether::MeshLibrary::Load(Aether::MeshSpec{{Aether::VertexStream{vertices, 24, Aether::MeshLayout::Phong()}}, indices, 36}, id_CubeMesh);
 
-    // Camera uniform buffer
-    uint32_t uboSize = sizeof(glm::mat4) * 2 + sizeof(glm::vec4);
-    m_CameraUBO = Aether::UniformBuffer::Create(uboSize, 0);
-
     // Subsystems
     InitSkybox();
     InitScreenQuad();
 
-    // Framebuffers
-    Aether::FramebufferSpecification fbSpec;
-    fbSpec.Width = m_ShadowMapResolution;
-    fbSpec.Height = m_ShadowMapResolution;
-    fbSpec.Attachments = { Aether::FramebufferTextureFormat::DEPTH24STENCIL8 };
-    m_ShadowFBO = Aether::FrameBuffer::Create(fbSpec);
-
-    Aether::FramebufferSpecification sceneFbSpec;
-    sceneFbSpec.Width = Aether::Application::Get().GetWindow().GetWidth();
-    sceneFbSpec.Height = Aether::Application::Get().GetWindow().GetHeight();
-    sceneFbSpec.Attachments = { 
-        Aether::FramebufferTextureFormat::RGBA8, 
-        Aether::FramebufferTextureFormat::DEPTH24STENCIL8 
-    };
-    m_SceneFBO = Aether::FrameBuffer::Create(sceneFbSpec);
+    // Targets are declared per frame in Update(); the graph binds and clears them
+    m_RenderGraph.AddPass("Shadow",
+        [](Aether::RenderGraph::Builder& builder) { builder.Write("ShadowMap"); },
+        [this](const Aether::RenderGraph::Resources& resources) { RenderShadowPass(resources); });
+    m_RenderGraph.AddPass("Main",
+        [](Aether::RenderGraph::Builder& builder) { builder.Read("ShadowMap"); builder.Write("Scene"); },
+        [this](const Aether::RenderGraph::Resources& resources) { RenderMainPass(resources); });
+    m_RenderGraph.AddPass("ColorGrading",
+        [](Aether::RenderGraph::Builder& builder) { builder.Read("Scene"); builder.Write(Aether::RenderGraph::Backbuffer); },
+        [this](const Aether::RenderGraph::Resources& resources) { RenderColorGradingPass(resources); });
 
     AE_CORE_INFO("DemoLayer initialized successfully!");
 }
 
 void DemoLayer::Detach()
 {
-    m_ShadowFBO.reset();
-    m_CameraUBO.reset();
-    m_InstanceVBO.reset();
-    
     m_SkyboxShader.reset();
     m_SkyboxTexture.reset();
-    
-    m_SceneFBO.reset();
+
+    m_RenderGraph = Aether::RenderGraph();
 }
 
 
@@ -137,28 +128,239 @@ void DemoLayer::Update(Aether::Timestep ts)
     
     m_EditorCamera.Update(ts);
 
-    // ===== SHADOW PASS =====
-    glm::mat4 lightSpaceMatrix = CalculateLightSpaceMatrix();
-    RenderShadowPass(lightSpaceMatrix);
-    
-    // ===== MAIN RENDERING PASS =====
-    m_SceneFBO->Bind();
-    RenderMainPass(m_SceneFBO->GetSpecification().Width, m_SceneFBO->GetSpecification().Height, lightSpaceMatrix);
-    m_SceneFBO->Unbind();
+    auto& window = Aether::Application::Get().GetWindow();
+    if (window.GetFramebufferWidth() == 0 || window.GetFramebufferHeight() == 0)
+        return;
 
-    // ===== POST-PROCESSING PASS (LUT) =====
-    m_SceneFBO->BindColorTexture(0);
-    Aether::MaterialLibrary::Get(id_LUTMaterial)->SetInt("u_SceneTexture", 0);
-    
-    Aether::MaterialLibrary::Get(id_LUTMaterial)->Bind(1); // LUT texture binds at slot 1
-    Aether::MaterialLibrary::Get(id_LUTMaterial)->SetFloat("u_LutIntensity", m_LutIntensity);
-    Aether::MaterialLibrary::Get(id_LUTMaterial)->UploadMaterial();
+    m_EditorCamera.SetViewportSize((float)window.GetFramebufferWidth(), (float)window.GetFramebufferHeight());
+
+    Aether::Renderer::Submit([this, frame = BuildFrameData()]() mutable
+    {
+        m_RenderFrame = std::move(frame);
+        RenderFrame();
+    });
+}
 
+DemoLayer::FrameData DemoLayer::BuildFrameData()
+{
     auto& window = Aether::Application::Get().GetWindow();
-    Aether::RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1.0f });
-    Aether::RenderCommand::Clear();
-    Aether::RenderCommand::SetViewport(0, 0, window.GetFramebufferWidth(), window.GetFramebufferHeight());
-    Aether::RenderCommand::DrawIndexed(Aether::MeshLibrary::Get(id_ScreenQuadMesh)->GetVertexArray());
+
+    FrameData frame;
+    frame.Width = window.GetFramebufferWidth();
+    frame.Height = window.GetFramebufferHeight();
+    frame.ClearColor = m_FogEnabled ? glm::vec4(m_FogColor, 1.0f) : m_BackgroundColor;
+    frame.ShadowMapResolution = m_ShadowMapResolution;
+
+    frame.View = m_EditorCamera.GetViewMatrix();
+    frame.Projection = m_EditorCamera.GetProjection();
+    frame.CameraPosition = m_EditorCamera.GetPosition();
+
+    frame.ModelA = glm::translate(glm::mat4(1.0f), m_TranslationA);
+    frame.ModelA = glm::rotate(frame.ModelA, m_Rotation, glm::vec3(0.5f, 1.0f, 0.0f));
+    frame.ModelA = glm::scale(frame.ModelA, glm::vec3(m_CubeScale));
+
+    frame.ModelB = glm::translate(glm::mat4(1.0f), m_TranslationB);
+    frame.ModelB = glm::rotate(frame.ModelB, m_Rotation * 0.7f, glm::vec3(1.0f, 0.5f, 0.0f));
+    frame.ModelB = glm::scale(frame.ModelB, glm::vec3(m_CubeScale));
+
+    frame.FloorModel = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -2.0f, 0.0f));
+    frame.FloorModel = glm::scale(frame.FloorModel, glm::vec3(m_FloorScale, 0.1f, m_FloorScale));
+
+    // Everything that can cast, so the cascades' depth ranges reach back to it
+    Aether::AABB casterBounds;
+    auto addCaster = [&](const glm::mat4& model)
+    {
+        Aether::AABB bounds;
+        Aether::FrustumCuller::TransformBounds(model, glm::vec3(-0.5f), glm::vec3(0.5f), bounds.Min, bounds.Max);
+        casterBounds = Aether::AABB::Union(casterBounds, bounds);
+        return bounds;
+    };
+    std::array<Aether::AABB, 3> fixedBounds = { addCaster(frame.ModelA), addCaster(frame.ModelB), addCaster(frame.FloorModel) };
+    auto cullFixed = [&](const Aether::Frustum& frustum)
+    {
+        uint32_t mask = 0;
+        for (uint32_t i = 0; i < (uint32_t)fixedBounds.size(); i++)
+            mask |= frustum.Intersects(fixedBounds[i].Min, fixedBounds[i].Max) ? 1u << i : 0u;
+        return mask;
+    };
+
+    m_Culler.Clear();
+    m_Culler.Reserve((uint32_t)m_RandomCubes.size());
+    frame.InstanceModels.reserve(m_RandomCubes.size());
+    for (size_t i = 0; i < m_RandomCubes.size(); i++) 
+    {
+        glm::mat4 instModel = glm::translate(glm::mat4(1.0f), m_RandomCubes[i]);
+        instModel = glm::rotate(instModel, m_Rotation * m_CubeRot[i], glm::vec3(0.5f, 1.0f, 0.0f));
+        instModel = glm::scale(instModel, glm::vec3(m_CubesSize[i] * m_CubeScale));
+        frame.InstanceModels.push_back(instModel);
+
+        Aether::AABB bounds = addCaster(instModel);
+        m_Culler.Add(bounds.Min, bounds.Max);
+    }
+
+    UpdateShadowCascades(frame, casterBounds);
+
+    // Cubes outside the camera can still cast into view, so each cascade culls against its own light frustum
+    Aether::Frustum cameraFrustum = Aether::Frustum::FromViewProjection(m_EditorCamera.GetViewProjection());
+    m_Culler.Cull(cameraFrustum, frame.VisibleInstances);
+    frame.VisibleFixed = cullFixed(cameraFrustum);
+    m_ShadowCasterCounts = {};
+    for (uint32_t c = 0; c < frame.CascadeCount; c++)
+    {
+        Aether::Frustum lightFrustum = Aether::Frustum::FromViewProjection(frame.LightSpaceMatrices[c]);
+        m_Culler.Cull(lightFrustum, frame.ShadowCasters[c]);
+        frame.FixedCasters[c] = cullFixed(lightFrustum);
+        m_ShadowCasterCounts[c] = (uint32_t)frame.ShadowCasters[c].size();
+    }
+
+    m_FrustumVisibleCount = (uint32_t)frame.VisibleInstances.size();
+    if (m_OcclusionCulling)
+        CullOccludedInstances(frame);
+    m_VisibleCount = (uint32_t)frame.VisibleInstances.size();
+
+    frame.DirectionalLight = m_DirectionalLight;
+    frame.ShowCascades = m_ShowCascades;
+    frame.LightPos = m_LightPos;
+    frame.LightDir = m_LightDir;
+    frame.InnerAngle = m_InnerAngle;
+    frame.OuterAngle = m_OuterAngle;
+
+    frame.FogEnabled = m_FogEnabled;
+    frame.FogColor = m_FogColor;
+    frame.FogStart = m_FogStart;
+    frame.FogEnd = m_FogEnd;
+    frame.LutIntensity = m_LutIntensity;
+    return frame;
+}
+
+void DemoLayer::UpdateShadowCascades(FrameData& frame, const Aether::AABB& casterBounds)
+{
+    if (!m_DirectionalLight)
+    {
+        frame.CascadeCount = 1;
+        frame.LightSpaceMatrices[0] = CalculateLightSpaceMatrix();
+        frame.CascadeSplits = glm::vec4(FLT_MAX);
+        frame.CascadeBias = glm::vec4(0.005f);
+        return;
+    }
+
+    m_CascadedShadows.SetCascadeCount((uint32_t)m_CascadeCount);
+    m_CascadedShadows.SetSplitLambda(m_SplitLambda);
+    m_CascadedShadows.SetResolution((uint32_t)m_ShadowMapResolution);
+    m_CascadedShadows.SetMaxDistance(m_ShadowDistance);
+    m_CascadedShadows.Update(m_EditorCamera.GetViewMatrix(), m_EditorCamera.GetProjection(), m_LightDir, casterBounds);
+
+    frame.CascadeCount = m_CascadedShadows.GetCascadeCount();
+    frame.CascadeSplits = glm::vec4(FLT_MAX);
+    frame.CascadeBias = glm::vec4(0.0f);
+    for (uint32_t c = 0; c < frame.CascadeCount; c++)
+    {
+        const auto& cascade = m_CascadedShadows.GetCascade(c);
+        frame.LightSpaceMatrices[c] = cascade.ViewProjection;
+        frame.CascadeSplits[c] = cascade.SplitDepth;
+        frame.CascadeBias[c] = cascade.TexelDepth * s_CascadeBiasTexels;
+    }
+}
+
+void DemoLayer::CullOccludedInstances(FrameData& frame)
+{
+    // Only the main pass: a cube hidden from the camera can still cast into view
+    static constexpr size_t s_MaxOccluders = 32;
+
+    m_OcclusionCuller.BeginFrame(m_EditorCamera.GetViewProjection());
+    m_OcclusionCuller.AddOccluderBox(glm::vec3(-0.5f), glm::vec3(0.5f), frame.ModelA);
+    m_OcclusionCuller.AddOccluderBox(glm::vec3(-0.5f), glm::vec3(0.5f), frame.ModelB);
+    m_OcclusionCuller.AddOccluderBox(glm::vec3(-0.5f), glm::vec3(0.5f), frame.FloorModel);
+
+    // The cubes that cover the most screen make the best occluders
+    glm::vec3 cameraPosition = m_EditorCamera.GetPosition();
+    auto coverage = [&](uint32_t index)
+    {
+        return m_CubesSize[index] / glm::max(glm::length(m_RandomCubes[index] - cameraPosition), 0.1f);
+    };
+
+    m_Occluders = frame.VisibleInstances;
+    size_t occluderCount = std::min(m_Occluders.size(), s_MaxOccluders);
+    std::partial_sort(m_Occluders.begin(), m_Occluders.begin() + occluderCount, m_Occluders.end(),
+        [&](uint32_t a, uint32_t b) { return coverage(a) > coverage(b); });
+    for (size_t i = 0; i < occluderCount; i++)
+        m_OcclusionCuller.AddOccluderBox(glm::vec3(-0.5f), glm::vec3(0.5f), frame.InstanceModels[m_Occluders[i]]);
+
+    m_OcclusionCuller.Rasterize();
+    m_OcclusionCuller.Cull(m_Culler, frame.VisibleInstances);
+}
+
+void DemoLayer::RenderFrame()
+{
+    const FrameData& frame = m_RenderFrame;
+
+    Aether::FramebufferSpecification shadowSpec;
+    shadowSpec.Width = frame.ShadowMapResolution;
+    shadowSpec.Height = frame.ShadowMapResolution;
+    shadowSpec.Attachments = { Aether::FramebufferTextureFormat::DEPTH24STENCIL8 };
+    shadowSpec.Layers = frame.CascadeCount;
+    m_RenderGraph.SetTarget("ShadowMap", shadowSpec);
+
+    Aether::FramebufferSpecification sceneSpec;
+    sceneSpec.Width = frame.Width;
+    sceneSpec.Height = frame.Height;
+    sceneSpec.Attachments = { 
+        Aether::FramebufferTextureFormat::RGBA8, 
+        Aether::FramebufferTextureFormat::DEPTH24STENCIL8 
+    };
+    m_RenderGraph.SetTarget("Scene", sceneSpec, frame.ClearColor);
+    m_RenderGraph.SetBackbuffer(frame.Width, frame.Height, { 0.1f, 0.1f, 0.1f, 1.0f });
+
+    // Written once, read by every pass
+    auto& ring = Aether::Renderer::GetRingBuffer();
+
+    // Layout matches assets/shaders/include/Camera.glsl
+    struct CameraData
+    {
+        glm::mat4 ViewProjection;
+        glm::mat4 View;
+        glm::mat4 Projection;
+        glm::vec4 Position;
+    };
+
+    m_CameraData = ring.Allocate(sizeof(CameraData), ring.GetUniformAlignment());
+    if (m_CameraData)
+    {
+        auto* camera = (CameraData*)m_CameraData.Data;
+        camera->ViewProjection = frame.Projection * frame.View;
+        camera->View = frame.View;
+        camera->Projection = frame.Projection;
+        camera->Position = glm::vec4(frame.CameraPosition, 1.0f);
+        ring.Commit(m_CameraData);
+    }
+
+    BuildSceneBatches();
+    m_RenderGraph.Execute();
+}
+
+void DemoLayer::BuildSceneBatches()
+{
+    const FrameData& frame = m_RenderFrame;
+    Aether::Mesh* cube = Aether::MeshLibrary::Get(id_CubeMesh).get();
+    Aether::Material* material = Aether::MaterialLibrary::Get(id_LightingMaterial).get();
+
+    auto build = [&](Aether::DrawBatcher& batch, const std::vector<uint32_t>& instances, uint32_t fixed)
+    {
+        batch.Clear();
+        if (fixed & 1u)
+            batch.Submit(cube, 0, material, frame.ModelA);
+        if (fixed & 2u)
+            batch.Submit(cube, 0, material, frame.ModelB);
+        for (uint32_t index : instances)
+            batch.Submit(cube, 0, material, frame.InstanceModels[index]);
+        if (fixed & 4u)
+            batch.Submit(cube, 0, material, frame.FloorModel);
+        batch.Build();
+    };
+
+    build(m_SceneBatch, frame.VisibleInstances, frame.VisibleFixed);
+    for (uint32_t c = 0; c < frame.CascadeCount; c++)
+        build(m_ShadowBatches[c], frame.ShadowCasters[c], frame.FixedCasters[c]);
 }
 
 void DemoLayer::OnEvent(Aether::Event& event)
@@ -241,10 +443,15 @@ void DemoLayer::OnImGuiRender()
     }
 
     // ===== LIGHTING SECTION =====
-    if (ImGui::CollapsingHeader("Spotlight", ImGuiTreeNodeFlags_DefaultOpen)) 
+    if (ImGui::CollapsingHeader("Light", ImGuiTreeNodeFlags_DefaultOpen)) 
     {
-        ImGui::Text("Position");
-        ImGui::DragFloat3("##LightPos", &m_LightPos.x, 0.1f, -20.0f, 20.0f);
+        ImGui::Checkbox("Directional (cascaded shadows)", &m_DirectionalLight);
+
+        if (!m_DirectionalLight)
+        {
+            ImGui::Text("Position");
+            ImGui::DragFloat3("##LightPos", &m_LightPos.x, 0.1f, -20.0f, 20.0f);
+        }
 
         ImGui::Spacing();
         ImGui::Text("Direction");
@@ -259,19 +466,32 @@ void DemoLayer::OnImGuiRender()
 
         ImGui::Spacing();
         ImGui::Separator();
-        
-        // Cone angles with visual feedback
-        ImGui::Text("Cone Shape");
-        ImGui::SliderFloat("Inner Angle", &m_InnerAngle, 1.0f, 80.0f, "%.1f°");
-        ImGui::SliderFloat("Outer Angle", &m_OuterAngle, m_InnerAngle, 90.0f, "%.1f°");
 
-        if (m_InnerAngle > m_OuterAngle) m_InnerAngle = m_OuterAngle;
+        if (m_DirectionalLight)
+        {
+            ImGui::Text("Shadow Cascades");
+            ImGui::SliderInt("Cascades", &m_CascadeCount, 2, (int)Aether::CascadedShadowMap::MaxCascades);
+            ImGui::SliderFloat("Split Lambda", &m_SplitLambda, 0.0f, 1.0f, "%.2f");
+            ImGui::DragFloat("Shadow Distance", &m_ShadowDistance, 0.5f, 5.0f, 200.0f, "%.1f");
+            ImGui::Checkbox("Show Cascades", &m_ShowCascades);
+            for (int c = 0; c < m_CascadeCount; c++)
+                ImGui::Text("Cascade %d: %u casters", c, m_ShadowCasterCounts[c]);
+        }
+        else
+        {
+            // Cone angles with visual feedback
+            ImGui::Text("Cone Shape");
+            ImGui::SliderFloat("Inner Angle", &m_InnerAngle, 1.0f, 80.0f, "%.1f°");
+            ImGui::SliderFloat("Outer Angle", &m_OuterAngle, m_InnerAngle, 90.0f, "%.1f°");
+
+            if (m_InnerAngle > m_OuterAngle) m_InnerAngle = m_OuterAngle;
         
-        // Visual indicator
-        float coneRatio = m_InnerAngle / m_OuterAngle;
-        ImGui::ProgressBar(coneRatio, ImVec2(-1, 0), "");
-        ImGui::SameLine(0, 10);
-        ImGui::Text("Sharpness");
+            // Visual indicator
+            float coneRatio = m_InnerAngle / m_OuterAngle;
+            ImGui::ProgressBar(coneRatio, ImVec2(-1, 0), "");
+            ImGui::SameLine(0, 10);
+            ImGui::Text("Sharpness");
+        }
     }
 
     // ===== SCENE OBJECTS =====
@@ -305,6 +525,8 @@ void DemoLayer::OnImGuiRender()
         
         // Random cubes section with better layout
         ImGui::Text("Random Cubes (%d)", (int)m_RandomCubes.size());
+        ImGui::Checkbox("Occlusion Culling", &m_OcclusionCulling);
+        ImGui::Text("Visible: %u (frustum %u)", m_VisibleCount, m_FrustumVisibleCount);
         
         float buttonWidth = (ImGui::GetContentRegionAvail().x - 10) * 0.5f;
         if (ImGui::Button("+ Spawn Cube", ImVec2(buttonWidth, 30))) {
@@ -380,13 +602,8 @@ void DemoLayer::OnImGuiRender()
         
         if (ImGui::Combo("Resolution", &currentRes, resolutions, 4)) {
             int newRes[] = { 512, 1024, 2048, 4096 };
+            // Picked up by the next frame's pool acquire
             m_ShadowMapResolution = newRes[currentRes];
-            
-            Aether::FramebufferSpecification fbSpec;
-            fbSpec.Width = m_ShadowMapResolution;
-            fbSpec.Height = m_ShadowMapResolution;
-            fbSpec.Attachments = { Aether::FramebufferTextureFormat::DEPTH24STENCIL8 };
-            m_ShadowFBO = Aether::FrameBuffer::Create(fbSpec);
         }
 
         ImGui::Spacing();
@@ -397,7 +614,9 @@ void DemoLayer::OnImGuiRender()
         ImGui::SliderFloat("Intensity", &m_LutIntensity, 0.0f, 1.0f);
         
         // Display LUT texture preview
-        ImGui::Image((void*)(intptr_t)Aether::Texture2DLibrary::Get(Aether::AssetsRegister::Get("Tex_LUT"))->GetRendererID(), ImVec2(256, 16));
+        // May be evicted under a tight GPU budget; it comes back on its own
+        if (auto lut = Aether::Texture2DLibrary::Get(id_TexLUT))
+            ImGui::Image((void*)(intptr_t)lut->GetRendererID(), ImVec2(256, 16));
         
         ImGui::Spacing();
         ImGui::Separator();
@@ -450,43 +669,32 @@ void DemoLayer::InitSkybox()
     m_SkyboxTexture = Aether::TextureCube::Create("assets/textures/skybox.png");
 }
 
-void DemoLayer::RenderShadowPass(const glm::mat4& lightSpaceMatrix)
+void DemoLayer::RenderShadowPass(const Aether::RenderGraph::Resources& resources)
 {
-    m_ShadowFBO->Bind();
-    Aether::RenderCommand::SetViewport(0, 0, m_ShadowMapResolution, m_ShadowMapResolution);
-    Aether::RenderCommand::Clear();
+    const FrameData& frame = m_RenderFrame;
+    const auto& shadowMap = resources.GetTarget("ShadowMap");
 
     // Use Material API
     Aether::MaterialLibrary::Get(id_ShadowMaterial)->Bind(0);
-    Aether::MaterialLibrary::Get(id_ShadowMaterial)->SetMat4("u_LightSpaceMatrix", lightSpaceMatrix);
-    Aether::MaterialLibrary::Get(id_ShadowMaterial)->UploadMaterial();
-    
-    RenderScene(Aether::MaterialLibrary::Get(id_ShadowMaterial));
-    
-    m_ShadowFBO->Unbind();
-}
-
-void DemoLayer::RenderMainPass(uint32_t width, uint32_t height, const glm::mat4& lightSpaceMatrix)
-{
-    Aether::RenderCommand::SetViewport(0, 0, width, height);
+    for (uint32_t c = 0; c < frame.CascadeCount; c++)
+    {
+        // The graph only cleared whichever layer was attached when it bound the target
+        shadowMap->SetDepthLayer(c);
+        Aether::RenderCommand::Clear();
 
-    if (m_FogEnabled)
-        Aether::RenderCommand::SetClearColor(glm::vec4(m_FogColor, 1.0f));
-    else
-        Aether::RenderCommand::SetClearColor(m_BackgroundColor);
-    
-    Aether::RenderCommand::Clear();
+        Aether::MaterialLibrary::Get(id_ShadowMaterial)->SetMat4("u_LightSpaceMatrix", frame.LightSpaceMatrices[c]);
+        Aether::MaterialLibrary::Get(id_ShadowMaterial)->UploadMaterial();
 
-    // Update Camera UBO
-    m_EditorCamera.SetViewportSize((float)width, (float)height);
+        RenderScene(m_ShadowBatches[c], Aether::MaterialLibrary::Get(id_ShadowMaterial));
+    }
+}
 
-    glm::mat4 projection = m_EditorCamera.GetProjection();
-    glm::mat4 view = m_EditorCamera.GetViewMatrix();
-    glm::vec3 camPos = m_EditorCamera.GetPosition();
+void DemoLayer::RenderMainPass(const Aether::RenderGraph::Resources& resources)
+{
+    const FrameData& frame = m_RenderFrame;
 
-    m_CameraUBO->SetData(glm::value_ptr(projection), sizeof(glm::mat4), 0);
-    m_CameraUBO->SetData(glm::value_ptr(view), sizeof(glm::mat4), sizeof(glm::mat4));
-    m_CameraUBO->SetData(glm::value_ptr(camPos), sizeof(glm::vec3), 2 * sizeof(glm::mat4));
+    if (m_CameraData)
+        Aether::Renderer::GetRingBuffer().BindUniform(0, m_CameraData);
 
     // Render skybox (raw shader + texture)
     RenderSkybox();
@@ -495,29 +703,39 @@ void DemoLayer::RenderMainPass(uint32_t width, uint32_t height, const glm::mat4&
     Aether::MaterialLibrary::Get(id_LightingMaterial)->Bind(0); // Binds wood texture at slot 0
     
     // Manually bind shadow map at slot 1 (can't be in Material since it's a framebuffer texture)
-    m_ShadowFBO->BindDepthTexture(1);
+    resources.GetTarget("ShadowMap")->BindDepthTexture(1);
     Aether::MaterialLibrary::Get(id_LightingMaterial)->GetShader()->SetInt("u_ShadowMap", 1);
 
     // Set all uniforms through Material API
-    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat3("u_LightPos", m_LightPos);
-    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat3("u_LightDir", m_LightDir);
-    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat("u_CutOff", glm::cos(glm::radians(m_InnerAngle)));
-    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat("u_OuterCutOff", glm::cos(glm::radians(m_OuterAngle)));
-    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetMat4("u_LightSpaceMatrix", lightSpaceMatrix);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat3("u_LightPos", frame.LightPos);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat3("u_LightDir", frame.LightDir);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat("u_CutOff", glm::cos(glm::radians(frame.InnerAngle)));
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat("u_OuterCutOff", glm::cos(glm::radians(frame.OuterAngle)));
+    for (uint32_t c = 0; c < frame.CascadeCount; c++)
+        Aether::MaterialLibrary::Get(id_LightingMaterial)->SetMat4("u_LightSpaceMatrices[" + std::to_string(c) + "]", frame.LightSpaceMatrices[c]);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetInt("u_CascadeCount", (int)frame.CascadeCount);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat4("u_CascadeSplits", frame.CascadeSplits);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat4("u_CascadeBias", frame.CascadeBias);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetInt("u_DirectionalLight", frame.DirectionalLight);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetInt("u_ShowCascades", frame.ShowCascades);
     Aether::MaterialLibrary::Get(id_LightingMaterial)->SetInt("u_IsLightSource", 0);
-    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetInt("u_FogEnabled", m_FogEnabled);
-    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat3("u_FogColor", m_FogColor);
-    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat("u_FogStart", m_FogStart);
-    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat("u_FogEnd", m_FogEnd);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetInt("u_FogEnabled", frame.FogEnabled);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat3("u_FogColor", frame.FogColor);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat("u_FogStart", frame.FogStart);
+    Aether::MaterialLibrary::Get(id_LightingMaterial)->SetFloat("u_FogEnd", frame.FogEnd);
     
     // Upload all uniforms at once
     Aether::MaterialLibrary::Get(id_LightingMaterial)->UploadMaterial();
     
-    RenderScene(Aether::MaterialLibrary::Get(id_LightingMaterial));
+    RenderScene(m_SceneBatch, Aether::MaterialLibrary::Get(id_LightingMaterial));
+
+    // A directional light has no position to mark
+    if (frame.DirectionalLight)
+        return;
 
     // Render light source indicator
     auto shader = Aether::MaterialLibrary::Get(id_LightingMaterial)->GetShader();
-    glm::mat4 model = glm::translate(glm::mat4(1.0f), m_LightPos);
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), frame.LightPos);
     model = glm::scale(model, glm::vec3(0.2f));
     shader->SetMat4("u_Model", model);
     shader->SetInt("u_IsLightSource", 1);
@@ -526,6 +744,18 @@ void DemoLayer::RenderMainPass(uint32_t width, uint32_t height, const glm::mat4&
     shader->SetInt("u_IsLightSource", 0);
 }
 
+void DemoLayer::RenderColorGradingPass(const Aether::RenderGraph::Resources& resources)
+{
+    resources.GetTarget("Scene")->BindColorTexture(0);
+    Aether::MaterialLibrary::Get(id_LUTMaterial)->SetInt("u_SceneTexture", 0);
+    
+    Aether::MaterialLibrary::Get(id_LUTMaterial)->Bind(1); // LUT texture binds at slot 1
+    Aether::MaterialLibrary::Get(id_LUTMaterial)->SetFloat("u_LutIntensity", m_RenderFrame.LutIntensity);
+    Aether::MaterialLibrary::Get(id_LUTMaterial)->UploadMaterial();
+
+    Aether::RenderCommand::DrawIndexed(Aether::MeshLibrary::Get(id_ScreenQuadMesh)->GetVertexArray());
+}
+
 void DemoLayer::RenderSkybox()
 {
     // Skybox uses raw shader + texture (since TextureCube isn't supported by Material)
@@ -539,76 +769,10 @@ void DemoLayer::RenderSkybox()
 }
 
 
-void DemoLayer::RenderScene(const Aether::Ref<Aether::Material>& material)
+void DemoLayer::RenderScene(Aether::DrawBatcher& batch, const Aether::Ref<Aether::Material>& material)
 {
-    auto cubeVAO = Aether::MeshLibrary::Get(id_CubeMesh)->GetVertexArray();
-    auto shader = material->GetShader();
-
-    shader->SetInt("u_UseInstancing", 0);
-
-    // Cube A
-    glm::mat4 model = glm::translate(glm::mat4(1.0f), m_TranslationA);
-    model = glm::rotate(model, m_Rotation, glm::vec3(0.5f, 1.0f, 0.0f));
-    model = glm::scale(model, glm::vec3(m_CubeScale));
-    shader->SetMat4("u_Model", model);
-    Aether::RenderCommand::DrawIndexed(cubeVAO);
-
-    // Cube B
-    model = glm::translate(glm::mat4(1.0f), m_TranslationB);
-    model = glm::rotate(model, m_Rotation * 0.7f, glm::vec3(1.0f, 0.5f, 0.0f));
-    model = glm::scale(model, glm::vec3(m_CubeScale));
-    shader->SetMat4("u_Model", model);
-    Aether::RenderCommand::DrawIndexed(cubeVAO);
-
-    // Random cubes with instancing
-    if (!m_RandomCubes.empty())
-    {
-        m_InstanceModels.clear();
-        m_InstanceModels.reserve(m_RandomCubes.size());
-
-        for (size_t i = 0; i < m_RandomCubes.size(); i++) 
-        {
-            glm::vec3 pos = m_RandomCubes[i];
-            float size = m_CubesSize[i];
-            float rot = m_CubeRot[i];
-            glm::mat4 instModel = glm::translate(glm::mat4(1.0f), pos);
-            instModel = glm::rotate(instModel, m_Rotation * rot, glm::vec3(0.5f, 1.0f, 0.0f));
-            instModel = glm::scale(instModel, glm::vec3(size * m_CubeScale));
-            m_InstanceModels.push_back(instModel);
-        }
-
-        uint32_t dataSize = (uint32_t)m_InstanceModels.size() * sizeof(glm::mat4);
-
-        if (!m_InstanceVBO || m_InstanceVBO->GetSize() < dataSize) 
-        {
-            uint32_t newSize = dataSize * 2;
-            bool needsVAOSetup = false; 
-            if (m_InstanceVBO) m_InstanceVBO->Resize(newSize);
-            else 
-            {
-                m_InstanceVBO = Aether::VertexBuffer::Create(newSize);  // New buffer
-                needsVAOSetup = true;  // Need to setup VAO for new buffer
-            }
-            
-            Aether::BufferLayout instanceLayout = {
-                { "a_InstanceModel", Aether::ShaderDataType::Mat4 }
-            };
-            m_InstanceVBO->SetLayout(instanceLayout);
-            if (needsVAOSetup) cubeVAO->AddInstanceBuffer(m_InstanceVBO, 3);
-        }
-        
-        m_InstanceVBO->SetData(m_InstanceModels.data(), dataSize, 0);
-
-        shader->SetInt("u_UseInstancing", 1);
-        Aether::RenderCommand::DrawInstanced(cubeVAO, (uint32_t)m_RandomCubes.size());
-        shader->SetInt("u_UseInstancing", 0);
-    }
-
-    // Floor
-    model = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -2.0f, 0.0f));
-    model = glm::scale(model, glm::vec3(m_FloorScale, 0.1f, m_FloorScale));
-    shader->SetMat4("u_Model", model);
-    Aether::RenderCommand::DrawIndexed(cubeVAO);
+    // The pass has bound `material` and uploaded its uniforms
+    batch.Draw(material.get());
 }
 
 glm::mat4 DemoLayer::CalculateLightSpaceMatrix()
@@ -17,17 +17,76 @@ public:
     virtual void OnEvent(Aether::Event& event) override;
 
 private:
+    // Everything the passes read, copied out of the layer each frame so the render thread
+    // replays it while the main thread edits the next one
+    struct FrameData
+    {
+        uint32_t Width = 0, Height = 0;
+        glm::vec4 ClearColor;
+        int ShadowMapResolution = 0;
+
+        glm::mat4 View, Projection;
+        glm::vec3 CameraPosition;
+
+        glm::mat4 ModelA, ModelB, FloorModel;
+        // Which of those three the camera sees, and each cascade's light frustum: bit 0 ModelA,
+        // bit 1 ModelB, bit 2 the floor
+        uint32_t VisibleFixed = 0;
+        std::array<uint32_t, Aether::CascadedShadowMap::MaxCascades> FixedCasters = {};
+        std::vector<glm::mat4> InstanceModels;
+        // Indices into InstanceModels that survived the camera and each cascade's light frustum
+        std::vector<uint32_t> VisibleInstances;
+        std::array<std::vector<uint32_t>, Aether::CascadedShadowMap::MaxCascades> ShadowCasters;
+
+        // A spotlight uses cascade 0 alone, with a split past everything
+        uint32_t CascadeCount = 1;
+        std::array<glm::mat4, Aether::CascadedShadowMap::MaxCascades> LightSpaceMatrices;
+        glm::vec4 CascadeSplits, CascadeBias;
+        bool DirectionalLight, ShowCascades;
+
+        glm::vec3 LightPos, LightDir;
+        float InnerAngle, OuterAngle;
+
+        bool FogEnabled;
+        glm::vec3 FogColor;
+        float FogStart, FogEnd;
+        float LutIntensity;
+    };
+
+    FrameData BuildFrameData();
+    void RenderFrame();
     glm::mat4 CalculateLightSpaceMatrix();
-    void RenderShadowPass(const glm::mat4& lightSpaceMatrix);
-    void RenderMainPass(uint32_t width, uint32_t height, const glm::mat4& lightSpaceMatrix);
-    void RenderScene(const Aether::Ref<Aether::Material>& material);
+    void UpdateShadowCascades(FrameData& frame, const Aether::AABB& casterBounds);
+    void RenderShadowPass(const Aether::RenderGraph::Resources& resources);
+    void RenderMainPass(const Aether::RenderGraph::Resources& resources);
+    void RenderColorGradingPass(const Aether::RenderGraph::Resources& resources);
+    void RenderScene(Aether::DrawBatcher& batch, const Aether::Ref<Aether::Material>& material);
+    void BuildSceneBatches();
+    void CullOccludedInstances(FrameData& frame);
 
 private:
 
-    Aether::Ref<Aether::FrameBuffer> m_ShadowFBO;
-    Aether::Ref<Aether::FrameBuffer> m_SceneFBO;
-    Aether::Ref<Aether::UniformBuffer> m_CameraUBO;
-    Aether::Ref<Aether::VertexBuffer> m_InstanceVBO;
+    // Shadow -> Main -> ColorGrading; the shadow map and scene targets are transient.
+    // The graph, the frame it renders and the GPU objects below belong to the render thread.
+    Aether::RenderGraph m_RenderGraph;
+    FrameData m_RenderFrame;
+    // This frame's camera block in the renderer's ring buffer
+    Aether::RingAllocation m_CameraData;
+    // Every visible cube and the floor; they share a mesh and material, so each pass is one instanced draw
+    Aether::DrawBatcher m_SceneBatch;
+    // One per cascade, holding only the casters that touch it
+    std::array<Aether::DrawBatcher, Aether::CascadedShadowMap::MaxCascades> m_ShadowBatches;
+
+    // Random cube bounds, culled on the main thread while the frame is built
+    Aether::FrustumCuller m_Culler;
+    Aether::OcclusionCuller m_OcclusionCuller;
+    std::vector<uint32_t> m_Occluders;
+    bool m_OcclusionCulling = true;
+    uint32_t m_FrustumVisibleCount = 0;
+    uint32_t m_VisibleCount = 0;
+
+    Aether::CascadedShadowMap m_CascadedShadows;
+    std::array<uint32_t, Aether::CascadedShadowMap::MaxCascades> m_ShadowCasterCounts = {};
     
     
     Aether::Ref<Aether::Shader> m_SkyboxShader;
@@ -45,7 +104,6 @@ private:
     std::vector<glm::vec3> m_RandomCubes;
     std::vector<float> m_CubesSize;
     std::vector<float> m_CubeRot;
-    std::vector<glm::mat4> m_InstanceModels;
 
     
     float m_LutIntensity = 1.0f;
@@ -61,6 +119,13 @@ private:
     float m_InnerAngle = 20.0f;
     float m_OuterAngle = 30.0f;
 
+    // Directional lights shadow through cascades; the spotlight keeps its single perspective map
+    bool m_DirectionalLight = true;
+    int m_CascadeCount = 4;
+    float m_SplitLambda = 0.75f;
+    float m_ShadowDistance = 40.0f;
+    bool m_ShowCascades = false;
+
     // Rendering settings
     glm::vec4 m_BackgroundColor = { 0.1f, 0.1f, 0.1f, 1.0f };
     int m_ShadowMapResolution = 2048;
@@ -2,13 +2,18 @@
 #include "Aether/Core/JobSystem.h"
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <chrono>
 
-Aether::UUID id_ShaderPBR = Aether::AssetsRegister::Register("Shader_PBR");
+static constexpr Aether::UUID id_ShaderPBR = Aether::AssetsRegister::Get("Shader_PBR");
+
+// Past the material's own maps
+static constexpr uint32_t s_EnvironmentSlot = 8;
 
 LabLayer::LabLayer() 
     : Layer("Lab Layer")
     , m_Camera(45.0f, 1.778f, 0.1f, 1000.0f)
 {
+    m_RenderThreadSafe = true;
     m_Camera.SetDistance(5.0f);
 }
 
@@ -18,7 +23,8 @@ void LabLayer::Attach()
     if (ctx) ImGui::SetCurrentContext(ctx);
 
     Aether::ShaderLibrary::Load("assets/shaders/PBR.shader", id_ShaderPBR);
-    m_CameraUBO = Aether::UniformBuffer::Create(sizeof(glm::mat4) * 2 + sizeof(glm::vec4), 0);
+    m_CameraUBO = Aether::UniformBuffer::Create(sizeof(glm::mat4) * 3 + sizeof(glm::vec4), 0);
+    m_Environment = Aether::Environment::Load("assets/textures/skybox.png");
     
     // Load model async
     LoadModelAsync("assets/models/human.glb");
@@ -31,7 +37,7 @@ void LabLayer::LoadModelAsync(const std::string& path)
         AE_CORE_INFO("Worker thread: Parsing {0}", path);
         
         // Parse on worker thread (no OpenGL calls)
-        auto modelData = Aether::ModelLoader::Parsing(path);
+        auto modelData = Aether::CreateRef<Aether::ModelLoadResult>(Aether::ModelLoader::Parsing(path));
         
         // Push result to queue (thread-safe)
         {
@@ -46,7 +52,8 @@ void LabLayer::LoadModelAsync(const std::string& path)
 void LabLayer::Detach()
 {
     m_CameraUBO.reset();
-    m_MeshIDs.clear();
+    m_Environment.reset();
+    m_Meshes.clear();
 }
 
 void LabLayer::Update(Aether::Timestep ts)
@@ -56,15 +63,16 @@ void LabLayer::Update(Aether::Timestep ts)
         std::lock_guard<std::mutex> lock(m_ParseMutex);
         while (!m_CompletedParses.empty())
         {
-            // Upload to GPU on main thread
+            // Meshes are reserved here and built on the render thread
             auto modelData = std::move(m_CompletedParses.front());
             m_CompletedParses.pop();
             
-            AE_CORE_INFO("Main thread: Uploading to GPU...");
+            AE_CORE_INFO("Main thread: Queueing GPU upload...");
             auto newMeshes = Aether::ModelLoader::UploadModel(modelData, id_ShaderPBR);
-            m_MeshIDs.insert(m_MeshIDs.end(), newMeshes.begin(), newMeshes.end());
+            for (auto meshID : newMeshes)
+                m_Meshes.push_back(Aether::MeshLibrary::GetHandle(meshID));
             
-            AE_CORE_INFO("Main thread: Loaded {0} meshes", m_MeshIDs.size());
+            AE_CORE_INFO("Main thread: Loaded {0} meshes", m_Meshes.size());
         }
     }   
     
@@ -73,69 +81,193 @@ void LabLayer::Update(Aether::Timestep ts)
     m_Camera.Update(ts);
     
     auto& window = Aether::Application::Get().GetWindow();
+    if (window.GetFramebufferWidth() == 0 || window.GetFramebufferHeight() == 0)
+        return;
+
     m_Camera.SetViewportSize((float)window.GetWidth(), (float)window.GetHeight());
-    
-    glm::mat4 viewProj = m_Camera.GetProjection() * m_Camera.GetViewMatrix();
-    glm::mat4 view = m_Camera.GetViewMatrix();
-    glm::vec3 camPos = m_Camera.GetPosition();
-    
-    m_CameraUBO->SetData(glm::value_ptr(viewProj), sizeof(glm::mat4), 0);
-    m_CameraUBO->SetData(glm::value_ptr(view), sizeof(glm::mat4), sizeof(glm::mat4));
-    m_CameraUBO->SetData(glm::value_ptr(camPos), sizeof(glm::vec3), 2 * sizeof(glm::mat4));
-    
-    Aether::RenderCommand::SetClearColor({0.2f, 0.2f, 0.25f, 1.0f});
-    Aether::RenderCommand::Clear();
-    Aether::RenderCommand::SetViewport(0, 0, window.GetFramebufferWidth(), window.GetFramebufferHeight());
-    
-    RenderScene();
+
+    Aether::Renderer::Submit([this, frame = BuildFrameData()]() mutable
+    {
+        m_RenderFrame = std::move(frame);
+        RenderFrame();
+    });
 }
 
-void LabLayer::RenderScene()
+glm::mat4 LabLayer::GetModelTransform() const
 {
     glm::mat4 transform = glm::translate(glm::mat4(1.0f), m_ModelPos);
     transform = glm::rotate(transform, glm::radians(m_ModelRot.x), glm::vec3(1, 0, 0));
     transform = glm::rotate(transform, glm::radians(m_ModelRot.y), glm::vec3(0, 1, 0));
     transform = glm::rotate(transform, glm::radians(m_ModelRot.z), glm::vec3(0, 0, 1));
-    transform = glm::scale(transform, m_ModelScale);
+    return glm::scale(transform, m_ModelScale);
+}
+
+LabLayer::FrameData LabLayer::BuildFrameData()
+{
+    auto& window = Aether::Application::Get().GetWindow();
+
+    FrameData frame;
+    frame.Width = window.GetFramebufferWidth();
+    frame.Height = window.GetFramebufferHeight();
+    frame.View = m_Camera.GetViewMatrix();
+    frame.Projection = m_Camera.GetProjection();
+    frame.CameraPosition = m_Camera.GetPosition();
+    frame.Model = GetModelTransform();
 
-    for (auto meshID : m_MeshIDs)
+    // Submesh bounds go into the culler in draw order; only the visible ones are drawn
+    m_Culler.Clear();
+    m_CullItems.clear();
+    for (auto meshHandle : m_Meshes)
     {
-        auto mesh = Aether::MeshLibrary::Get(meshID);
+        Aether::Mesh* mesh = Aether::MeshLibrary::Resolve(meshHandle);
+        if (!mesh)
+            continue;
+
         const auto& submeshes = mesh->GetSubMeshes();
-        
-        for (const auto& submesh : submeshes)
+        for (uint32_t i = 0; i < (uint32_t)submeshes.size(); i++)
+        {
+            glm::vec3 boundsMin, boundsMax;
+            Aether::FrustumCuller::TransformBounds(frame.Model, submeshes[i].BoundsMin, submeshes[i].BoundsMax, boundsMin, boundsMax);
+            m_Culler.Add(boundsMin, boundsMax);
+            m_CullItems.push_back({ meshHandle, i });
+        }
+    }
+    m_Culler.Cull(Aether::Frustum::FromViewProjection(frame.Projection * frame.View), m_Visible);
+
+    // Projected size of a bounding sphere drives which texture mips get streamed in
+    float maxScale = glm::max(m_ModelScale.x, glm::max(m_ModelScale.y, m_ModelScale.z));
+    float pixelsPerUnit = frame.Projection[1][1] * 0.5f * (float)frame.Height;
+
+    frame.Draws.reserve(m_Visible.size());
+    for (uint32_t index : m_Visible)
+    {
+        auto [meshHandle, submeshIndex] = m_CullItems[index];
+        const auto& submesh = Aether::MeshLibrary::Resolve(meshHandle)->GetSubMeshes()[submeshIndex];
+
+        glm::vec3 center = glm::vec3(frame.Model * glm::vec4((submesh.BoundsMin + submesh.BoundsMax) * 0.5f, 1.0f));
+        float radius = glm::length(submesh.BoundsMax - submesh.BoundsMin) * 0.5f * maxScale;
+        float distance = glm::max(glm::length(center - frame.CameraPosition), 0.1f);
+        frame.Draws.push_back({ meshHandle, submeshIndex, 2.0f * radius * pixelsPerUnit / distance });
+    }
+    return frame;
+}
+
+void LabLayer::RenderFrame()
+{
+    const FrameData& frame = m_RenderFrame;
+
+    glm::mat4 viewProj = frame.Projection * frame.View;
+    m_CameraUBO->SetData(glm::value_ptr(viewProj), sizeof(glm::mat4), 0);
+    m_CameraUBO->SetData(glm::value_ptr(frame.View), sizeof(glm::mat4), sizeof(glm::mat4));
+    m_CameraUBO->SetData(glm::value_ptr(frame.Projection), sizeof(glm::mat4), 2 * sizeof(glm::mat4));
+    m_CameraUBO->SetData(glm::value_ptr(frame.CameraPosition), sizeof(glm::vec3), 3 * sizeof(glm::mat4));
+
+    Aether::RenderCommand::SetClearColor({0.2f, 0.2f, 0.25f, 1.0f});
+    Aether::RenderCommand::Clear();
+    Aether::RenderCommand::SetViewport(0, 0, frame.Width, frame.Height);
+
+    RenderScene();
+}
+
+void LabLayer::RenderScene()
+{
+    const FrameData& frame = m_RenderFrame;
+
+    // IBL uniforms live in the program, so once per frame is enough
+    if (Aether::ShaderLibrary::IsReady(id_ShaderPBR))
+    {
+        auto shader = Aether::ShaderLibrary::Get(id_ShaderPBR);
+        shader->Bind();
+        if (m_Environment)
+            m_Environment->Bind(shader, s_EnvironmentSlot);
+        else
+            Aether::Environment::BindFallback(shader, s_EnvironmentSlot);
+    }
+
+    m_SceneBatch.Clear();
+    for (const auto& draw : frame.Draws)
+    {
+        // Re-resolved here: the mesh may have been replaced since the frame was built
+        Aether::Mesh* mesh = Aether::MeshLibrary::Resolve(draw.Mesh);
+        if (!mesh || draw.Submesh >= mesh->GetSubMeshes().size())
+            continue;
+
+        const auto& submesh = mesh->GetSubMeshes()[draw.Submesh];
+        if (Aether::Material* material = Aether::MaterialLibrary::Resolve(submesh.MaterialHandle))
         {
-            if (submesh.MaterialID && Aether::MaterialLibrary::Exists(submesh.MaterialID))
-            {
-                auto material = Aether::MaterialLibrary::Get(submesh.MaterialID);
-                material->Bind(0);
-                material->SetMat4("u_Model", transform);
-                material->UploadMaterial();
-                
-                void* indexOffset = (void*)(submesh.BaseIndex * sizeof(uint32_t));
-                Aether::RenderCommand::DrawIndexedBaseVertex(
-                    mesh->GetVertexArray(),
-                    submesh.IndexCount,
-                    indexOffset,
-                    submesh.BaseVertex
-                );
-            }
+            material->RequestTextureResolution(draw.ScreenPixels);
+            m_SceneBatch.Submit(mesh, draw.Submesh, material, frame.Model);
         }
     }
+
+    m_SceneBatch.Draw();
 }
 
 void LabLayer::OnEvent(Aether::Event& event)
 {
-    if (!event.Handled) m_Camera.OnEvent(event);
+    if (event.Handled)
+        return;
+
+    m_Camera.OnEvent(event);
+    Aether::EventDispatcher dispatcher(event);
+    dispatcher.Dispatch<Aether::MouseButtonPressedEvent>(AE_BIND_EVENT_FN(LabLayer::OnMouseButtonPressed));
+}
+
+bool LabLayer::OnMouseButtonPressed(Aether::MouseButtonPressedEvent& e)
+{
+    if (e.GetMouseButton() != Aether::Mouse::ButtonLeft)
+        return false;
+
+    Pick(Aether::Input::GetMouseX(), Aether::Input::GetMouseY());
+    return false;
+}
+
+void LabLayer::Pick(float x, float y)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Into model space with the direction left unnormalized, so hit distances stay world distances
+    Aether::Ray ray = m_Camera.ScreenPointToRay(x, y);
+    glm::mat4 toModel = glm::inverse(GetModelTransform());
+    Aether::Ray local = { glm::vec3(toModel * glm::vec4(ray.Origin, 1.0f)), glm::vec3(toModel * glm::vec4(ray.Direction, 0.0f)) };
+
+    m_HasPick = false;
+    float closest = FLT_MAX;
+    for (auto meshHandle : m_Meshes)
+    {
+        Aether::Mesh* mesh = Aether::MeshLibrary::Resolve(meshHandle);
+        if (!mesh || !mesh->GetBVH())
+            continue;
+
+        Aether::TriangleHit hit;
+        if (mesh->GetBVH()->RayCast(local, closest, hit))
+        {
+            closest = hit.Distance;
+            m_HasPick = true;
+            m_PickedMesh = meshHandle;
+            m_PickHit = hit;
+        }
+    }
+
+    m_PickTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
 }
 
 void LabLayer::OnImGuiRender()
 {
     ImGui::Begin("Model Viewer");
     
-    ImGui::Text("Meshes: %d", (int)m_MeshIDs.size());
+    ImGui::Text("Meshes: %d", (int)m_Meshes.size());
     
     ImGui::Separator();
+
+    if (ImGui::CollapsingHeader("GPU Memory"))
+    {
+        float usageMB = Aether::GpuMemoryBudget::GetUsage() / (1024.0f * 1024.0f);
+        int budgetMB = (int)(Aether::GpuMemoryBudget::GetBudget() / (1024 * 1024));
+        ImGui::Text("Resident: %.1f MB", usageMB);
+        if (ImGui::SliderInt("Budget (MB, 0 = off)", &budgetMB, 0, 2048))
+            Aether::GpuMemoryBudget::SetBudget((uint64_t)budgetMB * 1024 * 1024);
+    }
     
     if (ImGui::CollapsingHeader("Camera", ImGuiTreeNodeFlags_DefaultOpen))
     {
@@ -149,6 +281,20 @@ void LabLayer::OnImGuiRender()
         }
     }
     
+    if (ImGui::CollapsingHeader("Picking", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        Aether::Mesh* mesh = m_HasPick ? Aether::MeshLibrary::Resolve(m_PickedMesh) : nullptr;
+        if (mesh && m_PickHit.Submesh < mesh->GetSubMeshes().size())
+        {
+            ImGui::Text("Selected: %s", mesh->GetSubMeshes()[m_PickHit.Submesh].NodeName.c_str());
+            ImGui::Text("Triangle %u at %.2f", m_PickHit.Triangle, m_PickHit.Distance);
+            ImGui::Text("BVH: %u triangles, %u nodes", mesh->GetBVH()->GetTriangleCount(), mesh->GetBVH()->GetNodeCount());
+        }
+        else
+            ImGui::Text("Selected: none (left click a mesh)");
+        ImGui::Text("Pick time: %.3f ms", m_PickTime);
+    }
+
     if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen))
     {
         ImGui::DragFloat3("Position", &m_ModelPos.x, 0.1f);
@@ -18,16 +18,60 @@ public:
     virtual void OnEvent(Aether::Event& event) override;
 
 private:
+    // Everything the render thread reads, copied out of the layer each frame so it replays
+    // one frame while the main thread builds the next
+    struct FrameData
+    {
+        uint32_t Width = 0, Height = 0;
+        glm::mat4 View, Projection;
+        glm::vec3 CameraPosition;
+        glm::mat4 Model;
+
+        struct Draw
+        {
+            Aether::MeshHandle Mesh;
+            uint32_t Submesh = 0;
+            float ScreenPixels = 0.0f;
+        };
+        // Submeshes that survived frustum culling
+        std::vector<Draw> Draws;
+    };
+
+    FrameData BuildFrameData();
+    void RenderFrame();
     void RenderScene();
     void LoadModelAsync(const std::string& path);
+    glm::mat4 GetModelTransform() const;
+
+    bool OnMouseButtonPressed(Aether::MouseButtonPressedEvent& e);
+    // Closest submesh under a window pixel, through each mesh's triangle BVH
+    void Pick(float x, float y);
 
 private:
     Aether::EditorCamera m_Camera;
+    std::vector<Aether::MeshHandle> m_Meshes;
+
+    // The frame being replayed and the GPU objects it draws with belong to the render thread
+    FrameData m_RenderFrame;
+    // Visible submeshes sharing a material and mesh go out as one instanced draw; the
+    // instance transform follows the four PBR vertex streams
+    Aether::DrawBatcher m_SceneBatch{ 4 };
     Aether::Ref<Aether::UniformBuffer> m_CameraUBO;
-    std::vector<Aether::UUID> m_MeshIDs;
+    Aether::Ref<Aether::Environment> m_Environment;
+
+    // One box per (mesh, submesh), culled on the main thread while the frame is built
+    Aether::FrustumCuller m_Culler;
+    std::vector<std::pair<Aether::MeshHandle, uint32_t>> m_CullItems;
+    std::vector<uint32_t> m_Visible;
+
+    // Picking
+    bool m_HasPick = false;
+    Aether::MeshHandle m_PickedMesh;
+    Aether::TriangleHit m_PickHit;
+    float m_PickTime = 0.0f;
     
     // Async loading
-    std::queue<Aether::ModelLoadResult> m_CompletedParses;
+    std::queue<Aether::Ref<Aether::ModelLoadResult>> m_CompletedParses;
     std::mutex m_ParseMutex;
     
     glm::vec3 m_ModelPos = glm::vec3(0.0f);
@@ -0,0 +1,255 @@
+#include "OcclusionCheckLayer.h"
+#include "Aether/Core/JobSystem.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <chrono>
+#include <random>
+
+namespace {
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double MillisecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    constexpr uint32_t s_OccluderCount = 48;
+    constexpr uint32_t s_BoxCount = 20000;
+    constexpr float s_OccluderHalfExtent = 1.5f;
+    // Per axis, corners included
+    constexpr uint32_t s_SamplesPerAxis = 4;
+
+    struct Scene
+    {
+        glm::vec3 Eye;
+        glm::mat4 ViewProjection, InverseViewProjection;
+        // World to occluder space, where each occluder is the box +-s_OccluderHalfExtent
+        std::vector<glm::mat4> WorldToOccluder;
+        float PixelWidth, PixelHeight;
+    };
+
+    // Exact: the segment from the eye to `point` against every occluder, off-screen points count as hidden
+    bool IsPointVisible(const Scene& scene, const glm::vec4& clip)
+    {
+        if (clip.w <= 0.0f)
+            return false;
+        glm::vec3 ndc = glm::vec3(clip) / clip.w;
+        if (std::abs(ndc.x) > 1.0f || std::abs(ndc.y) > 1.0f || std::abs(ndc.z) > 1.0f)
+            return false;
+
+        glm::vec4 world = scene.InverseViewProjection * clip;
+        glm::vec3 point = glm::vec3(world) / world.w;
+
+        Aether::AABB occluder = { glm::vec3(-s_OccluderHalfExtent), glm::vec3(s_OccluderHalfExtent) };
+        for (const auto& toLocal : scene.WorldToOccluder)
+        {
+            // Unnormalized, so the segment ends at a distance of 1
+            glm::vec3 origin = glm::vec3(toLocal * glm::vec4(scene.Eye, 1.0f));
+            glm::vec3 direction = glm::vec3(toLocal * glm::vec4(point - scene.Eye, 0.0f));
+            float distance;
+            if (Aether::Ray::Intersects(occluder, origin, 1.0f / direction, 1.0f, distance))
+                return false;
+        }
+        return true;
+    }
+
+    enum class Visibility { Hidden, NearEdge, Visible };
+
+    // Visible only when the samples a culler pixel away on all sides are too
+    Visibility SamplePoint(const Scene& scene, const glm::vec3& point)
+    {
+        glm::vec4 clip = scene.ViewProjection * glm::vec4(point, 1.0f);
+        if (!IsPointVisible(scene, clip))
+            return Visibility::Hidden;
+
+        for (int32_t y = -1; y <= 1; y++)
+        {
+            for (int32_t x = -1; x <= 1; x++)
+            {
+                glm::vec4 offset = clip;
+                offset.x += x * scene.PixelWidth * clip.w;
+                offset.y += y * scene.PixelHeight * clip.w;
+                if ((x || y) && !IsPointVisible(scene, offset))
+                    return Visibility::NearEdge;
+            }
+        }
+        return Visibility::Visible;
+    }
+
+    Visibility SampleBox(const Scene& scene, const glm::vec3& min, const glm::vec3& max)
+    {
+        Visibility result = Visibility::Hidden;
+        for (uint32_t z = 0; z < s_SamplesPerAxis; z++)
+        {
+            for (uint32_t y = 0; y < s_SamplesPerAxis; y++)
+            {
+                for (uint32_t x = 0; x < s_SamplesPerAxis; x++)
+                {
+                    glm::vec3 t = glm::vec3(x, y, z) / (float)(s_SamplesPerAxis - 1);
+                    Visibility sample = SamplePoint(scene, min + (max - min) * t);
+                    if (sample == Visibility::Visible)
+                        return sample;
+                    result = std::max(result, sample);
+                }
+            }
+        }
+        return result;
+    }
+}
+
+OcclusionCheckLayer::OcclusionCheckLayer()
+    : Layer("Occlusion Check")
+{
+    // CPU only
+    m_RenderThreadSafe = true;
+}
+
+void OcclusionCheckLayer::Attach()
+{
+    ImGuiContext* ctx = Aether::ImGuiLayer::GetContext();
+    if (ctx) ImGui::SetCurrentContext(ctx);
+
+    Run();
+}
+
+void OcclusionCheckLayer::Run()
+{
+    if (m_Running.exchange(true))
+        return;
+
+    Aether::JobSystem::SubmitJob([this]()
+    {
+        std::vector<Result> results;
+        for (uint32_t seed : { 1u, 2u, 3u, 4u })
+        {
+            Result result = RunScene(seed);
+            float culled = 100.0f * (result.InView - result.Kept) / std::max(result.InView, 1u);
+            if (result.Passed)
+                AE_INFO("Occlusion check scene {0}: passed, {1:.1f}% of {2} boxes culled ({3} fully hidden), {4} within a pixel of an edge, raster {5:.2f} ms, cull {6:.2f} ms",
+                    seed, culled, result.InView, result.ReferenceHidden, result.SubPixel, result.Rasterize, result.Cull);
+            else
+                AE_ERROR("Occlusion check scene {0}: FAILED, {1} boxes wrongly hidden", seed, result.WronglyHidden);
+            results.push_back(result);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_ResultMutex);
+            m_Results = std::move(results);
+        }
+        m_Running = false;
+    });
+}
+
+OcclusionCheckLayer::Result OcclusionCheckLayer::RunScene(uint32_t seed)
+{
+    Result result = {};
+    result.Seed = seed;
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    Aether::OcclusionCuller occlusion;
+
+    Scene scene;
+    scene.Eye = glm::vec3(0.0f);
+    glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+    scene.ViewProjection = projection * glm::lookAt(scene.Eye, glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    scene.InverseViewProjection = glm::inverse(scene.ViewProjection);
+    scene.PixelWidth = 2.0f / occlusion.GetWidth();
+    scene.PixelHeight = 2.0f / occlusion.GetHeight();
+
+    // A wall of tumbling crates in front, a field of small boxes well behind it
+    std::vector<glm::mat4> occluders(s_OccluderCount);
+    for (auto& transform : occluders)
+    {
+        transform = glm::translate(glm::mat4(1.0f), glm::vec3(unit(rng) * 12.0f, unit(rng) * 5.0f, -14.0f + unit(rng) * 4.0f));
+        transform = glm::rotate(transform, unit(rng) * 3.0f, glm::vec3(0.3f, 1.0f, 0.2f));
+        scene.WorldToOccluder.push_back(glm::inverse(transform));
+    }
+
+    Aether::FrustumCuller boxes;
+    boxes.Reserve(s_BoxCount);
+    for (uint32_t i = 0; i < s_BoxCount; i++)
+    {
+        glm::vec3 center(unit(rng) * 80.0f, unit(rng) * 30.0f, -120.0f - unit(rng) * 90.0f);
+        glm::vec3 extent(0.75f + unit(rng) * 0.5f);
+        boxes.Add(center - extent, center + extent);
+    }
+
+    std::vector<uint32_t> visible;
+    boxes.Cull(Aether::Frustum::FromViewProjection(scene.ViewProjection), visible);
+    result.InView = (uint32_t)visible.size();
+
+    auto start = Clock::now();
+    occlusion.BeginFrame(scene.ViewProjection);
+    for (const auto& transform : occluders)
+        occlusion.AddOccluderBox(glm::vec3(-s_OccluderHalfExtent), glm::vec3(s_OccluderHalfExtent), transform);
+    occlusion.Rasterize();
+    result.Rasterize = MillisecondsSince(start);
+
+    std::vector<uint32_t> inView = visible;
+    start = Clock::now();
+    occlusion.Cull(boxes, visible);
+    result.Cull = MillisecondsSince(start);
+    result.Kept = (uint32_t)visible.size();
+
+    // Both lists are in ascending order
+    auto kept = visible.begin();
+    for (uint32_t index : inView)
+    {
+        bool wasKept = kept != visible.end() && *kept == index;
+        if (wasKept)
+            kept++;
+
+        glm::vec3 min, max;
+        boxes.GetBounds(index, min, max);
+        Visibility reference = SampleBox(scene, min, max);
+        if (reference == Visibility::Hidden)
+            result.ReferenceHidden++;
+        else if (!wasKept && reference == Visibility::NearEdge)
+            result.SubPixel++;
+        else if (!wasKept)
+            result.WronglyHidden++;
+    }
+
+    result.Passed = result.WronglyHidden == 0;
+    return result;
+}
+
+void OcclusionCheckLayer::OnImGuiRender()
+{
+    ImGui::Begin("Occlusion Check");
+
+    if (m_Running)
+        ImGui::Text("Running...");
+    else if (ImGui::Button("Run Again"))
+        Run();
+
+    std::lock_guard<std::mutex> lock(m_ResultMutex);
+    if (ImGui::BeginTable("Results", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Scene");
+        ImGui::TableSetupColumn("Culled");
+        ImGui::TableSetupColumn("Fully Hidden");
+        ImGui::TableSetupColumn("Near Edge");
+        ImGui::TableSetupColumn("Wrongly Hidden");
+        ImGui::TableSetupColumn("Raster / Cull (ms)");
+        ImGui::TableSetupColumn("Result");
+        ImGui::TableHeadersRow();
+
+        for (const auto& result : m_Results)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("%u", result.Seed);
+            ImGui::TableNextColumn(); ImGui::Text("%u / %u", result.InView - result.Kept, result.InView);
+            ImGui::TableNextColumn(); ImGui::Text("%u", result.ReferenceHidden);
+            ImGui::TableNextColumn(); ImGui::Text("%u", result.SubPixel);
+            ImGui::TableNextColumn(); ImGui::Text("%u", result.WronglyHidden);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f / %.2f", result.Rasterize, result.Cull);
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(result.Passed ? "Pass" : "FAIL");
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
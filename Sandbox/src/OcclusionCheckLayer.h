@@ -0,0 +1,43 @@
+#pragma once
+#include <Aether.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Checks OcclusionCuller on random boxes behind box occluders against an exact reference: every
+// box it hides is sampled, and each sample's line of sight is ray tested against the occluders.
+// CPU only; runs on a worker and logs each scene, so it works headless too.
+class OcclusionCheckLayer : public Aether::Layer
+{
+public:
+    OcclusionCheckLayer();
+    virtual ~OcclusionCheckLayer() = default;
+
+    virtual void Attach() override;
+    virtual void OnImGuiRender() override;
+
+private:
+    struct Result
+    {
+        uint32_t Seed;
+        uint32_t InView, Kept;
+        // Boxes the reference finds fully hidden; the culler can't do better than this
+        uint32_t ReferenceHidden;
+        // Hidden boxes with a sample in view within a culler pixel of an occluder edge. Expected:
+        // coverage is decided at pixel centers.
+        uint32_t SubPixel;
+        // Hidden boxes with a sample in plain view; must be 0
+        uint32_t WronglyHidden;
+        // Milliseconds
+        double Rasterize, Cull;
+        bool Passed;
+    };
+
+    void Run();
+    static Result RunScene(uint32_t seed);
+
+private:
+    std::vector<Result> m_Results;
+    std::mutex m_ResultMutex;
+    std::atomic<bool> m_Running = false;
+};
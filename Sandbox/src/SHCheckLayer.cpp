@@ -0,0 +1,145 @@
+#include "SHCheckLayer.h"
+#include "Aether/Core/JobSystem.h"
+#include "Aether/Resources/EnvironmentBaker.h"
+
+namespace {
+
+    constexpr float s_Pi = 3.14159265358979f;
+    // Texel quadrature error at this size is ~2e-5 for the lobes below
+    constexpr uint32_t s_FaceSize = 64;
+    constexpr float s_Tolerance = 1e-3f;
+
+    // Clamped cosine max(0, w . axis) projects onto A_l * Y_lm(axis): pi, 2pi/3 and pi/4 per band
+    std::array<glm::vec3, 9> CosineLobeCoefficients(const glm::vec3& axis, const glm::vec3& color)
+    {
+        static constexpr float s_Band[9] = { s_Pi, 2.0f * s_Pi / 3.0f, 2.0f * s_Pi / 3.0f, 2.0f * s_Pi / 3.0f,
+            s_Pi / 4.0f, s_Pi / 4.0f, s_Pi / 4.0f, s_Pi / 4.0f, s_Pi / 4.0f };
+
+        auto basis = Aether::SH9::EvaluateBasis(axis);
+        std::array<glm::vec3, 9> coefficients;
+        for (uint32_t i = 0; i < 9; i++)
+            coefficients[i] = color * (s_Band[i] * basis[i]);
+        return coefficients;
+    }
+}
+
+SHCheckLayer::SHCheckLayer()
+    : Layer("SH Check")
+{
+    // CPU only
+    m_RenderThreadSafe = true;
+}
+
+void SHCheckLayer::Attach()
+{
+    ImGuiContext* ctx = Aether::ImGuiLayer::GetContext();
+    if (ctx) ImGui::SetCurrentContext(ctx);
+
+    Run();
+}
+
+void SHCheckLayer::Run()
+{
+    if (m_Running.exchange(true))
+        return;
+
+    Aether::JobSystem::SubmitJob([this]()
+    {
+        std::vector<Result> results;
+
+        // Only the DC term survives: L * Y_00 * 4pi = 2 sqrt(pi) L
+        glm::vec3 constant(1.0f, 0.5f, 2.0f);
+        std::array<glm::vec3, 9> flat{};
+        flat[0] = constant * 2.0f * std::sqrt(s_Pi);
+        results.push_back(RunCase("Constant", [constant](const glm::vec3&) { return constant; }, flat));
+
+        // A lobe off every axis catches sign and axis mix-ups in the basis; one straight down
+        // checks the cube face orientation
+        std::pair<const char*, glm::vec3> lobes[] = {
+            { "Cosine lobe, oblique", glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)) },
+            { "Cosine lobe, -Y", glm::vec3(0.0f, -1.0f, 0.0f) }
+        };
+        for (const auto& [name, axis] : lobes)
+        {
+            glm::vec3 color(1.0f, 0.25f, 0.5f);
+            glm::vec3 lobeAxis = axis;
+            auto lobe = [lobeAxis, color](const glm::vec3& direction) { return color * std::max(glm::dot(direction, lobeAxis), 0.0f); };
+            results.push_back(RunCase(name, lobe, CosineLobeCoefficients(axis, color)));
+        }
+
+        for (const auto& result : results)
+        {
+            if (result.Passed)
+                AE_INFO("SH check '{0}': passed, max error {1:.2e}", result.Name, result.MaxError);
+            else
+                AE_ERROR("SH check '{0}': FAILED, max error {1:.2e} (tolerance {2:.0e})", result.Name, result.MaxError, s_Tolerance);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_ResultMutex);
+            m_Results = std::move(results);
+        }
+        m_Running = false;
+    });
+}
+
+SHCheckLayer::Result SHCheckLayer::RunCase(const std::string& name, const RadianceFn& radiance, const std::array<glm::vec3, 9>& expected)
+{
+    // Texel centers and directions exactly as ProjectSH walks them
+    Aether::CubemapData cubemap;
+    cubemap.Allocate(s_FaceSize, 1);
+    for (uint32_t face = 0; face < 6; face++)
+    {
+        glm::vec4* texels = cubemap.GetFace(0, face);
+        for (uint32_t y = 0; y < s_FaceSize; y++)
+        {
+            float t = (y + 0.5f) / s_FaceSize * 2.0f - 1.0f;
+            for (uint32_t x = 0; x < s_FaceSize; x++)
+            {
+                float s = (x + 0.5f) / s_FaceSize * 2.0f - 1.0f;
+                texels[(size_t)y * s_FaceSize + x] = glm::vec4(radiance(Aether::CubemapData::TexelDirection(face, s, t)), 1.0f);
+            }
+        }
+    }
+
+    Aether::SH9 sh = Aether::EnvironmentBaker::ProjectSH(cubemap);
+
+    Result result = { name, 0.0f, true };
+    for (uint32_t i = 0; i < 9; i++)
+    {
+        glm::vec3 error = glm::abs(sh.Coefficients[i] - expected[i]);
+        result.MaxError = std::max(result.MaxError, std::max(error.x, std::max(error.y, error.z)));
+    }
+    result.Passed = result.MaxError <= s_Tolerance;
+    return result;
+}
+
+void SHCheckLayer::OnImGuiRender()
+{
+    ImGui::Begin("SH Check");
+
+    if (m_Running)
+        ImGui::Text("Running...");
+    else if (ImGui::Button("Run Again"))
+        Run();
+
+    std::lock_guard<std::mutex> lock(m_ResultMutex);
+    if (ImGui::BeginTable("Results", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Case");
+        ImGui::TableSetupColumn("Max Error");
+        ImGui::TableSetupColumn("Result");
+        ImGui::TableHeadersRow();
+
+        for (const auto& result : m_Results)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(result.Name.c_str());
+            ImGui::TableNextColumn(); ImGui::Text("%.2e", result.MaxError);
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(result.Passed ? "Pass" : "FAIL");
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
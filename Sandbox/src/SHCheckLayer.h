@@ -0,0 +1,37 @@
+#pragma once
+#include <Aether.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Checks EnvironmentBaker::ProjectSH against radiance fields whose SH9 projection is known in
+// closed form. CPU only; runs on a worker and logs each case, so it works headless too.
+class SHCheckLayer : public Aether::Layer
+{
+public:
+    SHCheckLayer();
+    virtual ~SHCheckLayer() = default;
+
+    virtual void Attach() override;
+    virtual void OnImGuiRender() override;
+
+private:
+    struct Result
+    {
+        std::string Name;
+        // Largest difference over all 27 coefficients
+        float MaxError;
+        bool Passed;
+    };
+
+    using RadianceFn = std::function<glm::vec3(const glm::vec3&)>;
+
+    void Run();
+    static Result RunCase(const std::string& name, const RadianceFn& radiance, const std::array<glm::vec3, 9>& expected);
+
+private:
+    std::vector<Result> m_Results;
+    std::mutex m_ResultMutex;
+    std::atomic<bool> m_Running = false;
+};
@@ -1,12 +1,20 @@
 #include "Aether/Core/EntryPoint.h"
 #include "DemoLayer.h"
 #include "LabLayer.h"
+#include "BVHBenchmarkLayer.h"
+#include "SHCheckLayer.h"
+#include "OcclusionCheckLayer.h"
+#include "TriangleBVHCheckLayer.h"
 
 class Sandbox : public Aether::Application {
 public:
     Sandbox() { 
         //PushLayer(new DemoLayer()); 
         PushLayer(new LabLayer());
+        //PushLayer(new BVHBenchmarkLayer());
+        //PushLayer(new SHCheckLayer());
+        //PushLayer(new OcclusionCheckLayer());
+        //PushLayer(new TriangleBVHCheckLayer());
     }
     ~Sandbox() {}
 };
@@ -0,0 +1,308 @@
+#include "TriangleBVHCheckLayer.h"
+#include "Aether/Core/JobSystem.h"
+#include <chrono>
+#include <random>
+
+namespace {
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    double MicrosecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    }
+
+    // 2 * 300 * 300 sphere triangles plus the loose ones make 200k
+    constexpr uint32_t s_SphereSegments = 300;
+    constexpr uint32_t s_LooseTriangles = 20000;
+    constexpr uint32_t s_RaysPerSet = 1000;
+    // Both sides run the same arithmetic; this only absorbs compilers contracting it differently
+    constexpr float s_Tolerance = 1e-5f;
+
+    struct TestMesh
+    {
+        std::vector<float> Positions;
+        std::vector<uint32_t> Indices;
+        std::vector<Aether::TriangleRange> Submeshes;
+
+        glm::vec3 GetVertex(const Aether::TriangleRange& range, uint32_t index) const
+        {
+            uint32_t vertex = range.BaseVertex + Indices[range.BaseIndex + index];
+            return { Positions[vertex * 3 + 0], Positions[vertex * 3 + 1], Positions[vertex * 3 + 2] };
+        }
+    };
+
+    TestMesh BuildMesh(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        constexpr float pi = 3.14159265358979f;
+        TestMesh mesh;
+
+        // Unit sphere: long thin triangles near the poles, shared edges everywhere else
+        for (uint32_t i = 0; i <= s_SphereSegments; i++)
+        {
+            for (uint32_t j = 0; j <= s_SphereSegments; j++)
+            {
+                float theta = pi * i / s_SphereSegments, phi = 2.0f * pi * j / s_SphereSegments;
+                mesh.Positions.insert(mesh.Positions.end(), { std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi) });
+            }
+        }
+        for (uint32_t i = 0; i < s_SphereSegments; i++)
+        {
+            for (uint32_t j = 0; j < s_SphereSegments; j++)
+            {
+                uint32_t a = i * (s_SphereSegments + 1) + j, b = a + 1, c = a + s_SphereSegments + 1, d = c + 1;
+                mesh.Indices.insert(mesh.Indices.end(), { a, c, b, b, c, d });
+            }
+        }
+        mesh.Submeshes.push_back({ 0, 0, (uint32_t)mesh.Indices.size() });
+
+        // Small overlapping triangles in and around it, indexed from their own base vertex
+        Aether::TriangleRange loose = { (uint32_t)mesh.Positions.size() / 3, (uint32_t)mesh.Indices.size(), s_LooseTriangles * 3 };
+        for (uint32_t i = 0; i < s_LooseTriangles * 3; i++)
+        {
+            if (i % 3 == 0)
+            {
+                glm::vec3 center(unit(rng) * 3.0f, unit(rng) * 3.0f, unit(rng) * 3.0f);
+                for (uint32_t k = 0; k < 3; k++)
+                    mesh.Positions.insert(mesh.Positions.end(), { center.x + unit(rng) * 0.1f, center.y + unit(rng) * 0.1f, center.z + unit(rng) * 0.1f });
+            }
+            mesh.Indices.push_back(i);
+        }
+        mesh.Submeshes.push_back(loose);
+        return mesh;
+    }
+
+    // The same Moller-Trumbore test RayCast runs, so the two agree up to rounding
+    bool IntersectTriangle(const Aether::Ray& ray, const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2, float maxDistance, float& t, float& u, float& v)
+    {
+        glm::vec3 edge1 = v1 - v0, edge2 = v2 - v0;
+        glm::vec3 h = glm::cross(ray.Direction, edge2);
+        float a = glm::dot(edge1, h);
+        if (a == 0.0f)
+            return false;
+
+        float f = 1.0f / a;
+        glm::vec3 s = ray.Origin - v0;
+        u = f * glm::dot(s, h);
+        if (u < 0.0f || u > 1.0f)
+            return false;
+
+        glm::vec3 q = glm::cross(s, edge1);
+        v = f * glm::dot(ray.Direction, q);
+        if (v < 0.0f || u + v > 1.0f)
+            return false;
+
+        t = f * glm::dot(edge2, q);
+        return t >= 0.0f && t <= maxDistance;
+    }
+
+    bool BruteForceRayCast(const TestMesh& mesh, const Aether::Ray& ray, float maxDistance, float& distance)
+    {
+        bool found = false;
+        distance = maxDistance;
+        for (const auto& range : mesh.Submeshes)
+        {
+            for (uint32_t i = 0; i < range.IndexCount; i += 3)
+            {
+                float t, u, v;
+                if (IntersectTriangle(ray, mesh.GetVertex(range, i), mesh.GetVertex(range, i + 1), mesh.GetVertex(range, i + 2), distance, t, u, v))
+                {
+                    distance = t;
+                    found = true;
+                }
+            }
+        }
+        return found;
+    }
+
+    struct RaySet
+    {
+        const char* Name;
+        std::vector<Aether::Ray> Rays;
+        std::vector<float> MaxDistances;
+    };
+
+    // Directions are left unnormalized on purpose: distances are in multiples of them
+    std::vector<RaySet> BuildRaySets(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::vector<RaySet> sets(4);
+        sets[0].Name = "Aimed at the mesh";
+        sets[1].Name = "Random origins and directions";
+        sets[2].Name = "Aimed, cut off halfway";
+        sets[3].Name = "Axis aligned";
+
+        for (uint32_t i = 0; i < s_RaysPerSet; i++)
+        {
+            glm::vec3 origin = glm::normalize(glm::vec3(unit(rng), unit(rng), unit(rng))) * 6.0f;
+            glm::vec3 target(unit(rng) * 2.0f, unit(rng) * 2.0f, unit(rng) * 2.0f);
+            float scale = 0.5f + (unit(rng) + 1.0f) * 2.0f;
+            Aether::Ray aimed = { origin, (target - origin) / scale };
+            sets[0].Rays.push_back(aimed);
+            sets[0].MaxDistances.push_back(FLT_MAX);
+
+            sets[1].Rays.push_back({ glm::vec3(unit(rng), unit(rng), unit(rng)) * 5.0f, glm::vec3(unit(rng), unit(rng), unit(rng)) * scale });
+            sets[1].MaxDistances.push_back(FLT_MAX);
+
+            // `target` sits at distance `scale`
+            sets[2].Rays.push_back(aimed);
+            sets[2].MaxDistances.push_back(scale * 0.5f);
+
+            // Zero direction components give infinite slabs in the node tests
+            glm::vec3 direction(0.0f);
+            direction[i % 3] = (i & 4) ? scale : -scale;
+            glm::vec3 start(unit(rng) * 1.5f, unit(rng) * 1.5f, unit(rng) * 1.5f);
+            start[i % 3] = (i & 4) ? -5.0f : 5.0f;
+            sets[3].Rays.push_back({ start, direction });
+            sets[3].MaxDistances.push_back(FLT_MAX);
+        }
+        return sets;
+    }
+}
+
+TriangleBVHCheckLayer::TriangleBVHCheckLayer()
+    : Layer("Triangle BVH Check")
+{
+    // CPU only
+    m_RenderThreadSafe = true;
+}
+
+void TriangleBVHCheckLayer::Attach()
+{
+    ImGuiContext* ctx = Aether::ImGuiLayer::GetContext();
+    if (ctx) ImGui::SetCurrentContext(ctx);
+
+    Run();
+}
+
+void TriangleBVHCheckLayer::Run()
+{
+    if (m_Running.exchange(true))
+        return;
+
+    Aether::JobSystem::SubmitJob([this]()
+    {
+        std::mt19937 rng(3);
+        TestMesh mesh = BuildMesh(rng);
+
+        auto start = Clock::now();
+        Aether::TriangleBVH bvh(mesh.Positions.data(), (uint32_t)mesh.Positions.size() / 3, mesh.Indices.data(), mesh.Submeshes);
+        double buildTime = MicrosecondsSince(start) / 1000.0;
+        AE_INFO("Triangle BVH check: {0} triangles, {1} nodes, built in {2:.1f} ms", bvh.GetTriangleCount(), bvh.GetNodeCount(), buildTime);
+
+        {
+            std::lock_guard<std::mutex> lock(m_ResultMutex);
+            m_Results.clear();
+            m_TriangleCount = bvh.GetTriangleCount();
+            m_NodeCount = bvh.GetNodeCount();
+            m_BuildTime = buildTime;
+        }
+
+        for (const auto& set : BuildRaySets(rng))
+        {
+            uint32_t count = (uint32_t)set.Rays.size();
+            Result result = { set.Name, count, 0, 0, 0.0, 0.0, true };
+
+            std::vector<Aether::TriangleHit> hits(count);
+            std::vector<char> found(count);
+            start = Clock::now();
+            for (uint32_t i = 0; i < count; i++)
+                found[i] = bvh.RayCast(set.Rays[i], set.MaxDistances[i], hits[i]);
+            result.TreeRay = MicrosecondsSince(start) / count;
+
+            // Brute force is timed per ray and summed, so the figure is per ray on one core
+            std::vector<char> mismatched(count);
+            std::vector<double> bruteTime(count);
+            Aether::JobSystem::ParallelFor(count, 8, [&](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; i++)
+                {
+                    const Aether::Ray& ray = set.Rays[i];
+                    auto rayStart = Clock::now();
+                    float distance;
+                    bool reference = BruteForceRayCast(mesh, ray, set.MaxDistances[i], distance);
+                    bruteTime[i] = MicrosecondsSince(rayStart);
+
+                    if (reference != (bool)found[i])
+                    {
+                        mismatched[i] = true;
+                        continue;
+                    }
+                    if (!reference)
+                        continue;
+
+                    // Ties between triangles may pick either, but the one reported has to be hit where it says
+                    const Aether::TriangleHit& hit = hits[i];
+                    float tolerance = s_Tolerance * std::max(1.0f, distance);
+                    bool same = std::abs(hit.Distance - distance) <= tolerance && hit.Submesh < mesh.Submeshes.size();
+                    if (same)
+                    {
+                        const auto& range = mesh.Submeshes[hit.Submesh];
+                        float t, u, v;
+                        same = hit.Triangle * 3 < range.IndexCount
+                            && IntersectTriangle(ray, mesh.GetVertex(range, hit.Triangle * 3), mesh.GetVertex(range, hit.Triangle * 3 + 1),
+                                mesh.GetVertex(range, hit.Triangle * 3 + 2), FLT_MAX, t, u, v)
+                            && std::abs(t - hit.Distance) <= tolerance && std::abs(u - hit.U) <= s_Tolerance && std::abs(v - hit.V) <= s_Tolerance;
+                    }
+                    mismatched[i] = !same;
+                }
+            });
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                result.Hits += found[i];
+                result.Mismatches += mismatched[i];
+                result.BruteRay += bruteTime[i];
+            }
+            result.BruteRay /= count;
+            result.Passed = result.Mismatches == 0;
+
+            if (result.Passed)
+                AE_INFO("Triangle BVH check '{0}': passed, {1}/{2} hits, {3:.2f} us/ray (brute {4:.0f})", result.Name, result.Hits, result.Rays, result.TreeRay, result.BruteRay);
+            else
+                AE_ERROR("Triangle BVH check '{0}': FAILED, {1} of {2} rays differ from brute force", result.Name, result.Mismatches, result.Rays);
+
+            std::lock_guard<std::mutex> lock(m_ResultMutex);
+            m_Results.push_back(result);
+        }
+        m_Running = false;
+    });
+}
+
+void TriangleBVHCheckLayer::OnImGuiRender()
+{
+    ImGui::Begin("Triangle BVH Check");
+
+    if (m_Running)
+        ImGui::Text("Running...");
+    else if (ImGui::Button("Run Again"))
+        Run();
+
+    std::lock_guard<std::mutex> lock(m_ResultMutex);
+    if (m_TriangleCount)
+        ImGui::Text("%u triangles, %u nodes, built in %.1f ms", m_TriangleCount, m_NodeCount, m_BuildTime);
+
+    if (ImGui::BeginTable("Results", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Rays");
+        ImGui::TableSetupColumn("Hits");
+        ImGui::TableSetupColumn("Mismatches");
+        ImGui::TableSetupColumn("us/ray (brute)");
+        ImGui::TableSetupColumn("Result");
+        ImGui::TableHeadersRow();
+
+        for (const auto& result : m_Results)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(result.Name.c_str());
+            ImGui::TableNextColumn(); ImGui::Text("%u / %u", result.Hits, result.Rays);
+            ImGui::TableNextColumn(); ImGui::Text("%u", result.Mismatches);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f (%.0f)", result.TreeRay, result.BruteRay);
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(result.Passed ? "Pass" : "FAIL");
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
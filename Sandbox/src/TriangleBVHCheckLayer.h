@@ -0,0 +1,39 @@
+#pragma once
+#include <Aether.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Checks TriangleBVH::RayCast against brute force over every triangle of a 200k triangle mesh:
+// a finely tessellated sphere plus a cloud of loose triangles, as two submeshes. CPU only; runs
+// on a worker and logs each ray set, so it works headless too.
+class TriangleBVHCheckLayer : public Aether::Layer
+{
+public:
+    TriangleBVHCheckLayer();
+    virtual ~TriangleBVHCheckLayer() = default;
+
+    virtual void Attach() override;
+    virtual void OnImGuiRender() override;
+
+private:
+    struct Result
+    {
+        std::string Name;
+        uint32_t Rays, Hits;
+        // Rays where the hit, its distance or the triangle reported for it differ from brute force
+        uint32_t Mismatches;
+        // Microseconds per ray
+        double TreeRay, BruteRay;
+        bool Passed;
+    };
+
+    void Run();
+
+private:
+    std::vector<Result> m_Results;
+    uint32_t m_TriangleCount = 0, m_NodeCount = 0;
+    double m_BuildTime = 0.0;
+    std::mutex m_ResultMutex;
+    std::atomic<bool> m_Running = false;
+};
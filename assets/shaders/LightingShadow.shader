@@ -10,21 +10,14 @@ layout(location = 2) in vec2 a_TexCoord;
 layout(location = 3) in mat4 a_InstanceModel;
 
 // Camera Uniform Block
-layout (std140) uniform CameraData
-{
-    mat4 u_Projection;
-    mat4 u_View;
-    vec3 u_ViewPos;
-};
+#include "Camera.glsl"
 
 uniform mat4 u_Model;            
-uniform mat4 u_LightSpaceMatrix;
 uniform bool u_UseInstancing;    
 
 out vec3 v_FragPos;
 out vec3 v_Normal;
 out vec2 v_TexCoord;
-out vec4 v_FragPosLightSpace;
 
 void main()
 {
@@ -38,9 +31,8 @@ void main()
     v_Normal = mat3(transpose(inverse(model))) * a_Normal;
     
     v_TexCoord = a_TexCoord;
-    v_FragPosLightSpace = u_LightSpaceMatrix * worldPos;
     
-    gl_Position = u_Projection * u_View * worldPos;
+    gl_Position = u_ViewProjection * worldPos;
 }
 
 #shader fragment
@@ -51,20 +43,20 @@ layout(location = 0) out vec4 color;
 in vec3 v_FragPos;
 in vec3 v_Normal;
 in vec2 v_TexCoord;
-in vec4 v_FragPosLightSpace;
 
-// --- SỬA LỖI: Thêm Uniform Block CameraData vào Fragment Shader để lấy u_ViewPos ---
-layout (std140) uniform CameraData
-{
-    mat4 u_Projection;
-    mat4 u_View;
-    vec3 u_ViewPos;
-};
-// ----------------------------------------------------------------------------------
+#include "Camera.glsl"
 
 uniform sampler2D u_Texture;
-uniform sampler2D u_ShadowMap;
-
+// One layer per cascade; a spotlight uses layer 0 alone
+uniform sampler2DArray u_ShadowMap;
+uniform mat4 u_LightSpaceMatrices[4];
+uniform int u_CascadeCount;
+// View-space depth where each cascade ends, and its depth bias
+uniform vec4 u_CascadeSplits;
+uniform vec4 u_CascadeBias;
+uniform bool u_ShowCascades;
+
+uniform bool u_DirectionalLight;
 uniform vec3 u_LightPos;
 uniform vec3 u_LightDir;
 uniform float u_CutOff;
@@ -79,26 +71,38 @@ uniform vec3 u_FogColor;
 uniform float u_FogStart;
 uniform float u_FogEnd;
 
-float ShadowCalculation(vec4 fragPosLightSpace)
+int SelectCascade()
+{
+    float viewDepth = -(u_View * vec4(v_FragPos, 1.0)).z;
+    for (int i = 0; i < u_CascadeCount; ++i)
+    {
+        if (viewDepth < u_CascadeSplits[i])
+            return i;
+    }
+    // Past the shadow distance
+    return -1;
+}
+
+float ShadowCalculation(int cascade, vec3 normal, vec3 lightDir)
 {
+    if (cascade < 0) return 0.0;
+
+    vec4 fragPosLightSpace = u_LightSpaceMatrices[cascade] * vec4(v_FragPos, 1.0);
     vec3 projCoords = fragPosLightSpace.xyz / fragPosLightSpace.w;
     projCoords = projCoords * 0.5 + 0.5;
     if(projCoords.z > 1.0) return 0.0;
     
-    float closestDepth = texture(u_ShadowMap, projCoords.xy).r; 
     float currentDepth = projCoords.z;
     
-    vec3 normal = normalize(v_Normal);
-    vec3 lightDir = normalize(u_LightPos - v_FragPos);
-    float bias = max(0.005 * (1.0 - dot(normal, lightDir)), 0.0005);  
+    float bias = max(u_CascadeBias[cascade] * (1.0 - dot(normal, lightDir)), u_CascadeBias[cascade] * 0.1);  
 
     float shadow = 0.0;
-    vec2 texelSize = 1.0 / textureSize(u_ShadowMap, 0);
+    vec2 texelSize = 1.0 / vec2(textureSize(u_ShadowMap, 0).xy);
     for(int x = -1; x <= 1; ++x)
     {
         for(int y = -1; y <= 1; ++y)
         {
-            float pcfDepth = texture(u_ShadowMap, projCoords.xy + vec2(x, y) * texelSize).r; 
+            float pcfDepth = texture(u_ShadowMap, vec3(projCoords.xy + vec2(x, y) * texelSize, cascade)).r; 
             shadow += currentDepth - bias > pcfDepth ? 1.0 : 0.0;        
         }    
     }
@@ -115,7 +119,7 @@ void main()
     }
 
     vec3 normal = normalize(v_Normal);
-    vec3 lightDir = normalize(u_LightPos - v_FragPos);
+    vec3 lightDir = u_DirectionalLight ? normalize(-u_LightDir) : normalize(u_LightPos - v_FragPos);
     
     // Ambient
     float ambientStrength = 0.1;
@@ -126,30 +130,37 @@ void main()
     vec3 diffuse = diff * texture(u_Texture, v_TexCoord).rgb;
     
     // Specular (Blinn-Phong)
-    // u_ViewPos giờ đã được khai báo qua Uniform Block ở trên
-    vec3 viewDir = normalize(u_ViewPos - v_FragPos);
+    vec3 viewDir = normalize(u_CameraPosition - v_FragPos);
     vec3 halfwayDir = normalize(lightDir + viewDir);
     float spec = pow(max(dot(normal, halfwayDir), 0.0), 32.0);
     vec3 specular = vec3(0.5) * spec; 
     
     // Spotlight (Soft edges)
-    float theta = dot(lightDir, normalize(-u_LightDir)); 
-    float epsilon = (u_CutOff - u_OuterCutOff);
-    float intensity = clamp((theta - u_OuterCutOff) / epsilon, 0.0, 1.0);
-    
-    diffuse  *= intensity;
-    specular *= intensity;
+    if (!u_DirectionalLight) {
+        float theta = dot(lightDir, normalize(-u_LightDir)); 
+        float epsilon = (u_CutOff - u_OuterCutOff);
+        float intensity = clamp((theta - u_OuterCutOff) / epsilon, 0.0, 1.0);
+        
+        diffuse  *= intensity;
+        specular *= intensity;
+    }
     
     // Shadow
-    float shadow = ShadowCalculation(v_FragPosLightSpace);       
+    int cascade = SelectCascade();
+    float shadow = ShadowCalculation(cascade, normal, lightDir);       
     vec3 lighting = (ambient + (1.0 - shadow) * (diffuse + specular));
+
+    if (u_ShowCascades && cascade >= 0) {
+        const vec3 cascadeColors[4] = vec3[4](vec3(1.0, 0.3, 0.3), vec3(0.3, 1.0, 0.3), vec3(0.3, 0.3, 1.0), vec3(1.0, 1.0, 0.3));
+        lighting *= cascadeColors[cascade];
+    }
     
     vec4 finalColor = vec4(lighting, 1.0);
 
     // Fog calculation
     if (u_FogEnabled) {
         // SỬA LỖI: Đổi tên biến 'distance' thành 'viewDist' để không trùng hàm có sẵn
-        float viewDist = length(u_ViewPos - v_FragPos);
+        float viewDist = length(u_CameraPosition - v_FragPos);
         float fogFactor = (u_FogEnd - viewDist) / (u_FogEnd - u_FogStart);
         fogFactor = clamp(fogFactor, 0.0, 1.0);
         finalColor = mix(vec4(u_FogColor, 1.0), finalColor, fogFactor);
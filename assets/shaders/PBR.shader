@@ -5,15 +5,13 @@ layout(location = 0) in vec3 a_Position;
 layout(location = 1) in vec3 a_Normal;
 layout(location = 2) in vec4 a_Tangent;
 layout(location = 3) in vec2 a_TexCoord;
+// Set by DrawBatcher when it draws instanced
+layout(location = 4) in mat4 a_InstanceModel;
 
-layout(std140) uniform Camera
-{
-    mat4 u_ViewProjection;
-    mat4 u_View;
-    vec3 u_CameraPosition;
-};
+#include "Camera.glsl"
 
 uniform mat4 u_Model;
+uniform bool u_UseInstancing;
 
 out vec3 v_FragPos;
 out vec3 v_Normal;
@@ -23,10 +21,11 @@ out vec3 v_Bitangent;
 
 void main()
 {
-    vec4 worldPos = u_Model * vec4(a_Position, 1.0);
+    mat4 model = u_UseInstancing ? a_InstanceModel : u_Model;
+    vec4 worldPos = model * vec4(a_Position, 1.0);
     v_FragPos = worldPos.xyz;
     
-    mat3 normalMatrix = transpose(inverse(mat3(u_Model)));
+    mat3 normalMatrix = transpose(inverse(mat3(model)));
     v_Normal = normalize(normalMatrix * a_Normal);
     v_Tangent = normalize(normalMatrix * a_Tangent.xyz);
     v_Bitangent = cross(v_Normal, v_Tangent) * a_Tangent.w;
@@ -47,12 +46,7 @@ in vec2 v_TexCoord;
 in vec3 v_Tangent;
 in vec3 v_Bitangent;
 
-layout(std140) uniform Camera
-{
-    mat4 u_ViewProjection;
-    mat4 u_View;
-    vec3 u_CameraPosition;
-};
+#include "Camera.glsl"
 
 uniform sampler2D u_AlbedoMap;
 uniform sampler2D u_MetallicRoughnessMap;
@@ -63,52 +57,13 @@ uniform float u_Metallic;
 uniform float u_Roughness;
 uniform int u_HasNormalMap;
 
-const float PI = 3.14159265359;
+#include "BRDF.glsl"
+#include "IBL.glsl"
 
 // Simple directional light
 vec3 g_LightDir = normalize(vec3(0.3, -1.0, 0.5));
 vec3 g_LightColor = vec3(1.0);
 
-float DistributionGGX(vec3 N, vec3 H, float roughness)
-{
-    float a = roughness * roughness;
-    float a2 = a * a;
-    float NdotH = max(dot(N, H), 0.0);
-    float NdotH2 = NdotH * NdotH;
-    
-    float num = a2;
-    float denom = (NdotH2 * (a2 - 1.0) + 1.0);
-    denom = PI * denom * denom;
-    
-    return num / denom;
-}
-
-float GeometrySchlickGGX(float NdotV, float roughness)
-{
-    float r = (roughness + 1.0);
-    float k = (r * r) / 8.0;
-    
-    float num = NdotV;
-    float denom = NdotV * (1.0 - k) + k;
-    
-    return num / denom;
-}
-
-float GeometrySmith(vec3 N, vec3 V, vec3 L, float roughness)
-{
-    float NdotV = max(dot(N, V), 0.0);
-    float NdotL = max(dot(N, L), 0.0);
-    float ggx2 = GeometrySchlickGGX(NdotV, roughness);
-    float ggx1 = GeometrySchlickGGX(NdotL, roughness);
-    
-    return ggx1 * ggx2;
-}
-
-vec3 FresnelSchlick(float cosTheta, vec3 F0)
-{
-    return F0 + (1.0 - F0) * pow(clamp(1.0 - cosTheta, 0.0, 1.0), 5.0);
-}
-
 void main()
 {
     // Sample textures
@@ -121,7 +76,10 @@ void main()
     vec3 N = v_Normal;
     if (u_HasNormalMap == 1)
     {
-        vec3 tangentNormal = texture(u_NormalMap, v_TexCoord).xyz * 2.0 - 1.0;
+        // Only xy is stored for BC5 normal maps, so z is rebuilt from the unit length
+        vec3 tangentNormal;
+        tangentNormal.xy = texture(u_NormalMap, v_TexCoord).xy * 2.0 - 1.0;
+        tangentNormal.z = sqrt(max(1.0 - dot(tangentNormal.xy, tangentNormal.xy), 0.0));
         mat3 TBN = mat3(v_Tangent, v_Bitangent, v_Normal);
         N = normalize(TBN * tangentNormal);
     }
@@ -152,6 +110,8 @@ void main()
     
     // Ambient
     vec3 ambient = vec3(0.03) * albedo.rgb;
+    if (u_HasEnvironment == 1)
+        ambient = AmbientIBL(N, V, albedo.rgb, F0, metallic, roughness);
     vec3 color = ambient + Lo;
     
     // Gamma correction
@@ -4,12 +4,7 @@ layout(location = 0) in vec3 a_Position;
 
 out vec3 v_TexCoords;
 
-layout (std140) uniform CameraData
-{
-    mat4 u_Projection;
-    mat4 u_View;
-    vec3 u_ViewPos;
-};
+#include "Camera.glsl"
 
 void main()
 {
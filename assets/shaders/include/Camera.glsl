@@ -0,0 +1,10 @@
+#pragma once
+
+// Binding point 0, filled once per frame by the active layer
+layout(std140) uniform Camera
+{
+    mat4 u_ViewProjection;
+    mat4 u_View;
+    mat4 u_Projection;
+    vec3 u_CameraPosition;
+};
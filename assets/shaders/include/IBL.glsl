@@ -0,0 +1,44 @@
+#pragma once
+
+// Filled by Environment::Bind(), or Environment::BindFallback() without an environment. Both
+// samplers keep their own texture units even when u_HasEnvironment is 0, since a samplerCube
+// may not share a unit with the material's 2D maps.
+uniform int u_HasEnvironment;
+uniform samplerCube u_PrefilteredMap;
+uniform float u_PrefilteredMaxLod;
+// Split-sum GGX scale (r) and bias (g) by NdotV (x) and roughness (y)
+uniform sampler2D u_BRDFLut;
+// SH9 irradiance with the cosine lobe and 1/PI already folded in
+uniform vec3 u_IrradianceSH[9];
+
+vec3 IrradianceSH(vec3 n)
+{
+    vec3 result = u_IrradianceSH[0] * 0.282095
+                + u_IrradianceSH[1] * 0.488603 * n.y
+                + u_IrradianceSH[2] * 0.488603 * n.z
+                + u_IrradianceSH[3] * 0.488603 * n.x
+                + u_IrradianceSH[4] * 1.092548 * n.x * n.y
+                + u_IrradianceSH[5] * 1.092548 * n.y * n.z
+                + u_IrradianceSH[6] * 0.315392 * (3.0 * n.z * n.z - 1.0)
+                + u_IrradianceSH[7] * 1.092548 * n.x * n.z
+                + u_IrradianceSH[8] * 0.546274 * (n.x * n.x - n.y * n.y);
+    return max(result, vec3(0.0));
+}
+
+vec3 FresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness)
+{
+    return F0 + (max(vec3(1.0 - roughness), F0) - F0) * pow(clamp(1.0 - cosTheta, 0.0, 1.0), 5.0);
+}
+
+vec3 AmbientIBL(vec3 N, vec3 V, vec3 albedo, vec3 F0, float metallic, float roughness)
+{
+    float NdotV = max(dot(N, V), 0.0);
+    vec3 F = FresnelSchlickRoughness(NdotV, F0, roughness);
+    vec3 kD = (1.0 - F) * (1.0 - metallic);
+
+    vec3 R = reflect(-V, N);
+    vec3 prefiltered = textureLod(u_PrefilteredMap, R, roughness * u_PrefilteredMaxLod).rgb;
+    vec2 brdf = texture(u_BRDFLut, vec2(NdotV, roughness)).rg;
+
+    return kD * albedo * IrradianceSH(N) + prefiltered * (F0 * brdf.x + brdf.y);
+}